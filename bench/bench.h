@@ -0,0 +1,181 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| TINY BENCHMARK HARNESS FOR HOST BUILDS. EACH CASE IS RUN REPEATEDLY UNTIL A  |
+| MINIMUM AMOUNT OF TIME HAS PASSED, THEN REPORTED AS NS/OP AND PIXELS/SEC.    |
+| RESULTS ARE PRINTED AS A TABLE, AND CAN ALSO BE WRITTEN AS JSON WITH --JSON. |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __bench_h__
+#define __bench_h__
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// KEEP THE COMPILER FROM OPTIMIZING AWAY A VALUE OR THE MEMORY IT POINTS TO
+////////////////////////////////////////////////////////////////////////////////
+template <class T>
+inline void bench_keep(T const &value) {
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void bench_clobber() {
+	asm volatile("" : : : "memory");
+}
+
+
+
+
+class bench_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// SINGLE BENCHMARK RESULT
+		////////////////////////////////////////////////////////////////////////
+		struct result_t {
+			std::string	name;
+			double		ns_per_op;
+			double		pixels_per_sec;
+			uint64_t	ops;
+		};
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PARSE THE COMMON COMMAND LINE OPTIONS
+		// --json FILE		ALSO WRITE RESULTS TO FILE AS JSON
+		// --filter TEXT	ONLY RUN CASES WHOSE NAME CONTAINS TEXT
+		// --min-time MS	MINIMUM RUN TIME PER CASE, DEFAULT 100MS
+		////////////////////////////////////////////////////////////////////////
+		bench_t(const char *suite, int argc, char **argv) : suite(suite) {
+			for (int i=1; i<argc; i++) {
+				if (!strcmp(argv[i], "--json")  &&  i+1 < argc) {
+					this->json = argv[++i];
+				} else if (!strcmp(argv[i], "--filter")  &&  i+1 < argc) {
+					this->filter = argv[++i];
+				} else if (!strcmp(argv[i], "--min-time")  &&  i+1 < argc) {
+					this->min_time = atof(argv[++i]) / 1000.0;
+				} else {
+					fprintf(stderr, "usage: %s [--json FILE] [--filter TEXT] [--min-time MS]\n", argv[0]);
+					exit(EXIT_FAILURE);
+				}
+			}
+
+			printf("%-40s %14s %16s\n", this->suite.c_str(), "ns/op", "pixels/sec");
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// WRITE THE JSON REPORT ON THE WAY OUT, IF ONE WAS REQUESTED
+		////////////////////////////////////////////////////////////////////////
+		~bench_t() {
+			if (!this->json.empty()) this->write_json();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// TIME A CALLABLE. EACH CALL PERFORMS "OPS" OPERATIONS (USUALLY ONE
+		// OPERATION PER PIXEL), SO THE REPORTED NUMBERS ARE PER PIXEL. A TEST
+		// SKIPPED BY THE FILTER RETURNS A RESULT WITH ZERO OPS
+		////////////////////////////////////////////////////////////////////////
+		template <class FUNC>
+		result_t run(const std::string &name, uint64_t ops, FUNC func) {
+			if (!this->filter.empty()  &&  name.find(this->filter) == std::string::npos) {
+				return result_t();
+			}
+
+			typedef std::chrono::steady_clock clock;
+
+			func();	// WARM UP CACHES AND BRANCH PREDICTORS
+
+			uint64_t	calls	= 0;
+			double		elapsed	= 0;
+			auto		start	= clock::now();
+
+			do {
+				func();
+				calls++;
+				elapsed = std::chrono::duration<double>(clock::now() - start).count();
+			} while (elapsed < this->min_time);
+
+			result_t result;
+			result.name				= name;
+			result.ops				= calls * ops;
+			result.ns_per_op		= elapsed * 1e9 / (double)result.ops;
+			result.pixels_per_sec	= (double)result.ops / elapsed;
+			this->results.push_back(result);
+
+			printf("%-40s %14.3f %16.0f\n", name.c_str(), result.ns_per_op, result.pixels_per_sec);
+			fflush(stdout);
+
+			return result;
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// DUMP ALL RESULTS AS A SINGLE JSON DOCUMENT
+		////////////////////////////////////////////////////////////////////////
+		void write_json() {
+			FILE *file = fopen(this->json.c_str(), "w");
+			if (!file) {
+				perror(this->json.c_str());
+				return;
+			}
+
+			fprintf(file, "{\n\t\"suite\": \"%s\",\n\t\"results\": [", this->suite.c_str());
+
+			for (size_t i=0; i<this->results.size(); i++) {
+				const result_t &result = this->results[i];
+				fprintf(file,
+					"%s\n\t\t{\"name\": \"%s\", \"ns_per_op\": %.4f, \"pixels_per_sec\": %.1f, \"ops\": %llu}",
+					i ? "," : "",
+					result.name.c_str(),
+					result.ns_per_op,
+					result.pixels_per_sec,
+					(unsigned long long) result.ops
+				);
+			}
+
+			fprintf(file, "\n\t]\n}\n");
+			fclose(file);
+		}
+
+
+
+
+		std::string				suite;
+		std::string				json;
+		std::string				filter;
+		double					min_time	= 0.1;
+		std::vector<result_t>	results;
+};
+
+
+
+
+#endif //__bench_h__
@@ -0,0 +1,364 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| HOST BENCHMARK FOR EVERY COLOR_T OPERATION. EACH CASE WORKS ACROSS A FULL    |
+| FRAME OF PIXELS, SO THE NUMBERS REPORTED ARE PER PIXEL.                      |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#include <Arduino.h>
+#include "color.h"
+#include "color_span.h"
+#include "color_gamma.h"
+#include "color_nearest.h"
+#include "color16.h"
+#include "color_order.h"
+#include "color_power.h"
+#include "color_compositor.h"
+#include "color_pacer.h"
+#include "color_anim.h"
+#include "color_packed.h"
+#include "color_matrix.h"
+#include "bench.h"
+
+
+
+
+#define FRAME	10000
+
+
+
+
+static color_t		src[FRAME];
+static color_t		dst[FRAME];
+static color16_t	wide[2][FRAME];
+static color_rgb_t	rgbs[FRAME];
+static color_rgbw_t	rgbws[FRAME];
+static color_t		scratch[FRAME];
+static color_framebuffer_t<FRAME>	composite;
+static color_t		show[2][FRAME];
+static uint8_t		encoded[COLOR_ANIM_BOUND(FRAME, 3)];
+static uint16_t		packed16[FRAME];
+static uint16_t		maps[2][FRAME];
+static uint8_t		bytes[FRAME];
+static int16_t		int16s[FRAME];
+static int32_t		int32s[FRAME];
+static long			longs[FRAME];
+static char			hexes[3][FRAME][10];
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FILL THE INPUT ARRAYS WITH REPEATABLE PSEUDO-RANDOM DATA
+////////////////////////////////////////////////////////////////////////////////
+static void setup() {
+	uint32_t seed = 0x12345678;
+
+	for (int i=0; i<FRAME; i++) {
+		seed		= seed * 1664525ul + 1013904223ul;
+		src[i]		= (uint32_t)(seed >> 8);
+		dst[i]		= (uint32_t)(seed >> 4);
+		bytes[i]	= seed >> 24;
+		int16s[i]	= (int16_t)(seed >> 17);
+		int32s[i]	= (int32_t)(seed >> 8);
+		longs[i]	= (long)(seed >> 8);
+
+		src[i].hex(hexes[0][i], COLOR_HEX_NORMAL);
+		src[i].hex(hexes[1][i], COLOR_HEX_HTML);
+		src[i].hex(hexes[2][i], COLOR_HEX_LITERAL);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RUN A PER-PIXEL EXPRESSION ACROSS THE WHOLE FRAME
+////////////////////////////////////////////////////////////////////////////////
+#define PER_PIXEL(name, statement)							\
+	bench.run(name, FRAME, [&]() {							\
+		for (int i=0; i<FRAME; i++) { statement; }			\
+		bench_clobber();									\
+	})
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RUN A SINGLE WHOLE-FRAME STATEMENT
+////////////////////////////////////////////////////////////////////////////////
+#define PER_FRAME(name, statement)							\
+	bench.run(name, FRAME, [&]() {							\
+		statement;											\
+		bench_clobber();									\
+	})
+
+
+
+
+int main(int argc, char **argv) {
+	bench_t bench("color_t", argc, argv);
+	setup();
+
+	uint32_t sum = 0;
+
+
+	// CONSTRUCTORS
+	PER_PIXEL("ctor/default",			dst[i] = color_t());
+	PER_PIXEL("ctor/copy",				dst[i] = color_t(src[i]));
+	PER_PIXEL("ctor/pointer",			dst[i] = color_t(&src[i]));
+	PER_PIXEL("ctor/rgb",				dst[i] = color_t(bytes[i], bytes[FRAME-1-i], bytes[i] ^ 0x55));
+	PER_PIXEL("ctor/int16",				dst[i] = color_t((int16_t)int16s[i]));
+	PER_PIXEL("ctor/uint16",			dst[i] = color_t((uint16_t)int16s[i]));
+	PER_PIXEL("ctor/int32",				dst[i] = color_t((int32_t)int32s[i]));
+	PER_PIXEL("ctor/uint32",			dst[i] = color_t((uint32_t)int32s[i]));
+	PER_PIXEL("ctor/long",				dst[i] = color_t(longs[i]));
+	PER_PIXEL("ctor/string",			dst[i] = color_t(String(hexes[1][i])));
+	PER_PIXEL("ctor/char_normal",		dst[i] = color_t(hexes[0][i]));
+	PER_PIXEL("ctor/char_html",			dst[i] = color_t(hexes[1][i]));
+	PER_PIXEL("ctor/char_literal",		dst[i] = color_t(hexes[2][i]));
+
+
+	// CONVERSION OPERATORS
+	PER_PIXEL("get/int16",				sum += (int16_t)src[i]);
+	PER_PIXEL("get/uint16",				sum += (uint16_t)src[i]);
+	PER_PIXEL("get/int32",				sum += (int32_t)src[i]);
+	PER_PIXEL("get/uint32",				sum += (uint32_t)src[i]);
+	PER_PIXEL("get/grb",				sum += src[i].grb());
+	PER_PIXEL("set/int16",				dst[i] = (int16_t)int16s[i]);
+	PER_PIXEL("set/uint16",				dst[i] = (uint16_t)int16s[i]);
+	PER_PIXEL("set/int32",				dst[i] = (int32_t)int32s[i]);
+	PER_PIXEL("set/uint32",				dst[i] = (uint32_t)int32s[i]);
+
+
+	// PER-PIXEL BLEND OPERATIONS
+	PER_PIXEL("op/min",					dst[i].min(src[i]));
+	PER_PIXEL("op/max",					dst[i].max(src[i]));
+	PER_PIXEL("op/add",					dst[i].add(src[i]));
+	PER_PIXEL("op/sub",					dst[i].sub(src[i]));
+	PER_PIXEL("op/screen",				dst[i].screen(src[i]));
+	PER_PIXEL("op/multiply",			dst[i].multiply(src[i]));
+	PER_PIXEL("op/left",				dst[i].left(1));
+	PER_PIXEL("op/right",				dst[i].right(1));
+
+
+	// BULK BLEND OPERATIONS
+	PER_FRAME("span/min",				color_span_min(dst, src, FRAME));
+	PER_FRAME("span/max",				color_span_max(dst, src, FRAME));
+	PER_FRAME("span/add",				color_span_add(dst, src, FRAME));
+	PER_FRAME("span/sub",				color_span_sub(dst, src, FRAME));
+	PER_FRAME("span/screen",			color_span_screen(dst, src, FRAME));
+	PER_FRAME("span/multiply",			color_span_multiply(dst, src, FRAME));
+	PER_FRAME("span/add_value",			color_span_add(dst, src[0], FRAME));
+	PER_FRAME("span/multiply_value",	color_span_multiply(dst, src[0], FRAME));
+
+
+	// GAMMA, BRIGHTNESS, AND WHITE BALANCE: THREE PASSES VERSUS ONE FUSED PASS
+	color_correction_t correction;
+	correction.brightness(160);
+	correction.balance(color_t(255, 220, 200));
+	const uint8_t *gamma = color_gamma<220>::table;
+
+	PER_FRAME("correct/three_pass",
+		for (int i=0; i<FRAME; i++) {
+			dst[i].g = gamma[src[i].g];
+			dst[i].r = gamma[src[i].r];
+			dst[i].b = gamma[src[i].b];
+		}
+		color_span_multiply(dst, color_t(160, 160, 160), FRAME);
+		color_span_multiply(dst, color_t(255, 220, 200), FRAME)
+	);
+	PER_FRAME("correct/fused",			correction.apply(src, dst, FRAME));
+
+
+	// GENERATORS
+	PER_PIXEL("hue",					dst[i] = color_t::hue(int16s[i] % 768));
+	PER_PIXEL("palette",				dst[i] = color_t::palette(bytes[i] & 0x0f));
+
+
+	// HSV AND HSL
+	PER_PIXEL("hsv/from_hsv",			dst[i] = color_t::from_hsv(int16s[i], bytes[i], 255));
+	PER_PIXEL("hsv/from_hsl",			dst[i] = color_t::from_hsl(int16s[i], bytes[i], 128));
+	PER_PIXEL("hsv/to_hsv",				sum += src[i].to_hsv().h);
+	PER_PIXEL("hsv/to_hsl",				sum += src[i].to_hsl().h);
+	PER_PIXEL("hsv/sweep_hue",			dst[i] = color_t::hue(i % 768));
+	PER_PIXEL("hsv/sweep_from_hsv",		dst[i] = color_t::from_hsv(i * 85, 255, 255));
+	PER_FRAME("hsv/sweep_fill",			color_hsv_fill(dst, FRAME, 0, 85));
+
+
+	// PALETTES
+	const color_palette_t rainbow(color_palette_rainbow);
+	const color_palette_buffer_t<256> gradient(rainbow);
+	PER_FRAME("palette/map_flash16",	rainbow.map_palette(bytes, dst, FRAME));
+	PER_FRAME("palette/map_ram256",		gradient.map_palette(bytes, dst, FRAME));
+	PER_FRAME("palette/blend16",		rainbow.fill(dst, FRAME, 0, 7));
+	PER_FRAME("palette/blend256",		gradient.fill(dst, FRAME, 0, 7));
+
+
+	// NAME LOOKUP
+	const char *names[COLOR_NAMES_COUNT];
+	for (int i=0; i<COLOR_NAMES_COUNT; i++) {
+		names[i] = color_names_name(i);
+	}
+	PER_PIXEL("from_name",				dst[i] = color_t::from_name(names[i % COLOR_NAMES_COUNT]));
+
+
+	// NEAREST COLOR
+	PER_PIXEL("nearest/name",			sum += color_nearest_name(src[i]));
+	PER_PIXEL("nearest/perceptual",		sum += color_nearest_name(src[i], COLOR_METRIC_PERCEPTUAL));
+	PER_PIXEL("nearest/palette",		sum += color_nearest_palette(src[i]));
+	PER_PIXEL("nearest/brute_force",	{
+		uint32_t best = 0xffffffff;
+		for (int slot=0; slot<COLOR_NAMES_COUNT; slot++) {
+			best = _min(best, color_distance(src[i], color_names_color(slot)));
+		}
+		sum += best;
+	});
+	PER_FRAME("nearest/quantize",		color_nearest_quantize(src, FRAME, bytes, dst, 16));
+
+
+	// HEX FORMATTING
+	char buffer[10];
+	PER_PIXEL("hex/normal",				bench_keep(src[i].hex(buffer, COLOR_HEX_NORMAL)));
+	PER_PIXEL("hex/html",				bench_keep(src[i].hex(buffer, COLOR_HEX_HTML)));
+	PER_PIXEL("hex/literal",			bench_keep(src[i].hex(buffer, COLOR_HEX_LITERAL)));
+	PER_PIXEL("hex/string",				sum += src[i].hex(COLOR_HEX_HTML).length());
+
+
+	// WHOLE FRAME HEX TEXT
+	static char frame[FRAME * 9 + 1];
+	size_t length = 0;
+	PER_FRAME("hex/format_frame_normal",	length = color_t::format_hex_frame(src, FRAME, frame, COLOR_HEX_NORMAL));
+	PER_FRAME("hex/parse_frame_normal",		color_t::parse_hex_frame(frame, length, dst, FRAME, bytes));
+	PER_FRAME("hex/format_frame_literal",	length = color_t::format_hex_frame(src, FRAME, frame, COLOR_HEX_LITERAL));
+	PER_FRAME("hex/parse_frame_literal",	color_t::parse_hex_frame(frame, length, dst, FRAME, bytes));
+
+
+	// CROSSFADES
+	PER_PIXEL("blend/lerp",				dst[i] = color_t::lerp(src[i], dst[i], bytes[i]));
+	PER_FRAME("blend/span_alpha",		color_span_blend(dst, src, dst, 77, FRAME));
+	PER_FRAME("blend/span_mask",		color_span_blend_mask(dst, src, dst, bytes, FRAME));
+
+
+	// 16 BIT WORKING COLOR
+	color16_expand(src, wide[1], FRAME);
+	PER_FRAME("color16/expand",			color16_expand(dst, wide[0], FRAME));
+	PER_FRAME("color16/span_add",		color16_span_add(wide[0], wide[1], FRAME));
+	PER_FRAME("color16/span_multiply",	color16_span_multiply(wide[0], wide[1], FRAME));
+	PER_FRAME("color16/span_screen",	color16_span_screen(wide[0], wide[1], FRAME));
+	PER_FRAME("color16/reduce",			color16_reduce(wide[0], dst, FRAME));
+	PER_FRAME("color16/dither",			color16_dither(wide[0], dst, FRAME, 3));
+	PER_PIXEL("color16/multiply",		wide[0][i].multiply(wide[1][i]));
+
+
+	// CHANNEL ORDER CONVERSION
+	PER_FRAME("order/grb_to_rgb",		color_order_convert(src, rgbs, FRAME));
+	PER_FRAME("order/rgb_to_grb",		color_order_convert(rgbs, dst, FRAME));
+	PER_FRAME("order/grb_to_rgbw",		color_order_convert(src, rgbws, FRAME));
+	PER_FRAME("order/rgbw_to_grb",		color_order_convert(rgbws, dst, FRAME));
+	PER_PIXEL("order/rgbw_per_pixel",	rgbws[i] = src[i]);
+
+
+	// POWER BUDGETING
+	const color_power_t power;
+	color_power_strip_t strip(dst, FRAME, power);
+	PER_FRAME("power/estimate",			sum += power.milliamps(src, FRAME));
+	PER_FRAME("power/scale",			sum += color_power_scale(dst, FRAME, 255).g);
+	PER_FRAME("power/copy_and_limit",	{
+		memcpy((void*)dst, src, sizeof(dst));
+		sum += power.limit(dst, FRAME, 20000);
+	});
+	PER_PIXEL("power/strip_set",		{
+		strip.set(i, src[i]);
+		sum += strip.milliamps();
+	});
+
+
+	// LAYER COMPOSITING, TILED AGAINST ONE FULL FRAME PASS PER LAYER
+	color_compositor_t compositor(composite);
+	compositor.push(src);
+	compositor.push(dst, COLOR_BLEND_SCREEN, 128);
+	compositor.push(src, COLOR_BLEND_MULTIPLY);
+	compositor.push(dst, COLOR_BLEND_ADD, 64);
+	PER_FRAME("compositor/tiled",		{
+		compositor.invalidate();
+		compositor.render();
+	});
+	PER_FRAME("compositor/untiled",		{
+		color_t *out = composite.modify();
+		memcpy((void*)out, src, sizeof(src));
+		memcpy((void*)scratch, out, sizeof(scratch));
+		color_span_screen(scratch, dst, FRAME);
+		color_span_blend(out, scratch, 128, FRAME);
+		color_span_multiply(out, src, FRAME);
+		memcpy((void*)scratch, out, sizeof(scratch));
+		color_span_add(scratch, dst, FRAME);
+		color_span_blend(out, scratch, 64, FRAME);
+	});
+	PER_FRAME("compositor/dirty_tenth",	{
+		compositor.mark(1, 4500, FRAME / 10);
+		compositor.render();
+	});
+
+
+	// ANIMATION COMPRESSION: A SCROLLING RAINBOW, A FADING BLOCK, AND A
+	// STATIC BACKGROUND, AS TWO CONSECUTIVE FRAMES
+	for (int i=0; i<FRAME; i++) {
+		const bool fade = (i / 1000) % 2;
+		show[0][i] = i < FRAME / 2 ? color_t::hue(i % 768) : fade ? color_t(90, 60, 30) : color_t(0, 0, 8);
+		show[1][i] = i < FRAME / 2 ? color_t::hue((i + 4) % 768) : fade ? color_t(88, 58, 28) : color_t(0, 0, 8);
+	}
+	const uint8_t *shown[2] = {(const uint8_t*)show[0], (const uint8_t*)show[1]};
+	size_t packed = 0;
+	PER_FRAME("anim/encode_key",		packed = color_anim_encode<3>(shown[1], nullptr, FRAME, encoded));
+	PER_FRAME("anim/decode_key",		color_anim_decode(encoded, packed, true, dst, FRAME));
+	PER_FRAME("anim/encode_diff",		packed = color_anim_encode<3>(shown[1], shown[0], FRAME, encoded));
+	PER_FRAME("anim/decode_diff",		{
+		memcpy((void*)dst, show[0], sizeof(dst));
+		color_anim_decode(encoded, packed, false, dst, FRAME);
+	});
+
+
+	// PACKED 2 BYTE STORAGE: 20KB PER FRAME INSTEAD OF 30KB
+	color_pack<COLOR_PACKED_565>(src, packed16, FRAME);
+	PER_FRAME("packed/pack565",			color_pack<COLOR_PACKED_565>(src, packed16, FRAME));
+	PER_FRAME("packed/expand565",		color_expand<COLOR_PACKED_565>(packed16, dst, FRAME));
+	PER_FRAME("packed/expand555",		color_expand<COLOR_PACKED_555>(packed16, dst, FRAME));
+	PER_PIXEL("packed/unpack565",		dst[i] = color_unpack<COLOR_PACKED_565>(packed16[i]));
+	PER_FRAME("packed/expand565_chunks",	{
+		for (int i=0; i<FRAME; i+=64) {
+			color_expand<COLOR_PACKED_565>(packed16 + i, scratch, _min(64, FRAME - i));
+			bench_clobber();
+		}
+	});
+
+
+	// MATRIX MAPPING: A 100X100 SERPENTINE MATRIX, AND THE SAME SIZE BUILT
+	// FROM 10X10 SERPENTINE PANELS
+	color_matrix_t snake(dst, FRAME, 100, 100, maps[0], COLOR_MATRIX_SERPENTINE);
+	color_matrix_t tiled(dst, FRAME, 100, 100, maps[1], COLOR_MATRIX_SERPENTINE, 10, 10);
+	PER_PIXEL("matrix/locate",			dst[color_matrix_locate(COLOR_MATRIX_SERPENTINE, 100, 100, i % 100, i / 100)] = src[i]);
+	PER_PIXEL("matrix/set",				snake.set(i % 100, i / 100, src[i]));
+	PER_FRAME("matrix/fill",			snake.fill(0, 0, 100, 100, src[0]));
+	PER_FRAME("matrix/blit",			snake.blit(src, 100, 0, 0, 100, 100));
+	PER_FRAME("matrix/blit_tiled",		tiled.blit(src, 100, 0, 0, 100, 100));
+	PER_FRAME("matrix/scroll",			snake.scroll(1, 1));
+	PER_FRAME("matrix/scroll_tiled",	tiled.scroll(1, 1));
+
+
+	// FRAME PACING INSTRUMENTATION
+	color_histogram_t histogram;
+	color_pacer_t pacer(60);
+	PER_PIXEL("pacer/histogram_record",	histogram.record(int32s[i] & 0xfffff));
+	PER_PIXEL("pacer/stage_lap",		pacer.lap(COLOR_PACER_RENDER));
+	bench_keep(histogram.percentile(99));
+
+
+	bench_keep(sum);
+	return 0;
+}
@@ -0,0 +1,214 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| HOST BENCHMARK FOR THE NETWORK PIXEL RECEIVER. DECODE CASES FEED PREBUILT    |
+| PACKETS STRAIGHT TO THE RECEIVER, AND THE LOOPBACK CASE SENDS A WHOLE FRAME  |
+| OF E1.31 UNIVERSES THROUGH A REAL UDP SOCKET AND RECEIVES IT WITH RECVMMSG.  |
+| NUMBERS ARE PER PIXEL, WITH PACKETS PER SECOND PRINTED AFTER EACH CASE.      |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <vector>
+#include "color.h"
+#include "color_net.h"
+#include "bench.h"
+
+
+
+
+#define FRAME		10200	// 60 FULL UNIVERSES OF 170 PIXELS
+#define CHANNELS	510
+#define UNIVERSES	((FRAME * 3 + CHANNELS - 1) / CHANNELS)
+#define DDP_CHUNK	1440
+
+
+
+
+static color_t	pixels[FRAME];
+static uint8_t	wire[FRAME * 3];
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PACKET BUILDERS, ONE PER PROTOCOL
+////////////////////////////////////////////////////////////////////////////////
+static std::vector<uint8_t> e131(uint16_t universe, uint8_t sequence, const uint8_t *data, size_t length) {
+	std::vector<uint8_t> packet(126 + length, 0);
+	uint8_t *p = packet.data();
+	p[1]	= 0x10;
+	memcpy(p + 4, "ASC-E1.17\0\0\0", 12);
+	p[21]	= 0x04;
+	p[43]	= 0x02;
+	p[108]	= 100;
+	p[111]	= sequence;
+	p[113]	= universe >> 8;
+	p[114]	= universe;
+	p[117]	= 0x02;
+	p[118]	= 0xa1;
+	p[122]	= 1;
+	p[123]	= (length + 1) >> 8;
+	p[124]	= (length + 1);
+	memcpy(p + 126, data, length);
+	return packet;
+}
+
+
+
+static std::vector<uint8_t> artnet(uint16_t universe, uint8_t sequence, const uint8_t *data, size_t length) {
+	std::vector<uint8_t> packet(18 + length, 0);
+	uint8_t *p = packet.data();
+	memcpy(p, "Art-Net", 8);
+	p[9]	= 0x50;
+	p[11]	= 14;
+	p[12]	= sequence;
+	p[14]	= universe;
+	p[15]	= universe >> 8;
+	p[16]	= length >> 8;
+	p[17]	= length;
+	memcpy(p + 18, data, length);
+	return packet;
+}
+
+
+
+static std::vector<uint8_t> ddp(uint32_t offset, bool push, uint8_t sequence, const uint8_t *data, size_t length) {
+	std::vector<uint8_t> packet(10 + length, 0);
+	uint8_t *p = packet.data();
+	p[0]	= 0x40 | (push ? 0x01 : 0x00);
+	p[1]	= sequence;
+	p[2]	= 0x0b;
+	p[3]	= 0x01;
+	p[4]	= offset >> 24;
+	p[5]	= offset >> 16;
+	p[6]	= offset >> 8;
+	p[7]	= offset;
+	p[8]	= length >> 8;
+	p[9]	= length;
+	memcpy(p + 10, data, length);
+	return packet;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ONE FRAME'S WORTH OF PACKETS. SEQUENCES ARE LEFT AT ZERO (UNUSED), SO THE
+// SAME PACKETS CAN BE REPLAYED OVER AND OVER
+////////////////////////////////////////////////////////////////////////////////
+static std::vector<std::vector<uint8_t>> frame(COLOR_NET_PROTOCOL protocol) {
+	std::vector<std::vector<uint8_t>> packets;
+
+	if (protocol == COLOR_NET_DDP) {
+		for (size_t offset=0; offset<sizeof(wire); offset+=DDP_CHUNK) {
+			const size_t length = _min((size_t)DDP_CHUNK, sizeof(wire) - offset);
+			packets.push_back(ddp(offset, offset + length == sizeof(wire), 0, wire + offset, length));
+		}
+		return packets;
+	}
+
+	for (size_t i=0; i<UNIVERSES; i++) {
+		const size_t length = _min((size_t)CHANNELS, sizeof(wire) - i * CHANNELS);
+		packets.push_back(protocol == COLOR_NET_E131
+			? e131(i + 1, 0, wire + i * CHANNELS, length)
+			: artnet(i, 0, wire + i * CHANNELS, length)
+		);
+	}
+
+	return packets;
+}
+
+
+
+
+static void report(const bench_t::result_t &result, size_t packets) {
+	if (!result.ops) return;
+	printf("%-40s %14s %16.0f packets/sec\n", "", "", result.pixels_per_sec / FRAME * packets);
+}
+
+
+
+
+int main(int argc, char **argv) {
+	bench_t bench("net", argc, argv);
+
+	for (size_t i=0; i<sizeof(wire); i++) wire[i] = (uint8_t)(i * 131 + 7);
+
+	color_net_receiver_t receiver(pixels, FRAME, 1, CHANNELS);
+
+
+	// DECODE COST, PACKETS ALREADY IN MEMORY
+	const struct {
+		const char			*name;
+		COLOR_NET_PROTOCOL	protocol;
+	} cases[] = {
+		{"decode/e131",		COLOR_NET_E131},
+		{"decode/artnet",	COLOR_NET_ARTNET},
+		{"decode/ddp",		COLOR_NET_DDP},
+	};
+
+	for (const auto &test : cases) {
+		const std::vector<std::vector<uint8_t>> packets = frame(test.protocol);
+		report(bench.run(test.name, FRAME, [&]() {
+			for (const std::vector<uint8_t> &packet : packets) {
+				receiver.ingest(packet.data(), packet.size());
+			}
+			bench_keep(receiver.ready());
+			bench_clobber();
+		}), packets.size());
+	}
+
+
+	// LOOPBACK: SENDMMSG A FRAME OF E1.31, RECVMMSG IT BACK
+	color_net_socket_t socket;
+	const int sender = ::socket(AF_INET, SOCK_DGRAM, 0);
+	if (!socket.open(0, true)  ||  sender < 0) {
+		perror("loopback socket");
+		return 1;
+	}
+
+	struct sockaddr_in target;
+	memset(&target, 0, sizeof(target));
+	target.sin_family		= AF_INET;
+	target.sin_port			= htons(socket.port());
+	target.sin_addr.s_addr	= htonl(INADDR_LOOPBACK);
+
+	std::vector<std::vector<uint8_t>>	packets = frame(COLOR_NET_E131);
+	std::vector<struct mmsghdr>			messages(packets.size());
+	std::vector<struct iovec>			vectors(packets.size());
+
+	for (size_t i=0; i<packets.size(); i++) {
+		vectors[i].iov_base	= packets[i].data();
+		vectors[i].iov_len	= packets[i].size();
+		memset(&messages[i], 0, sizeof(messages[i]));
+		messages[i].msg_hdr.msg_name	= &target;
+		messages[i].msg_hdr.msg_namelen	= sizeof(target);
+		messages[i].msg_hdr.msg_iov		= &vectors[i];
+		messages[i].msg_hdr.msg_iovlen	= 1;
+	}
+
+	receiver.reset();
+	report(bench.run("loopback/e131_recvmmsg", FRAME, [&]() {
+		sendmmsg(sender, messages.data(), messages.size(), 0);
+		while (!receiver.ready()) {
+			if (!socket.receive(receiver, 100)) break;
+		}
+		bench_clobber();
+	}), packets.size());
+
+	const color_net_stats_t &stats = receiver.stats();
+	printf("loopback: %lu frames, %lu incomplete, %lu packets\n",
+		(unsigned long) stats.frames,
+		(unsigned long) stats.incomplete,
+		(unsigned long) stats.packets
+	);
+
+	close(sender);
+	return 0;
+}
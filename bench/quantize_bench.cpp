@@ -0,0 +1,141 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| HOST BENCHMARK FOR THE PALETTE QUANTIZER ON A 1024X1024 GENERATED IMAGE.     |
+| EVERY CASE IS TIMED PER SOURCE PIXEL, SO BUILD() SHOWS HOW LITTLE THE        |
+| PALETTE COSTS ONCE SPREAD OVER A MEGAPIXEL. EACH PALETTE SIZE ALSO PRINTS    |
+| THE MEAN REDMEAN ERROR OF THE TABLE REMAP NEXT TO AN EXACT PER PIXEL SEARCH. |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include "color.h"
+#include "color_nearest.h"
+#include "color_quantize.h"
+#include "bench.h"
+
+
+
+
+#define WIDTH		1024
+#define HEIGHT		1024
+#define PIXELS		(WIDTH * HEIGHT)
+
+
+
+
+static color_t				image[PIXELS];
+static color_t				output[PIXELS];
+static uint8_t				indexes[PIXELS];
+static uint8_t				exact[PIXELS];
+static color_quantize_t<>	quantize;
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SMOOTH PLASMA WITH A LITTLE NOISE, SO THE IMAGE HAS TENS OF THOUSANDS OF
+// DISTINCT COLORS BUT STILL CLUSTERS THE WAY A PHOTO DOES
+////////////////////////////////////////////////////////////////////////////////
+static void generate() {
+	uint32_t seed = 1;
+
+	for (int y=0; y<HEIGHT; y++) {
+		for (int x=0; x<WIDTH; x++) {
+			const double v = sin(x * 0.010) + sin(y * 0.013) + sin((x + y) * 0.007);
+
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+
+			image[y * WIDTH + x] = color_t(
+				(uint8_t)(128 + 100 * sin(v * 2.0)		+ ((seed >>  0) & 15)),
+				(uint8_t)(128 + 100 * sin(v * 3.0 + 1)	+ ((seed >>  8) & 15)),
+				(uint8_t)(128 +  60 * cos(v * 1.5)		+ ((seed >> 16) & 15))
+			);
+		}
+	}
+}
+
+
+
+
+static double error(const uint8_t *map) {
+	double total = 0;
+	for (size_t i=0; i<PIXELS; i++) {
+		total += color_distance(image[i], quantize.palette(map[i]), COLOR_METRIC_REDMEAN);
+	}
+	return total / PIXELS;
+}
+
+
+
+
+int main(int argc, char **argv) {
+	bench_t bench("quantize", argc, argv);
+
+	generate();
+
+
+	// HISTOGRAM ONLY, EVERY PIXEL AND EVERY FOURTH PIXEL
+	bench.run("histogram/all", PIXELS, [&]() {
+		quantize.reset();
+		quantize.add(image, PIXELS);
+		bench_clobber();
+	});
+
+	bench.run("histogram/step4", PIXELS, [&]() {
+		quantize.reset();
+		quantize.add(image, PIXELS, 4);
+		bench_clobber();
+	});
+
+
+	const uint16_t sizes[] = {16, 256};
+
+	for (const uint16_t size : sizes) {
+		const std::string suffix = "/" + std::to_string(size);
+
+		quantize.reset();
+		quantize.add(image, PIXELS);
+
+		bench.run("build" + suffix, PIXELS, [&]() {
+			bench_keep(quantize.build(size));
+		});
+
+		bench.run("remap/indexes" + suffix, PIXELS, [&]() {
+			quantize.remap(image, PIXELS, indexes);
+			bench_clobber();
+		});
+
+		bench.run("remap/colors" + suffix, PIXELS, [&]() {
+			memcpy((void*)output, (const void*)image, sizeof(output));
+			quantize.remap(output, PIXELS);
+			bench_clobber();
+		});
+
+		bench.run("full" + suffix, PIXELS, [&]() {
+			quantize.reset();
+			quantize.add(image, PIXELS);
+			quantize.build(size);
+			quantize.remap(image, PIXELS, indexes);
+			bench_clobber();
+		});
+
+		bench.run("nearest" + suffix, PIXELS, [&]() {
+			color_nearest_quantize(image, PIXELS, exact, quantize.palette(), quantize.size(), COLOR_METRIC_REDMEAN);
+			bench_clobber();
+		});
+
+		printf("%-40s mean error %.1f quantize, %.1f nearest\n", "", error(indexes), error(exact));
+	}
+
+	return 0;
+}
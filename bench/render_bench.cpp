@@ -0,0 +1,95 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| HOST BENCHMARK FOR THE MULTI-THREADED RENDERER. A 200K PIXEL INSTALLATION IS |
+| RENDERED WITH 1 THREAD, THEN DOUBLING UP TO EVERY CORE ON THE MACHINE, SO    |
+| THE SCALING CAN BE READ STRAIGHT OFF THE TABLE.                              |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#include <Arduino.h>
+#include "color.h"
+#include "color_hsv.h"
+#include "color_render.h"
+#include "bench.h"
+
+
+
+
+#define STRIPS	40
+#define LENGTH	5000
+#define FRAME	(STRIPS * LENGTH)
+
+
+
+
+static color_t pixels[STRIPS][LENGTH];
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// A MOVING RAINBOW WITH A BRIGHTNESS WAVE ACROSS IT, ONE HSV CONVERSION PER
+// PIXEL. HEAVY ENOUGH PER PIXEL TO BE WORTH SPREADING OVER CORES
+////////////////////////////////////////////////////////////////////////////////
+static void rainbow(const color_render_span_t &span) {
+	const uint16_t hue = (uint16_t)(span.frame * 256 + span.strip * 1024);
+
+	for (size_t i=0; i<span.count; i++) {
+		const size_t	x	= span.offset + i;
+		const uint8_t	val	= (uint8_t)(128 + ((x * 5 + span.frame * 3) & 127));
+		span.pixels[i] = color_t::from_hsv((uint16_t)(hue + x * 64), 255, val);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ONE CASE PER THREAD COUNT, ALL RENDERING THE SAME INSTALLATION
+////////////////////////////////////////////////////////////////////////////////
+static void scaling(bench_t &bench, const char *name, size_t tile) {
+	const unsigned cores = _max(1u, std::thread::hardware_concurrency());
+
+	for (unsigned threads=1; ; threads=_min(threads * 2, cores)) {
+		color_render_t render(threads, tile);
+		for (int i=0; i<STRIPS; i++) render.add(pixels[i], LENGTH, rainbow);
+
+		char label[64];
+		snprintf(label, sizeof(label), "%s/threads_%u", name, threads);
+
+		uint32_t frame = 0;
+		bench.run(label, FRAME, [&]() {
+			render.render(frame++);
+			bench_clobber();
+		});
+
+		if (threads == cores) break;
+	}
+}
+
+
+
+
+int main(int argc, char **argv) {
+	bench_t bench("render", argc, argv);
+
+	bench.run("render/single_loop", FRAME, [&]() {
+		static uint32_t frame = 0;
+		for (int i=0; i<STRIPS; i++) {
+			const color_render_span_t span = {pixels[i], LENGTH, 0, (size_t)i, frame, 0};
+			rainbow(span);
+		}
+		frame++;
+		bench_clobber();
+	});
+
+	scaling(bench, "render/tile_2048", COLOR_RENDER_TILE);
+	scaling(bench, "render/tile_256", 256);
+
+	return 0;
+}
@@ -0,0 +1,157 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| HOST BENCHMARK FOR THE WS2812B SPI WAVEFORM ENCODERS.                        |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#include <Arduino.h>
+#include "color.h"
+#include "color_ws2812.h"
+#include "color_dither.h"
+#include "color_indexed.h"
+#include "bench.h"
+
+
+
+
+#define FRAME	10000
+
+
+
+
+static color_t	pixels[FRAME];
+static color_t	dithered[FRAME];
+static uint8_t	output[FRAME * sizeof(color_t) * 4 + 1024];
+
+
+
+
+int main(int argc, char **argv) {
+	bench_t bench("ws2812", argc, argv);
+
+	for (int i=0; i<FRAME; i++) {
+		pixels[i] = color_t::hue(i % 768);
+	}
+
+	const size_t	reset3	= color_ws2812_reset_bytes(COLOR_WS2812_3BIT_HZ);
+	const size_t	reset4	= color_ws2812_reset_bytes(COLOR_WS2812_4BIT_HZ);
+	const uint8_t	*in		= (const uint8_t*) pixels;
+
+
+	bench.run("encode3/scalar", FRAME, [&]() {
+		color_ws2812_encode3_scalar(in, sizeof(pixels), output);
+		bench_clobber();
+	});
+
+	bench.run("encode4/scalar", FRAME, [&]() {
+		color_ws2812_encode4_scalar(in, sizeof(pixels), output);
+		bench_clobber();
+	});
+
+	#if defined(__SSSE3__)
+	bench.run("encode3/ssse3", FRAME, [&]() {
+		color_ws2812_encode3_ssse3(in, sizeof(pixels), output);
+		bench_clobber();
+	});
+
+	bench.run("encode4/ssse3", FRAME, [&]() {
+		color_ws2812_encode4_ssse3(in, sizeof(pixels), output);
+		bench_clobber();
+	});
+	#endif
+
+	bench.run("encode3/frame", FRAME, [&]() {
+		color_ws2812_encode3(pixels, FRAME, output, reset3);
+		bench_clobber();
+	});
+
+	bench.run("encode4/frame", FRAME, [&]() {
+		color_ws2812_encode4(pixels, FRAME, output, reset4);
+		bench_clobber();
+	});
+
+	// TEMPORAL DITHERING, AS A SEPARATE PASS AND FUSED WITH THE ENCODER
+	static color_dither_buffer_t<FRAME> dither;
+	dither.brightness(40);
+
+	bench.run("dither/apply", FRAME, [&]() {
+		dither.apply(pixels, dithered);
+		bench_clobber();
+	});
+
+	bench.run("dither/two_pass3", FRAME, [&]() {
+		dither.apply(pixels, dithered);
+		color_ws2812_encode3(dithered, FRAME, output, reset3);
+		bench_clobber();
+	});
+
+	bench.run("dither/fused3", FRAME, [&]() {
+		dither.encode3(pixels, output, reset3);
+		bench_clobber();
+	});
+
+	bench.run("dither/fused4", FRAME, [&]() {
+		dither.encode4(pixels, output, reset4);
+		bench_clobber();
+	});
+
+	// INDEXED FRAMES, LOOKED UP IN THE PALETTE AS THEY ARE ENCODED
+	static color_indexed_framebuffer_t<FRAME, 4> indexed4;
+	static color_indexed_framebuffer_t<FRAME, 8> indexed8;
+	static color_t ramp[256];
+
+	for (int i=0; i<FRAME; i++) {
+		indexed4.set(i, (i >> 4) & 15);
+		indexed8.set(i, i & 255);
+	}
+
+	for (int i=0; i<256; i++) {
+		ramp[i] = color_t::hue(i * 3);
+	}
+	indexed8.load(ramp, 256);
+
+	bench.run("indexed4/expand", FRAME, [&]() {
+		indexed4.expand(dithered, 0, FRAME);
+		bench_clobber();
+	});
+
+	bench.run("indexed8/expand", FRAME, [&]() {
+		indexed8.expand(dithered, 0, FRAME);
+		bench_clobber();
+	});
+
+	bench.run("indexed4/encode3", FRAME, [&]() {
+		indexed4.encode3(output, reset3);
+		bench_clobber();
+	});
+
+	bench.run("indexed8/encode3", FRAME, [&]() {
+		indexed8.encode3(output, reset3);
+		bench_clobber();
+	});
+
+	bench.run("indexed4/encode4", FRAME, [&]() {
+		indexed4.encode4(output, reset4);
+		bench_clobber();
+	});
+
+	// A WHOLE FRAME OF COLOR CYCLING, AGAINST REWRITING EVERY PIXEL
+	bench.run("indexed8/cycle", 256, [&]() {
+		indexed8.cycle(1);
+		bench_clobber();
+	});
+
+	bench.run("indexed8/rewrite", FRAME, [&]() {
+		for (int i=0; i<FRAME; i++) {
+			pixels[i] = ramp[(i + 1) & 255];
+		}
+		bench_clobber();
+	});
+
+	return 0;
+}
@@ -0,0 +1,582 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| 16 BIT PER CHANNEL WORKING COLOR FOR LAYERED BLENDING. EVERY 8 BIT COLOR_T   |
+| BLEND TRUNCATES, SO A CHAIN OF THEM DRIFTS DARKER WITH EACH LAYER (255 * 255 |
+| IS 254 ON COLOR_T). COLOR16_T KEEPS 0 TO 65535 PER CHANNEL, ITS BLENDS ARE   |
+| ROUNDED AND SATURATING (65535 * 65535 IS 65535), AND A FRAME IS QUANTIZED    |
+| DOWN TO COLOR_T ONCE AT THE END, EITHER ROUNDED OR WITH ORDERED DITHERING.   |
+| SPAN FUNCTIONS WORK ON WHOLE BUFFERS, USING AVX2 OR SSE2 WHEN AVAILABLE.     |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color16_h__
+#define __color16_h__
+
+
+
+
+#include "color.h"
+
+
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define COLOR16_AVX2	1
+#define COLOR16_SSE2	1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define COLOR16_SSE2	1
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// A * B / 65535, ROUNDED TO NEAREST, FOR ANY TWO 16 BIT VALUES
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint16_t color16_mul(const uint16_t a, const uint16_t b) {
+	const uint32_t t = (uint32_t)a * b + 32768;
+	return (t + (t >> 16)) >> 16;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// 16 BIT CHANNEL DOWN TO 8 BITS. THE VALUE IS FIRST SCALED TO 0 - 65280
+// (255 * 256), SO THE LOW BYTE IS THE FRACTION AND THRESHOLD (0 - 255) DECIDES
+// WHERE IT ROUNDS UP. 128 ROUNDS TO NEAREST. THE SCALE IS VALUE * 256 / 257,
+// WHICH VALUE * 65281 >> 16 GIVES EXACTLY FOR EVERY 16 BIT VALUE
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint8_t color16_narrow(const uint16_t value, const uint8_t threshold=128) {
+	return ((((uint32_t)value * 65281) >> 16) + threshold) >> 8;
+}
+
+
+
+
+struct color16_t {
+
+	////////////////////////////////////////////////////////////////////////////
+	// SAME G-R-B ORDER AS COLOR_T, SO SPANS LINE UP CHANNEL FOR CHANNEL
+	////////////////////////////////////////////////////////////////////////////
+	uint16_t g;
+	uint16_t r;
+	uint16_t b;
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// DEFAULT CONSTRUCTOR - ALL ZEROS (BLACK)
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t() {
+		this->g = 0;
+		this->r = 0;
+		this->b = 0;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// COLOR FROM 16 BIT R-G-B VALUES
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t(const uint16_t r, const uint16_t g, const uint16_t b) {
+		this->g = g;
+		this->r = r;
+		this->b = b;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// EXACT WIDENING FROM COLOR_T: 255 BECOMES 65535
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t(const color_t color) {
+		this->g = (uint16_t)color.g * 257;
+		this->r = (uint16_t)color.r * 257;
+		this->b = (uint16_t)color.b * 257;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ROUNDED NARROWING BACK TO COLOR_T
+	////////////////////////////////////////////////////////////////////////////
+	INLINE operator color_t() const {
+		return color_t(
+			color16_narrow(this->r),
+			color16_narrow(this->g),
+			color16_narrow(this->b)
+		);
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// SET TO MINIMUM OF TWO VALUES
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t min(const uint16_t value) {
+		return this->min(color16_t(value, value, value));
+	}
+
+	INLINE color16_t min(const color16_t color) {
+		this->g = _min(color.g, this->g);
+		this->r = _min(color.r, this->r);
+		this->b = _min(color.b, this->b);
+		return *this;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// SET TO MAXIMUM OF TWO VALUES
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t max(const uint16_t value) {
+		return this->max(color16_t(value, value, value));
+	}
+
+	INLINE color16_t max(const color16_t color) {
+		this->g = _max(color.g, this->g);
+		this->r = _max(color.r, this->r);
+		this->b = _max(color.b, this->b);
+		return *this;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INCREASE VALUE, SATURATING AT 65535
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t add(const uint16_t value) {
+		return this->add(color16_t(value, value, value));
+	}
+
+	INLINE color16_t add(const color16_t color) {
+		this->g = _min(65535ul, (uint32_t)this->g + color.g);
+		this->r = _min(65535ul, (uint32_t)this->r + color.r);
+		this->b = _min(65535ul, (uint32_t)this->b + color.b);
+		return *this;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// DECREASE VALUE, SATURATING AT 0
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t sub(const uint16_t value) {
+		return this->sub(color16_t(value, value, value));
+	}
+
+	INLINE color16_t sub(const color16_t color) {
+		this->g = (this->g > color.g) ? (this->g - color.g) : 0;
+		this->r = (this->r > color.r) ? (this->r - color.r) : 0;
+		this->b = (this->b > color.b) ? (this->b - color.b) : 0;
+		return *this;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// "SCREEN" BLEND WITH ANOTHER VALUE
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t screen(const uint16_t value) {
+		return this->screen(color16_t(value, value, value));
+	}
+
+	INLINE color16_t screen(const color16_t color) {
+		this->g = 65535 - color16_mul(65535 - color.g, 65535 - this->g);
+		this->r = 65535 - color16_mul(65535 - color.r, 65535 - this->r);
+		this->b = 65535 - color16_mul(65535 - color.b, 65535 - this->b);
+		return *this;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// "MULTIPLY" BLEND WITH ANOTHER VALUE
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color16_t multiply(const uint16_t value) {
+		return this->multiply(color16_t(value, value, value));
+	}
+
+	INLINE color16_t multiply(const color16_t color) {
+		this->g = color16_mul(color.g, this->g);
+		this->r = color16_mul(color.r, this->r);
+		this->b = color16_mul(color.b, this->b);
+		return *this;
+	}
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// VECTOR TYPE AND LOAD/STORE WRAPPERS FOR THE BLEND SPANS
+////////////////////////////////////////////////////////////////////////////////
+#if defined(COLOR16_AVX2)
+typedef __m256i color16_vec_t;
+#define COLOR16_VEC_LANES			16
+#define COLOR16_LOAD(ptr)			_mm256_loadu_si256((const __m256i*)(ptr))
+#define COLOR16_STORE(ptr, vec)		_mm256_storeu_si256((__m256i*)(ptr), (vec))
+#define COLOR16_OP(name)			_mm256_##name
+#define COLOR16_BITS(name)			_mm256_##name##_si256
+
+#elif defined(COLOR16_SSE2)
+typedef __m128i color16_vec_t;
+#define COLOR16_VEC_LANES			8
+#define COLOR16_LOAD(ptr)			_mm_loadu_si128((const __m128i*)(ptr))
+#define COLOR16_STORE(ptr, vec)		_mm_storeu_si128((__m128i*)(ptr), (vec))
+#define COLOR16_OP(name)			_mm_##name
+#define COLOR16_BITS(name)			_mm_##name##_si128
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PER-CHANNEL BLEND OPERATIONS, MATCHING COLOR16_T EXACTLY. THE SSE2 AND AVX2
+// INSTRUCTIONS ONLY DIFFER BY NAME, SO COLOR16_OP() AND COLOR16_BITS() PICK
+// THE RIGHT ONE
+////////////////////////////////////////////////////////////////////////////////
+struct color16_op_add {
+	static INLINE uint16_t scalar(const uint16_t a, const uint16_t b) {
+		return _min(65535ul, (uint32_t)a + b);
+	}
+
+	#if defined(COLOR16_VEC_LANES)
+	static INLINE color16_vec_t vector(const color16_vec_t a, const color16_vec_t b) {
+		return COLOR16_OP(adds_epu16)(a, b);
+	}
+	#endif
+};
+
+
+
+struct color16_op_sub {
+	static INLINE uint16_t scalar(const uint16_t a, const uint16_t b) {
+		return (a > b) ? (a - b) : 0;
+	}
+
+	#if defined(COLOR16_VEC_LANES)
+	static INLINE color16_vec_t vector(const color16_vec_t a, const color16_vec_t b) {
+		return COLOR16_OP(subs_epu16)(a, b);
+	}
+	#endif
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NOTE:	SSE2 HAS NO UNSIGNED 16 BIT MIN OR MAX, BUT A SATURATING SUBTRACT
+//			GIVES THE SAME THING: MIN = A - (A - B), MAX = B + (A - B)
+////////////////////////////////////////////////////////////////////////////////
+struct color16_op_min {
+	static INLINE uint16_t scalar(const uint16_t a, const uint16_t b) {
+		return _min(a, b);
+	}
+
+	#if defined(COLOR16_VEC_LANES)
+	static INLINE color16_vec_t vector(const color16_vec_t a, const color16_vec_t b) {
+		return COLOR16_OP(sub_epi16)(a, COLOR16_OP(subs_epu16)(a, b));
+	}
+	#endif
+};
+
+
+
+struct color16_op_max {
+	static INLINE uint16_t scalar(const uint16_t a, const uint16_t b) {
+		return _max(a, b);
+	}
+
+	#if defined(COLOR16_VEC_LANES)
+	static INLINE color16_vec_t vector(const color16_vec_t a, const color16_vec_t b) {
+		return COLOR16_OP(add_epi16)(b, COLOR16_OP(subs_epu16)(a, b));
+	}
+	#endif
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NOTE:	THE FULL 32 BIT PRODUCT IS SPLIT ACROSS MULLO (LOW HALF) AND MULHI
+//			(HIGH HALF), AND THE ROUNDING OF COLOR16_MUL IS DONE WITH THE CARRY
+//			BETWEEN THE HALVES WORKED OUT BY HAND
+////////////////////////////////////////////////////////////////////////////////
+struct color16_op_multiply {
+	static INLINE uint16_t scalar(const uint16_t a, const uint16_t b) {
+		return color16_mul(a, b);
+	}
+
+	#if defined(COLOR16_VEC_LANES)
+	static INLINE color16_vec_t vector(const color16_vec_t a, const color16_vec_t b) {
+		const color16_vec_t top = COLOR16_OP(set1_epi16)((short)0x8000);
+
+		// T = A * B + 32768
+		const color16_vec_t	lo		= COLOR16_BITS(xor)(COLOR16_OP(mullo_epi16)(a, b), top);
+		const color16_vec_t	hi		= COLOR16_OP(add_epi16)(COLOR16_OP(mulhi_epu16)(a, b),
+									  COLOR16_OP(srli_epi16)(COLOR16_BITS(andnot)(lo, top), 15));
+
+		// (T + (T >> 16)) >> 16 IS THE HIGH HALF PLUS THE CARRY OUT OF LO + HI
+		const color16_vec_t	sum		= COLOR16_OP(add_epi16)(lo, hi);
+		const color16_vec_t	carry	= COLOR16_BITS(or)(COLOR16_BITS(and)(lo, hi),
+									  COLOR16_BITS(andnot)(sum, COLOR16_BITS(or)(lo, hi)));
+		return COLOR16_OP(add_epi16)(hi, COLOR16_OP(srli_epi16)(carry, 15));
+	}
+	#endif
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NOTE:	65535 - MUL(65535 - A, 65535 - B) IS EXACTLY A + B - MUL(A, B), AND
+//			THE SECOND FORM SKIPS THE INVERSIONS. GCC TURNS THOSE INTO AVX-512
+//			VPTERNLOG INSTRUCTIONS THAT CHAIN EACH LOOP TO THE LAST ONE
+////////////////////////////////////////////////////////////////////////////////
+struct color16_op_screen {
+	static INLINE uint16_t scalar(const uint16_t a, const uint16_t b) {
+		return 65535 - color16_mul(65535 - a, 65535 - b);
+	}
+
+	#if defined(COLOR16_VEC_LANES)
+	static INLINE color16_vec_t vector(const color16_vec_t a, const color16_vec_t b) {
+		return COLOR16_OP(sub_epi16)(COLOR16_OP(add_epi16)(a, b), color16_op_multiply::vector(a, b));
+	}
+	#endif
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// APPLY A BLEND OPERATION: DST[i] = OP(DST[i], SRC[i]), AS A FLAT ARRAY OF
+// 3*N CHANNELS
+////////////////////////////////////////////////////////////////////////////////
+template <class OP>
+inline void color16_span_apply(color16_t *dst, const color16_t *src, size_t count) {
+	uint16_t		*d			= (uint16_t*) dst;
+	const uint16_t	*s			= (const uint16_t*) src;
+	const size_t	channels	= count * 3;
+	size_t			i			= 0;
+
+	#if defined(COLOR16_VEC_LANES)
+	for (; i < channels - channels % COLOR16_VEC_LANES; i += COLOR16_VEC_LANES) {
+		COLOR16_STORE(d + i, OP::vector(COLOR16_LOAD(d + i), COLOR16_LOAD(s + i)));
+	}
+	#endif
+
+	for (; i < channels; i++) {
+		d[i] = OP::scalar(d[i], s[i]);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// APPLY A BLEND OPERATION: DST[i] = OP(DST[i], VALUE). A WHOLE NUMBER OF
+// PIXELS FILLS EXACTLY THREE VECTORS, SO THE VALUE IS REPEATED ACROSS THREE
+////////////////////////////////////////////////////////////////////////////////
+template <class OP>
+inline void color16_span_apply(color16_t *dst, const color16_t value, size_t count) {
+	size_t i = 0;
+
+	#if defined(COLOR16_VEC_LANES)
+	color16_t pattern[COLOR16_VEC_LANES];
+	for (uint8_t p=0; p<COLOR16_VEC_LANES; p++) {
+		pattern[p] = value;
+	}
+
+	const uint16_t		*p	= (const uint16_t*) pattern;
+	const color16_vec_t	v0	= COLOR16_LOAD(p + 0 * COLOR16_VEC_LANES);
+	const color16_vec_t	v1	= COLOR16_LOAD(p + 1 * COLOR16_VEC_LANES);
+	const color16_vec_t	v2	= COLOR16_LOAD(p + 2 * COLOR16_VEC_LANES);
+
+	for (; i < count - count % COLOR16_VEC_LANES; i += COLOR16_VEC_LANES) {
+		uint16_t *d = (uint16_t*) (dst + i);
+		COLOR16_STORE(d + 0 * COLOR16_VEC_LANES, OP::vector(COLOR16_LOAD(d + 0 * COLOR16_VEC_LANES), v0));
+		COLOR16_STORE(d + 1 * COLOR16_VEC_LANES, OP::vector(COLOR16_LOAD(d + 1 * COLOR16_VEC_LANES), v1));
+		COLOR16_STORE(d + 2 * COLOR16_VEC_LANES, OP::vector(COLOR16_LOAD(d + 2 * COLOR16_VEC_LANES), v2));
+	}
+	#endif
+
+	for (; i < count; i++) {
+		dst[i].g = OP::scalar(dst[i].g, value.g);
+		dst[i].r = OP::scalar(dst[i].r, value.r);
+		dst[i].b = OP::scalar(dst[i].b, value.b);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SPAN VERSIONS OF EACH COLOR16_T BLEND
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color16_span_add(color16_t *dst, const color16_t *src, size_t count) {
+	color16_span_apply<color16_op_add>(dst, src, count);
+}
+
+INLINE void color16_span_add(color16_t *dst, const color16_t value, size_t count) {
+	color16_span_apply<color16_op_add>(dst, value, count);
+}
+
+INLINE void color16_span_sub(color16_t *dst, const color16_t *src, size_t count) {
+	color16_span_apply<color16_op_sub>(dst, src, count);
+}
+
+INLINE void color16_span_sub(color16_t *dst, const color16_t value, size_t count) {
+	color16_span_apply<color16_op_sub>(dst, value, count);
+}
+
+INLINE void color16_span_screen(color16_t *dst, const color16_t *src, size_t count) {
+	color16_span_apply<color16_op_screen>(dst, src, count);
+}
+
+INLINE void color16_span_screen(color16_t *dst, const color16_t value, size_t count) {
+	color16_span_apply<color16_op_screen>(dst, value, count);
+}
+
+INLINE void color16_span_multiply(color16_t *dst, const color16_t *src, size_t count) {
+	color16_span_apply<color16_op_multiply>(dst, src, count);
+}
+
+INLINE void color16_span_multiply(color16_t *dst, const color16_t value, size_t count) {
+	color16_span_apply<color16_op_multiply>(dst, value, count);
+}
+
+INLINE void color16_span_min(color16_t *dst, const color16_t *src, size_t count) {
+	color16_span_apply<color16_op_min>(dst, src, count);
+}
+
+INLINE void color16_span_min(color16_t *dst, const color16_t value, size_t count) {
+	color16_span_apply<color16_op_min>(dst, value, count);
+}
+
+INLINE void color16_span_max(color16_t *dst, const color16_t *src, size_t count) {
+	color16_span_apply<color16_op_max>(dst, src, count);
+}
+
+INLINE void color16_span_max(color16_t *dst, const color16_t value, size_t count) {
+	color16_span_apply<color16_op_max>(dst, value, count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// WIDEN A BUFFER OF COLOR_T TO COLOR16_T. X * 257 IS THE BYTE REPEATED TWICE,
+// SO ON SSE2 IT IS JUST AN UNPACK OF EACH VECTOR WITH ITSELF
+////////////////////////////////////////////////////////////////////////////////
+inline void color16_expand(const color_t *src, color16_t *dst, size_t count) {
+	const uint8_t	*s		= (const uint8_t*) src;
+	uint16_t		*d		= (uint16_t*) dst;
+	const size_t	bytes	= count * sizeof(color_t);
+	size_t			i		= 0;
+
+	#if defined(COLOR16_SSE2)
+	for (; i < bytes - bytes % 16; i += 16) {
+		const __m128i value = _mm_loadu_si128((const __m128i*)(s + i));
+		_mm_storeu_si128((__m128i*)(d + i) + 0, _mm_unpacklo_epi8(value, value));
+		_mm_storeu_si128((__m128i*)(d + i) + 1, _mm_unpackhi_epi8(value, value));
+	}
+	#endif
+
+	for (; i < bytes; i++) {
+		d[i] = (uint16_t)s[i] * 257;
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NARROW A BUFFER OF COLOR16_T TO COLOR_T, WITH A THRESHOLD FOR EACH OF THE
+// 48 CHANNELS IN A BLOCK OF 16 PIXELS (SEE COLOR16_NARROW)
+////////////////////////////////////////////////////////////////////////////////
+inline void color16_narrow(const color16_t *src, color_t *dst, size_t count, const uint8_t *threshold) {
+	const uint16_t	*s			= (const uint16_t*) src;
+	uint8_t			*d			= (uint8_t*) dst;
+	const size_t	channels	= count * 3;
+	size_t			i			= 0;
+
+	#if defined(COLOR16_SSE2)
+	const __m128i scale = _mm_set1_epi16((short)65281);
+
+	__m128i add[6];
+	for (uint8_t v=0; v<6; v++) {
+		uint16_t lanes[8];
+		for (uint8_t j=0; j<8; j++) lanes[j] = threshold[v * 8 + j];
+		add[v] = _mm_loadu_si128((const __m128i*)lanes);
+	}
+
+	for (; i < channels - channels % 48; i += 48) {
+		for (uint8_t v=0; v<6; v+=2) {
+			__m128i lo = _mm_loadu_si128((const __m128i*)(s + i + v * 8) + 0);
+			__m128i hi = _mm_loadu_si128((const __m128i*)(s + i + v * 8) + 1);
+			lo = _mm_srli_epi16(_mm_add_epi16(_mm_mulhi_epu16(lo, scale), add[v + 0]), 8);
+			hi = _mm_srli_epi16(_mm_add_epi16(_mm_mulhi_epu16(hi, scale), add[v + 1]), 8);
+			_mm_storeu_si128((__m128i*)(d + i + v * 8), _mm_packus_epi16(lo, hi));
+		}
+	}
+	#endif
+
+	for (; i < channels; i++) {
+		d[i] = color16_narrow(s[i], threshold[i % 48]);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NARROW A BUFFER OF COLOR16_T TO COLOR_T, ROUNDED TO NEAREST
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color16_reduce(const color16_t *src, color_t *dst, size_t count) {
+	uint8_t threshold[48];
+	memset(threshold, 128, sizeof(threshold));
+	color16_narrow(src, dst, count, threshold);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NARROW A BUFFER OF COLOR16_T TO COLOR_T WITH ORDERED DITHERING. EACH PIXEL
+// OF A 16 PIXEL RUN ROUNDS UP AT A DIFFERENT POINT, SO THE BITS BELOW 8 SHOW
+// UP AS AN AVERAGE ACROSS NEIGHBORS. THE CHANNELS ARE OFFSET FROM EACH OTHER,
+// AND CHANGING FRAME EACH FRAME SPREADS THE PATTERN OVER TIME AS WELL
+////////////////////////////////////////////////////////////////////////////////
+inline void color16_dither(const color16_t *src, color_t *dst, size_t count, uint8_t frame=0) {
+	// 4 BIT REVERSAL, SO NEIGHBORING PIXELS ARE FAR APART IN THE PATTERN
+	static const uint8_t order[16] = {0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15};
+
+	uint8_t threshold[48];
+	for (uint8_t p=0; p<16; p++) {
+		for (uint8_t c=0; c<3; c++) {
+			threshold[p * 3 + c] = order[(p + c * 5 + frame * 7) & 15] * 16 + 8;
+		}
+	}
+
+	color16_narrow(src, dst, count, threshold);
+}
+
+
+
+
+#endif //__color16_h__
@@ -0,0 +1,656 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| COMPRESSED ANIMATION FILES FOR PRE-RENDERED SHOWS. EVERY FRAME IS A STREAM   |
+| OF RUNS: PIXELS UNCHANGED SINCE THE LAST FRAME, A SOLID COLOR, THE SAME      |
+| PER-CHANNEL DELTA FROM THE LAST FRAME (A FADE), OR LITERAL PIXELS. EVERY     |
+| FEW FRAMES IS A KEYFRAME THAT STANDS ON ITS OWN, AND A SEEK INDEX AT THE END |
+| OF THE FILE GIVES RANDOM ACCESS. SHOWS WITH FEW ENOUGH COLORS CAN STORE ONE  |
+| PALETTE INDEX BYTE PER PIXEL INSTEAD OF THREE COLOR BYTES.                   |
+|                                                                              |
+| THE ENCODER AND DECODER WORK ON MEMORY AND RUN ANYWHERE. THE FILE WRITER AND |
+| THE MEMORY MAPPED READER ARE FOR HOSTS ONLY.                                 |
++------------------------------------------------------------------------------+
+| FILE LAYOUT, ALL INTEGERS LITTLE ENDIAN:                                     |
+|   HEADER    COLOR_ANIM_HEADER_T, 32 BYTES                                    |
+|   PALETTE   COLORS x COLOR_T, ONLY IN PALETTE MODE                           |
+|   FRAMES    TYPE (1 BYTE), PAYLOAD LENGTH (4 BYTES), PAYLOAD                 |
+|   INDEX     FRAMES x 64-BIT FILE OFFSET OF EACH FRAME, 8 BYTE ALIGNED        |
+| A PAYLOAD IS A SEQUENCE OF RUNS. EACH RUN STARTS WITH A VARINT (7 BITS PER   |
+| BYTE, LOW FIRST) HOLDING (LENGTH - 1) << 2 | OP, FOLLOWED BY ITS DATA:        |
+|   SKIP      NOTHING, THE PIXELS ARE KEPT FROM THE LAST FRAME                 |
+|   LITERAL   LENGTH PIXELS                                                    |
+|   FILL      ONE PIXEL, REPEATED LENGTH TIMES                                 |
+|   DELTA     ONE PIXEL, ADDED (MODULO 256) TO EACH OF THE LAST FRAME'S PIXELS |
+| A PIXEL IS A COLOR_T, OR A PALETTE INDEX BYTE IN PALETTE MODE. KEYFRAMES     |
+| NEVER USE SKIP OR DELTA, AND PALETTE MODE NEVER USES DELTA.                  |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_anim_h__
+#define __color_anim_h__
+
+
+
+
+#include <stddef.h>
+#include <string.h>
+#include "color.h"
+
+
+
+
+#define COLOR_ANIM_MAGIC		0x4d4e4143ul	// "CANM"
+#define COLOR_ANIM_VERSION		1
+
+#ifndef COLOR_ANIM_KEYFRAMES
+#define COLOR_ANIM_KEYFRAMES	60				// DEFAULT FRAMES PER KEYFRAME
+#endif
+
+
+
+
+enum COLOR_ANIM_FRAME {
+	COLOR_ANIM_KEY		= 1,
+	COLOR_ANIM_DIFF		= 2,
+};
+
+
+
+enum COLOR_ANIM_OP {
+	COLOR_ANIM_SKIP,
+	COLOR_ANIM_LITERAL,
+	COLOR_ANIM_FILL,
+	COLOR_ANIM_DELTA,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FILE HEADER. FRAMES AND INDEX ARE FILLED IN WHEN THE WRITER IS CLOSED
+////////////////////////////////////////////////////////////////////////////////
+struct PACKED color_anim_header_t {
+	uint32_t	magic;
+	uint16_t	version;
+	uint16_t	colors;		// PALETTE ENTRIES, 0 FOR DIRECT COLOR
+	uint32_t	pixels;		// PIXELS PER FRAME
+	uint32_t	frames;
+	uint16_t	fps;
+	uint16_t	keyframes;	// FRAMES PER KEYFRAME
+	uint64_t	index;		// FILE OFFSET OF THE SEEK INDEX
+	uint32_t	reserved;
+};
+
+static_assert(sizeof(color_anim_header_t) == 32, "animation header must be 32 bytes");
+
+
+
+#define COLOR_ANIM_FRAME_HEADER	5
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// LARGEST POSSIBLE PAYLOAD FOR A FRAME, FOR SIZING ENCODER OUTPUT BUFFERS
+////////////////////////////////////////////////////////////////////////////////
+#define COLOR_ANIM_BOUND(pixels, size)	((size_t)(pixels) * ((size) + 1) + 16)
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RUN HEADERS
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint8_t *color_anim_put_run(uint8_t *out, uint8_t op, size_t length) {
+	size_t value = ((length - 1) << 2) | op;
+	while (value >= 0x80) {
+		*out++ = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	*out++ = (uint8_t)value;
+	return out;
+}
+
+
+
+INLINE bool color_anim_get_run(const uint8_t *&data, const uint8_t *end, uint8_t &op, size_t &length) {
+	size_t	value	= 0;
+	uint8_t	shift	= 0;
+
+	while (true) {
+		if (data >= end  ||  shift >= sizeof(size_t) * 8) return false;
+		const uint8_t byte = *data++;
+		value |= (size_t)(byte & 0x7f) << shift;
+		if (!(byte & 0x80)) break;
+		shift += 7;
+	}
+
+	op		= value & 3;
+	length	= (value >> 2) + 1;
+	return true;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ENCODE ONE FRAME OF SIZE BYTE PIXELS (3 FOR COLOR_T, 1 FOR PALETTE INDEXES).
+// WITHOUT A PREVIOUS FRAME THE RESULT IS A KEYFRAME. OUT MUST HOLD AT LEAST
+// COLOR_ANIM_BOUND(COUNT, SIZE) BYTES. RETURNS THE PAYLOAD LENGTH
+////////////////////////////////////////////////////////////////////////////////
+template <uint8_t SIZE>
+inline size_t color_anim_encode(const uint8_t *cur, const uint8_t *prev, size_t count, uint8_t *out) {
+	// A RUN SHORTER THAN THIS COSTS MORE THAN LEAVING IT IN A LITERAL
+	const size_t	shortest	= (SIZE == 1) ? 3 : 2;
+	uint8_t			*start		= out;
+	size_t			literal		= 0;
+	size_t			i			= 0;
+
+	#define PIXEL_EQ(a, b)	(!memcmp((a), (b), SIZE))
+
+	while (i < count) {
+		const uint8_t	*pixel	= cur + i * SIZE;
+		uint8_t			op		= COLOR_ANIM_FILL;
+		size_t			length	= 1;
+
+		while (i + length < count  &&  PIXEL_EQ(pixel + length * SIZE, pixel)) length++;
+
+		if (prev) {
+			// UNCHANGED PIXELS ARE A DELTA OF ZERO, AND CARRY NO DATA
+			uint8_t delta[3] = {0, 0, 0};
+			for (uint8_t c=0; c<SIZE; c++) delta[c] = pixel[c] - prev[i * SIZE + c];
+
+			const bool	skip	= !delta[0]  &&  !delta[1]  &&  !delta[2];
+			size_t		run		= 1;
+
+			if (skip  ||  SIZE == 3) {
+				for (; i + run < count; run++) {
+					const uint8_t *a = cur + (i + run) * SIZE;
+					const uint8_t *b = prev + (i + run) * SIZE;
+					uint8_t c = 0;
+					while (c < SIZE  &&  (uint8_t)(a[c] - b[c]) == delta[c]) c++;
+					if (c < SIZE) break;
+				}
+
+				if (skip ? run >= length : run > length) {
+					op		= skip ? COLOR_ANIM_SKIP : COLOR_ANIM_DELTA;
+					length	= run;
+				}
+			}
+		}
+
+		if (length < shortest) {
+			literal++;
+			i++;
+			continue;
+		}
+
+		if (literal) {
+			out = color_anim_put_run(out, COLOR_ANIM_LITERAL, literal);
+			memcpy(out, cur + (i - literal) * SIZE, literal * SIZE);
+			out += literal * SIZE;
+			literal = 0;
+		}
+
+		out = color_anim_put_run(out, op, length);
+		if (op == COLOR_ANIM_FILL) {
+			memcpy(out, pixel, SIZE);
+			out += SIZE;
+		} else if (op == COLOR_ANIM_DELTA) {
+			for (uint8_t c=0; c<SIZE; c++) *out++ = pixel[c] - prev[i * SIZE + c];
+		}
+
+		i += length;
+	}
+
+	#undef PIXEL_EQ
+
+	if (literal) {
+		out = color_anim_put_run(out, COLOR_ANIM_LITERAL, literal);
+		memcpy(out, cur + (count - literal) * SIZE, literal * SIZE);
+		out += literal * SIZE;
+	}
+
+	return out - start;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DECODE ONE FRAME PAYLOAD STRAIGHT INTO A PIXEL BUFFER. FOR A DIFF FRAME THE
+// BUFFER MUST HOLD THE FRAME BEFORE IT. WITH A PALETTE THE PAYLOAD HOLDS INDEX
+// BYTES. RETURNS FALSE ON A DAMAGED PAYLOAD, WITH THE BUFFER PARTLY WRITTEN
+////////////////////////////////////////////////////////////////////////////////
+inline bool color_anim_decode(const uint8_t *data, size_t length, bool key, color_t *dst, size_t count, const color_t *palette=nullptr, uint16_t colors=0) {
+	const uint8_t	*end	= data + length;
+	const uint8_t	size	= palette ? 1 : 3;
+	size_t			i		= 0;
+
+	while (data < end) {
+		uint8_t	op;
+		size_t	run;
+		if (!color_anim_get_run(data, end, op, run)  ||  run > count - i) return false;
+
+		switch (op) {
+			case COLOR_ANIM_SKIP:
+				if (key) return false;
+				break;
+
+
+			case COLOR_ANIM_LITERAL:
+				if ((size_t)(end - data) < run * size) return false;
+				if (palette) {
+					for (size_t j=0; j<run; j++) {
+						if (data[j] >= colors) return false;
+						dst[i + j] = palette[data[j]];
+					}
+				} else {
+					memcpy((void*)(dst + i), data, run * sizeof(color_t));
+				}
+				data += run * size;
+				break;
+
+
+			case COLOR_ANIM_FILL: {
+				if ((size_t)(end - data) < size) return false;
+
+				color_t color;
+				if (palette) {
+					if (*data >= colors) return false;
+					color = palette[*data];
+				} else {
+					memcpy((void*)&color, data, sizeof(color_t));
+				}
+
+				for (size_t j=0; j<run; j++) dst[i + j] = color;
+				data += size;
+				break;
+			}
+
+
+			case COLOR_ANIM_DELTA: {
+				if (key  ||  palette  ||  (size_t)(end - data) < 3) return false;
+
+				uint8_t *pixel = (uint8_t*)(dst + i);
+				for (size_t j=0; j<run * 3; j+=3) {
+					pixel[j + 0] += data[0];
+					pixel[j + 1] += data[1];
+					pixel[j + 2] += data[2];
+				}
+				data += 3;
+				break;
+			}
+		}
+
+		i += run;
+	}
+
+	return i == count;
+}
+
+
+
+
+#if !defined(ARDUINO)
+////////////////////////////////////////////////////////////////////////////////
+// HOST ONLY FROM HERE ON: STDIO FILE WRITING AND MMAP READING
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <vector>
+#include "color_nearest.h"
+
+
+
+
+class color_anim_writer_t {
+	public:
+		color_anim_writer_t() {
+			this->file = nullptr;
+		}
+
+		~color_anim_writer_t() {
+			this->close();
+		}
+
+		color_anim_writer_t(const color_anim_writer_t&) = delete;
+		color_anim_writer_t &operator=(const color_anim_writer_t&) = delete;
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// START A NEW FILE. WITH A PALETTE (UP TO 256 COLORS), EVERY PIXEL IS
+		// STORED AS THE INDEX OF ITS CLOSEST PALETTE ENTRY
+		////////////////////////////////////////////////////////////////////////
+		bool open(const char *path, uint32_t pixels, uint16_t fps, uint16_t keyframes=COLOR_ANIM_KEYFRAMES, const color_t *palette=nullptr, uint16_t colors=0) {
+			this->close();
+			if (!pixels  ||  colors > 256  ||  (palette  &&  !colors)) return false;
+
+			this->file = fopen(path, "wb");
+			if (!this->file) return false;
+
+			memset(&this->header, 0, sizeof(this->header));
+			this->header.magic		= COLOR_ANIM_MAGIC;
+			this->header.version	= COLOR_ANIM_VERSION;
+			this->header.colors		= palette ? colors : 0;
+			this->header.pixels		= pixels;
+			this->header.fps		= fps;
+			this->header.keyframes	= _max(keyframes, 1);
+
+			this->palette.assign(palette, palette + this->header.colors);
+			this->failed = false;
+			this->offset = 0;
+			this->index.clear();
+			this->put(&this->header, sizeof(this->header));
+			if (palette) this->put(palette, this->header.colors * sizeof(color_t));
+
+			const uint8_t size = this->unit();
+			this->current.assign(pixels * size, 0);
+			this->previous.assign(pixels * size, 0);
+			this->encoded.resize(COLOR_ANIM_BOUND(pixels, size));
+			this->fallback.resize(COLOR_ANIM_BOUND(pixels, size));
+
+			return !this->failed;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// APPEND A FRAME. A DIFF FRAME THAT WOULD COME OUT LARGER THAN A
+		// KEYFRAME IS STORED AS A KEYFRAME INSTEAD
+		////////////////////////////////////////////////////////////////////////
+		bool write(const color_t *pixels) {
+			if (!this->file) return false;
+
+			const uint32_t count = this->header.pixels;
+			if (this->palette.empty()) {
+				memcpy(this->current.data(), (const void*)pixels, count * sizeof(color_t));
+			} else {
+				color_nearest_quantize(pixels, count, this->current.data(), this->palette.data(), this->header.colors);
+			}
+
+			uint8_t type	= COLOR_ANIM_KEY;
+			size_t	length	= this->encode(this->current.data(), nullptr, this->encoded.data());
+
+			if (this->header.frames % this->header.keyframes) {
+				const size_t diff = this->encode(this->current.data(), this->previous.data(), this->fallback.data());
+				if (diff < length) {
+					this->encoded.swap(this->fallback);
+					type	= COLOR_ANIM_DIFF;
+					length	= diff;
+				}
+			}
+
+			const uint32_t payload = (uint32_t)length;
+			this->index.push_back(this->offset);
+			this->put(&type, 1);
+			this->put(&payload, 4);
+			this->put(this->encoded.data(), length);
+
+			this->current.swap(this->previous);
+			this->header.frames++;
+			return !this->failed;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// WRITE THE SEEK INDEX, FILL IN THE HEADER, AND CLOSE THE FILE
+		////////////////////////////////////////////////////////////////////////
+		bool close() {
+			if (!this->file) return false;
+
+			static const uint8_t padding[8] = {0};
+			this->put(padding, (8 - this->offset % 8) % 8);
+
+			this->header.index = this->offset;
+			this->put(this->index.data(), this->index.size() * sizeof(uint64_t));
+
+			if (fseek(this->file, 0, SEEK_SET)) this->failed = true;
+			this->put(&this->header, sizeof(this->header));
+
+			if (fclose(this->file)) this->failed = true;
+			this->file = nullptr;
+			return !this->failed;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FRAMES WRITTEN, AND BYTES WRITTEN SO FAR
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint32_t frames() const {
+			return this->header.frames;
+		}
+
+		INLINE uint64_t size() const {
+			return this->offset;
+		}
+
+
+
+
+	private:
+		INLINE uint8_t unit() const {
+			return this->header.colors ? 1 : 3;
+		}
+
+		INLINE size_t encode(const uint8_t *cur, const uint8_t *prev, uint8_t *out) const {
+			return this->header.colors
+				? color_anim_encode<1>(cur, prev, this->header.pixels, out)
+				: color_anim_encode<3>(cur, prev, this->header.pixels, out);
+		}
+
+		INLINE void put(const void *data, size_t length) {
+			if (length  &&  fwrite(data, 1, length, this->file) != length) this->failed = true;
+			this->offset += length;
+		}
+
+
+
+		FILE					*file;
+		color_anim_header_t		header;
+		std::vector<color_t>	palette;
+		std::vector<uint64_t>	index;
+		std::vector<uint8_t>	current;
+		std::vector<uint8_t>	previous;
+		std::vector<uint8_t>	encoded;
+		std::vector<uint8_t>	fallback;
+		uint64_t				offset;
+		bool					failed;
+};
+
+
+
+
+class color_anim_reader_t {
+	public:
+		color_anim_reader_t() {
+			this->map		= nullptr;
+			this->length	= 0;
+		}
+
+		~color_anim_reader_t() {
+			this->close();
+		}
+
+		color_anim_reader_t(const color_anim_reader_t&) = delete;
+		color_anim_reader_t &operator=(const color_anim_reader_t&) = delete;
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// MAP A FILE, AND CHECK ITS HEADER AND SEEK INDEX. FRAMES ARE DECODED
+		// STRAIGHT OUT OF THE MAPPING, WITHOUT COPYING THE FILE ANYWHERE
+		////////////////////////////////////////////////////////////////////////
+		bool open(const char *path) {
+			this->close();
+
+			const int fd = ::open(path, O_RDONLY);
+			if (fd < 0) return false;
+
+			struct stat info;
+			if (fstat(fd, &info)  ||  (size_t)info.st_size < sizeof(color_anim_header_t)) {
+				::close(fd);
+				return false;
+			}
+
+			void *map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			::close(fd);
+			if (map == MAP_FAILED) return false;
+
+			this->map		= (const uint8_t*)map;
+			this->length	= info.st_size;
+			madvise(map, this->length, MADV_SEQUENTIAL);
+
+			memcpy(&this->header, this->map, sizeof(this->header));
+			const uint64_t table = (uint64_t)this->header.frames * sizeof(uint64_t);
+
+			if (this->header.magic != COLOR_ANIM_MAGIC
+			||  this->header.version != COLOR_ANIM_VERSION
+			||  this->header.colors > 256
+			||  !this->header.keyframes
+			||  sizeof(this->header) + this->header.colors * sizeof(color_t) > this->length
+			||  this->header.index > this->length
+			||  table > this->length - this->header.index) {
+				this->close();
+				return false;
+			}
+
+			this->position	= 0xffffffff;
+			this->target	= nullptr;
+			return true;
+		}
+
+
+
+		void close() {
+			if (this->map) munmap((void*)this->map, this->length);
+			this->map		= nullptr;
+			this->length	= 0;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FILE INFORMATION
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint32_t frames() const		{ return this->header.frames; }
+		INLINE uint32_t pixels() const		{ return this->header.pixels; }
+		INLINE uint16_t fps() const			{ return this->header.fps; }
+		INLINE uint16_t colors() const		{ return this->header.colors; }
+
+		INLINE const color_t *palette() const {
+			return this->header.colors ? (const color_t*)(this->map + sizeof(this->header)) : nullptr;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DECODE ANY FRAME INTO A BUFFER OF PIXELS() COLORS. PLAYING FORWARD
+		// INTO THE SAME BUFFER DECODES ONE FRAME AT A TIME. ANYTHING ELSE
+		// STARTS FROM THE CLOSEST KEYFRAME AT OR BEFORE THE FRAME
+		////////////////////////////////////////////////////////////////////////
+		bool decode(uint32_t frame, color_t *dst) {
+			if (!this->map  ||  frame >= this->header.frames) return false;
+
+			uint32_t from = frame;
+			if (!(dst == this->target  &&  frame == this->position + 1)) {
+				from = this->keyframe(frame);
+			}
+
+			this->target = nullptr;
+			for (uint32_t i=from; i<=frame; i++) {
+				if (!this->decode_one(i, dst)) return false;
+			}
+
+			this->target	= dst;
+			this->position	= frame;
+			return true;
+		}
+
+
+
+		INLINE bool next(color_t *dst) {
+			return this->decode(this->target == dst ? this->position + 1 : 0, dst);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CLOSEST KEYFRAME AT OR BEFORE A FRAME
+		////////////////////////////////////////////////////////////////////////
+		uint32_t keyframe(uint32_t frame) const {
+			while (frame  &&  this->type(frame) != COLOR_ANIM_KEY) frame--;
+			return frame;
+		}
+
+
+
+
+	private:
+		INLINE uint64_t offset(uint32_t frame) const {
+			uint64_t value;
+			memcpy(&value, this->map + this->header.index + frame * sizeof(uint64_t), sizeof(value));
+			return value;
+		}
+
+		INLINE uint8_t type(uint32_t frame) const {
+			const uint64_t at = this->offset(frame);
+			return at < this->length ? this->map[at] : 0;
+		}
+
+
+
+		bool decode_one(uint32_t frame, color_t *dst) const {
+			const uint64_t at = this->offset(frame);
+			if (at > this->length  ||  this->length - at < COLOR_ANIM_FRAME_HEADER) return false;
+
+			uint32_t payload;
+			memcpy(&payload, this->map + at + 1, sizeof(payload));
+			if (payload > this->length - at - COLOR_ANIM_FRAME_HEADER) return false;
+
+			const uint8_t type = this->map[at];
+			if (type != COLOR_ANIM_KEY  &&  type != COLOR_ANIM_DIFF) return false;
+
+			return color_anim_decode(
+				this->map + at + COLOR_ANIM_FRAME_HEADER,
+				payload,
+				type == COLOR_ANIM_KEY,
+				dst,
+				this->header.pixels,
+				this->palette(),
+				this->header.colors
+			);
+		}
+
+
+
+		const uint8_t			*map;
+		size_t					length;
+		color_anim_header_t		header;
+		uint32_t				position;
+		color_t					*target;
+};
+#endif
+
+
+
+
+#endif //__color_anim_h__
@@ -0,0 +1,427 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| LAYERED EFFECT COMPOSITOR. A STACK OF FULL-LENGTH LAYERS IS BLENDED BOTTOM   |
+| TO TOP INTO A COLOR_STRIP_T, EACH WITH ITS OWN BLEND MODE AND OPACITY. THE   |
+| FRAME IS RENDERED ONE TILE AT A TIME WITH EVERY LAYER APPLIED TO THE TILE    |
+| BEFORE MOVING ON, SO THE OUTPUT STAYS IN CACHE INSTEAD OF BEING WALKED ONCE  |
+| PER LAYER. ONLY THE UNION OF THE LAYERS' DIRTY REGIONS IS RECOMPOSITED.      |
+|                                                                              |
+| EVERY LAYER KEEPS TIMING COUNTERS, AND A RUNNING COST ESTIMATE IS USED TO    |
+| SKIP OPTIONAL LAYERS FOR A FRAME WHEN THEY WOULD BLOW THE TIME BUDGET.       |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_compositor_h__
+#define __color_compositor_h__
+
+
+
+
+#include "color.h"
+#include "color_span.h"
+#include "color_strip.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MAXIMUM NUMBER OF LAYERS, AND PIXELS PER TILE. A HOST TILE IS 3KB, SO THE
+// OUTPUT TILE AND SCRATCH SPACE STAY IN L1 WHILE THE LAYERS STREAM PAST
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_COMPOSITOR_LAYERS
+#if defined(__AVR__)
+#define COLOR_COMPOSITOR_LAYERS		4
+#else
+#define COLOR_COMPOSITOR_LAYERS		16
+#endif
+#endif
+
+#ifndef COLOR_COMPOSITOR_TILE
+#if defined(__AVR__)
+#define COLOR_COMPOSITOR_TILE		32
+#else
+#define COLOR_COMPOSITOR_TILE		1024
+#endif
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CLOCK USED FOR THE TIMING COUNTERS, IN MICROSECONDS. EACH TILE IS TIMED
+// SEPARATELY, AND SINCE THE CLOCK IS READ CONTINUOUSLY THE ROUNDING OF EACH
+// SHORT INTERVAL AVERAGES OUT OVER A FRAME
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_COMPOSITOR_CLOCK
+#define COLOR_COMPOSITOR_CLOCK()	((uint32_t)micros())
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HOW A LAYER IS COMBINED WITH EVERYTHING BELOW IT
+////////////////////////////////////////////////////////////////////////////////
+enum COLOR_BLEND {
+	COLOR_BLEND_NORMAL,		// REPLACE
+	COLOR_BLEND_ADD,		// COLOR_T::ADD
+	COLOR_BLEND_SUB,		// COLOR_T::SUB
+	COLOR_BLEND_SCREEN,		// COLOR_T::SCREEN
+	COLOR_BLEND_MULTIPLY,	// COLOR_T::MULTIPLY
+	COLOR_BLEND_MIN,		// COLOR_T::MIN
+	COLOR_BLEND_MAX,		// COLOR_T::MAX
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ONE LAYER OF THE STACK. THE PIXELS ARE OWNED BY THE CALLER, AND ARE THE SAME
+// LENGTH AS THE OUTPUT STRIP
+////////////////////////////////////////////////////////////////////////////////
+struct color_layer_t {
+	const color_t	*pixels;
+	COLOR_BLEND		mode;
+	uint8_t			opacity;	// 0 TO 255, FADING THE BLENDED RESULT IN
+	bool			enabled;
+	bool			optional;	// MAY BE SKIPPED TO MAKE THE FRAME DEADLINE
+	color_range_t	dirty;		// PIXELS CHANGED SINCE THE LAST RENDER
+
+	// TIMING COUNTERS, IN MICROSECONDS
+	uint32_t		last;		// TIME SPENT IN THE LAST RENDERED FRAME
+	uint32_t		total;		// TIME SPENT OVER ALL FRAMES
+	uint32_t		cost;		// RUNNING AVERAGE PER 1024 PIXELS, x16
+	uint32_t		frames;		// FRAMES THIS LAYER WAS RENDERED IN
+	uint32_t		skipped;	// FRAMES THIS LAYER WAS SKIPPED FOR TIME
+};
+
+
+
+
+class color_compositor_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// RENDER INTO AN EXISTING STRIP. RENDERED PIXELS ARE MARKED DIRTY ON
+		// THE STRIP, SO ONLY THEY ARE RESENT TO THE LEDS
+		////////////////////////////////////////////////////////////////////////
+		color_compositor_t(color_strip_t &output, const color_t background=color_t())
+			: output(output), background(background) {
+			this->used = 0;
+			this->invalidate();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// NUMBER OF LAYERS IN THE STACK, AND ACCESS TO EACH ONE. LAYER 0 IS
+		// THE BOTTOM OF THE STACK. CALL INVALIDATE() AFTER CHANGING A LAYER
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint8_t layers() const {
+			return this->used;
+		}
+
+		INLINE color_layer_t &layer(uint8_t index) {
+			return this->stack[index];
+		}
+
+		INLINE const color_layer_t &layer(uint8_t index) const {
+			return this->stack[index];
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PUSH A NEW LAYER ON TOP OF THE STACK. RETURNS NULLPTR WHEN FULL
+		////////////////////////////////////////////////////////////////////////
+		color_layer_t *push(const color_t *pixels, COLOR_BLEND mode=COLOR_BLEND_NORMAL, uint8_t opacity=255, bool optional=false) {
+			if (this->used >= COLOR_COMPOSITOR_LAYERS) return nullptr;
+
+			color_layer_t *layer = &this->stack[this->used++];
+			memset((void*)layer, 0, sizeof(color_layer_t));
+			layer->pixels	= pixels;
+			layer->mode		= mode;
+			layer->opacity	= opacity;
+			layer->enabled	= true;
+			layer->optional	= optional;
+			layer->dirty.last	= this->output.size();
+			return layer;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// REMOVE A LAYER, MOVING EVERYTHING ABOVE IT DOWN ONE SLOT. THE
+		// PIXELS IT COVERED NEED TO BE RECOMPOSITED
+		////////////////////////////////////////////////////////////////////////
+		void remove(uint8_t index) {
+			if (index >= this->used) return;
+
+			this->used--;
+			for (uint8_t i=index; i<this->used; i++) {
+				this->stack[i] = this->stack[i+1];
+			}
+
+			this->invalidate();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// MARK PART OF A LAYER AS CHANGED, OR THE WHOLE FRAME (AFTER CHANGING
+		// A LAYER'S MODE, OPACITY, OR ENABLED FLAG, OR THE BACKGROUND)
+		////////////////////////////////////////////////////////////////////////
+		void mark(uint8_t index, size_t first, size_t length) {
+			if (index >= this->used  ||  first >= this->output.size()) return;
+
+			const size_t	last	= first + _min(length, this->output.size() - first);
+			color_range_t	&dirty	= this->stack[index].dirty;
+
+			if (dirty.size()) {
+				dirty.first	= _min(dirty.first, first);
+				dirty.last	= _max(dirty.last, last);
+			} else {
+				dirty.first	= first;
+				dirty.last	= last;
+			}
+		}
+
+		INLINE void mark(uint8_t index) {
+			this->mark(index, 0, this->output.size());
+		}
+
+		INLINE void invalidate() {
+			this->damage.first	= 0;
+			this->damage.last	= this->output.size();
+		}
+
+		INLINE void set_background(const color_t color) {
+			this->background = color;
+			this->invalidate();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RECOMPOSITE THE DIRTY PART OF THE FRAME. WITH A BUDGET (IN
+		// MICROSECONDS), OPTIONAL LAYERS WHOSE ESTIMATED COST WOULD PUSH THE
+		// FRAME OVER IT ARE LEFT OUT OF THIS FRAME. RETURNS THE MICROSECONDS
+		// SPENT COMPOSITING
+		////////////////////////////////////////////////////////////////////////
+		uint32_t render(uint32_t budget=0) {
+			const color_range_t area = this->bounds();
+			if (!area.size()) return 0;
+
+			this->plan(area.size(), budget);
+
+			color_t			*out	= this->output.modify(area.first, area.size());
+			uint32_t		start	= COLOR_COMPOSITOR_CLOCK();
+			const uint32_t	begin	= start;
+
+			for (size_t tile=area.first; tile<area.last; tile+=COLOR_COMPOSITOR_TILE) {
+				const size_t	length	= _min((size_t)COLOR_COMPOSITOR_TILE, area.last - tile);
+				color_t			*dst	= out + (tile - area.first);
+				bool			filled	= false;
+
+				for (uint8_t i=0; i<this->used; i++) {
+					color_layer_t &layer = this->stack[i];
+					if (!this->active[i]) continue;
+
+					this->apply(layer, dst, layer.pixels + tile, length, filled);
+					filled = true;
+
+					const uint32_t now = COLOR_COMPOSITOR_CLOCK();
+					this->spent[i]	+= now - start;
+					start			 = now;
+				}
+
+				if (!filled) this->fill(dst, length);
+			}
+
+			this->finish(area);
+
+			return COLOR_COMPOSITOR_CLOCK() - begin;
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// UNION OF EVERY LAYER'S DIRTY REGION, AND ANY DAMAGE FROM CHANGES TO
+		// THE STACK ITSELF
+		////////////////////////////////////////////////////////////////////////
+		color_range_t bounds() const {
+			color_range_t area = this->damage;
+
+			for (uint8_t i=0; i<this->used; i++) {
+				const color_range_t &dirty = this->stack[i].dirty;
+				if (!dirty.size()) continue;
+
+				if (area.size()) {
+					area.first	= _min(area.first, dirty.first);
+					area.last	= _max(area.last, dirty.last);
+				} else {
+					area = dirty;
+				}
+			}
+
+			return area;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DECIDE WHICH LAYERS TAKE PART IN THIS FRAME. REQUIRED LAYERS ALWAYS
+		// DO, THEN OPTIONAL LAYERS ARE ADDED BOTTOM TO TOP WHILE THEIR
+		// ESTIMATED COST STILL FITS IN WHAT IS LEFT OF THE BUDGET
+		////////////////////////////////////////////////////////////////////////
+		void plan(size_t pixels, uint32_t budget) {
+			uint32_t estimate = 0;
+
+			for (uint8_t i=0; i<this->used; i++) {
+				const color_layer_t &layer = this->stack[i];
+				this->spent[i]		= 0;
+				this->deferred[i]	= false;
+				this->active[i]		= layer.enabled  &&  (layer.opacity  ||  layer.mode == COLOR_BLEND_NORMAL);
+				if (this->active[i]  &&  !layer.optional) estimate += this->predict(layer, pixels);
+			}
+
+			if (!budget) return;
+
+			for (uint8_t i=0; i<this->used; i++) {
+				color_layer_t &layer = this->stack[i];
+				if (!this->active[i]  ||  !layer.optional) continue;
+
+				const uint32_t cost = this->predict(layer, pixels);
+				if (estimate + cost > budget) {
+					this->active[i]		= false;
+					this->deferred[i]	= true;
+					layer.skipped++;
+				} else {
+					estimate += cost;
+				}
+			}
+		}
+
+		INLINE uint32_t predict(const color_layer_t &layer, size_t pixels) const {
+			return (uint32_t)(((uint64_t)layer.cost * pixels) >> 14);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// UPDATE THE TIMING COUNTERS AND CLEAR THE DIRTY REGIONS. A LAYER
+		// SKIPPED FOR TIME IS MISSING FROM EVERYTHING JUST RECOMPOSITED, SO
+		// THAT WHOLE AREA STAYS DIRTY ON IT FOR THE NEXT FRAME
+		////////////////////////////////////////////////////////////////////////
+		void finish(const color_range_t &area) {
+			const size_t pixels = area.size();
+
+			this->damage.first	= 0;
+			this->damage.last	= 0;
+
+			for (uint8_t i=0; i<this->used; i++) {
+				color_layer_t &layer = this->stack[i];
+
+				if (this->deferred[i]) {
+					layer.dirty = area;
+					continue;
+				}
+
+				layer.dirty.first	= 0;
+				layer.dirty.last	= 0;
+
+				if (!this->active[i]) continue;
+
+				// COST IS A RUNNING AVERAGE OVER ABOUT 8 FRAMES, PER 1024 PIXELS
+				const uint32_t sample = (uint32_t)(((uint64_t)this->spent[i] << 14) / pixels);
+				layer.cost		= layer.frames ? (layer.cost - (layer.cost >> 3) + (sample >> 3)) : sample;
+				layer.last		= this->spent[i];
+				layer.total		+= this->spent[i];
+				layer.frames++;
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BLEND ONE TILE OF A LAYER INTO THE OUTPUT. THE BOTTOM LAYER DRAWN IN
+		// A TILE IS BLENDED OVER THE BACKGROUND, WHICH IS SKIPPED WHEN THAT
+		// LAYER WOULD COVER IT ANYWAY
+		////////////////////////////////////////////////////////////////////////
+		void apply(const color_layer_t &layer, color_t *dst, const color_t *src, size_t length, bool filled) {
+			if (layer.mode == COLOR_BLEND_NORMAL  &&  layer.opacity == 255) {
+				memcpy((void*)dst, src, length * sizeof(color_t));
+				return;
+			}
+
+			if (!filled) this->fill(dst, length);
+
+			if (layer.mode == COLOR_BLEND_NORMAL) {
+				color_span_blend(dst, src, layer.opacity, length);
+				return;
+			}
+
+			// PARTLY OPAQUE: BLEND INTO SCRATCH SPACE, THEN FADE THAT IN
+			color_t *target = dst;
+			if (layer.opacity < 255) {
+				memcpy((void*)this->scratch, dst, length * sizeof(color_t));
+				target = this->scratch;
+			}
+
+			switch (layer.mode) {
+				case COLOR_BLEND_ADD:		color_span_add(target, src, length);		break;
+				case COLOR_BLEND_SUB:		color_span_sub(target, src, length);		break;
+				case COLOR_BLEND_SCREEN:	color_span_screen(target, src, length);		break;
+				case COLOR_BLEND_MULTIPLY:	color_span_multiply(target, src, length);	break;
+				case COLOR_BLEND_MIN:		color_span_min(target, src, length);		break;
+				case COLOR_BLEND_MAX:		color_span_max(target, src, length);		break;
+				case COLOR_BLEND_NORMAL:	break; // HANDLED ABOVE
+			}
+
+			if (target != dst) color_span_blend(dst, target, layer.opacity, length);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// TILE WITH NOTHING UNDER IT YET
+		////////////////////////////////////////////////////////////////////////
+		INLINE void fill(color_t *dst, size_t length) const {
+			for (size_t i=0; i<length; i++) dst[i] = this->background;
+		}
+
+
+
+
+		color_strip_t	&output;
+		color_t			background;
+		uint8_t			used;
+		color_range_t	damage;
+		color_layer_t	stack[COLOR_COMPOSITOR_LAYERS];
+		uint32_t		spent[COLOR_COMPOSITOR_LAYERS];
+		bool			active[COLOR_COMPOSITOR_LAYERS];
+		bool			deferred[COLOR_COMPOSITOR_LAYERS];
+		color_t			scratch[COLOR_COMPOSITOR_TILE];
+};
+
+
+
+
+#endif //__color_compositor_h__
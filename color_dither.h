@@ -0,0 +1,323 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| TEMPORAL DITHERING FOR GLOBAL BRIGHTNESS AND WHITE BALANCE. SCALING A        |
+| CHANNEL DOWN LEAVES A FRACTION BELOW THE LAST BIT, WHICH WOULD NORMALLY BE   |
+| THROWN AWAY. INSTEAD THE TOP 4 BITS OF THAT FRACTION ARE KEPT IN A NIBBLE    |
+| PLANE (HALF A BYTE PER CHANNEL) AND ADDED BACK ON THE NEXT FRAME, SO A       |
+| CHANNEL FLICKERS BETWEEN ITS TWO NEAREST LEVELS IN THE RIGHT RATIO AND LOW   |
+| BRIGHTNESS FADES STAY SMOOTH.                                                |
+|                                                                              |
+| THE OUTPUT IS PRODUCED IN SMALL BLOCKS THAT ARE DITHERED AND THEN ENCODED    |
+| STRAIGHT INTO THE WS2812B SPI STREAM WHILE STILL IN CACHE, SO THE FRAME IS   |
+| ONLY READ ONCE AND NO SECOND FULL-SIZE BUFFER IS NEEDED.                     |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_dither_h__
+#define __color_dither_h__
+
+
+
+
+#include "color.h"
+#include "color_ws2812.h"
+
+
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BYTES DITHERED AND ENCODED PER BLOCK, HELD ON THE STACK. IT MUST BE A
+// MULTIPLE OF 48 (16 PIXELS) SO EVERY BLOCK STARTS ON THE GREEN CHANNEL AND
+// FILLS WHOLE SIMD VECTORS. LARGER BLOCKS SPREAD THE PER-CALL ENCODER SETUP
+// OVER MORE PIXELS, BUT AVR DOESN'T HAVE THE STACK FOR THEM
+////////////////////////////////////////////////////////////////////////////////
+#define COLOR_DITHER_LANES		48
+
+#ifndef COLOR_DITHER_BLOCK
+#ifdef __AVR__
+#define COLOR_DITHER_BLOCK		48
+#else
+#define COLOR_DITHER_BLOCK		768
+#endif
+#endif
+
+static_assert(COLOR_DITHER_BLOCK % COLOR_DITHER_LANES == 0, "COLOR_DITHER_BLOCK MUST BE A MULTIPLE OF 48");
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SIZE OF THE RESIDUAL PLANE FOR A STRIP, ONE NIBBLE PER CHANNEL
+////////////////////////////////////////////////////////////////////////////////
+INLINE size_t color_dither_plane_size(size_t count) {
+	return (count * sizeof(color_t) + 1) / 2;
+}
+
+
+
+
+class color_dither_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// PLANE MUST HOLD COLOR_DITHER_PLANE_SIZE(COUNT) BYTES
+		////////////////////////////////////////////////////////////////////////
+		color_dither_t(uint8_t *plane, size_t count) {
+			this->plane		= plane;
+			this->count		= count;
+			this->level		= 255;
+			this->white		= color_t(255, 255, 255);
+			this->update();
+			this->reset();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// NUMBER OF PIXELS IN THE STRIP
+		////////////////////////////////////////////////////////////////////////
+		INLINE size_t size() const {
+			return this->count;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CLEAR THE CARRIED RESIDUALS, SUCH AS AFTER A SCENE CHANGE
+		////////////////////////////////////////////////////////////////////////
+		INLINE void reset() {
+			memset(this->plane, 0, color_dither_plane_size(this->count));
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// GLOBAL BRIGHTNESS, 255 IS FULL BRIGHTNESS
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint8_t brightness() const {
+			return this->level;
+		}
+
+		INLINE void brightness(const uint8_t level) {
+			this->level = level;
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// WHITE BALANCE AS A PER-CHANNEL SCALE, 255 LEAVES A CHANNEL UNCHANGED
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_t balance() const {
+			return this->white;
+		}
+
+		INLINE void balance(const color_t white) {
+			this->white = white;
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DITHER A WHOLE FRAME INTO ANOTHER PIXEL BUFFER (OR IN PLACE)
+		////////////////////////////////////////////////////////////////////////
+		void apply(const color_t *source, color_t *destination) {
+			const uint8_t	*in		= (const uint8_t*) source;
+			uint8_t			*out	= (uint8_t*) destination;
+			const size_t	bytes	= this->count * sizeof(color_t);
+
+			for (size_t i=0; i<bytes; i+=COLOR_DITHER_BLOCK) {
+				this->dither(in + i, out + i, i, _min(bytes - i, (size_t)COLOR_DITHER_BLOCK));
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DITHER A WHOLE FRAME STRAIGHT INTO A WS2812B SPI STREAM, FOLLOWED BY
+		// RESET BYTES OF ZERO PADDING. OUT MUST HOLD COLOR_WS2812_SIZE3/4
+		// (COUNT, RESET) BYTES. RETURNS THE NUMBER OF BYTES WRITTEN
+		////////////////////////////////////////////////////////////////////////
+		INLINE size_t encode3(const color_t *pixels, uint8_t *out, size_t reset=0) {
+			return this->stream(pixels, out, reset, color_ws2812_encode3_bytes);
+		}
+
+		INLINE size_t encode4(const color_t *pixels, uint8_t *out, size_t reset=0) {
+			return this->stream(pixels, out, reset, color_ws2812_encode4_bytes);
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// DITHER ONE BLOCK INTO A SMALL STACK BUFFER, THEN ENCODE IT
+		////////////////////////////////////////////////////////////////////////
+		template <class ENCODE>
+		INLINE size_t stream(const color_t *pixels, uint8_t *out, size_t reset, ENCODE encode) {
+			const uint8_t	*in		= (const uint8_t*) pixels;
+			const size_t	bytes	= this->count * sizeof(color_t);
+			uint8_t			*end	= out;
+			uint8_t			block[COLOR_DITHER_BLOCK];
+
+			for (size_t i=0; i<bytes; i+=COLOR_DITHER_BLOCK) {
+				const size_t length = _min(bytes - i, (size_t)COLOR_DITHER_BLOCK);
+				this->dither(in + i, block, i, length);
+				end = encode(block, length, end);
+			}
+
+			memset(end, 0, reset);
+			return (end - out) + reset;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DITHER UP TO ONE BLOCK, STARTING AT BYTE OFFSET FIRST IN THE FRAME
+		// (ALWAYS A MULTIPLE OF THE BLOCK SIZE, SO ALWAYS THE GREEN CHANNEL).
+		// SCALED VALUES ARE 8.8 FIXED POINT: THE HIGH BYTE IS OUTPUT AND THE
+		// TOP NIBBLE OF THE LOW BYTE IS CARRIED INTO THE NEXT FRAME
+		////////////////////////////////////////////////////////////////////////
+		INLINE void dither(const uint8_t *in, uint8_t *out, size_t first, size_t length) {
+			uint8_t *residual = this->plane + (first >> 1);
+
+			#if defined(__SSE2__)
+			for (; length >= COLOR_DITHER_LANES; length -= COLOR_DITHER_LANES) {
+				const __m128i zero		= _mm_setzero_si128();
+				const __m128i nibble	= _mm_set1_epi8(0x0f);
+				const __m128i low		= _mm_set1_epi16(0x0f);
+				const __m128i byte		= _mm_set1_epi16(0xff);
+
+				for (uint8_t v=0; v<3; v++) {
+					const __m128i data		= _mm_loadu_si128((const __m128i*)(in + v * 16));
+					const __m128i packed	= _mm_loadl_epi64((const __m128i*)(residual + v * 8));
+
+					// SPLIT THE NIBBLES BACK OUT INTO ONE BYTE PER CHANNEL
+					const __m128i carry		= _mm_unpacklo_epi8(
+						_mm_and_si128(packed, nibble),
+						_mm_and_si128(_mm_srli_epi16(packed, 4), nibble)
+					);
+
+					const __m128i sum_lo	= _mm_add_epi16(
+						_mm_mullo_epi16(_mm_unpacklo_epi8(data, zero), _mm_loadu_si128((const __m128i*)(this->pattern + v * 16))),
+						_mm_slli_epi16(_mm_unpacklo_epi8(carry, zero), 4)
+					);
+
+					const __m128i sum_hi	= _mm_add_epi16(
+						_mm_mullo_epi16(_mm_unpackhi_epi8(data, zero), _mm_loadu_si128((const __m128i*)(this->pattern + v * 16 + 8))),
+						_mm_slli_epi16(_mm_unpackhi_epi8(carry, zero), 4)
+					);
+
+					_mm_storeu_si128((__m128i*)(out + v * 16), _mm_packus_epi16(
+						_mm_srli_epi16(sum_lo, 8),
+						_mm_srli_epi16(sum_hi, 8)
+					));
+
+					// NEW RESIDUALS, THEN PACK EACH PAIR BACK INTO ONE BYTE
+					const __m128i next		= _mm_packus_epi16(
+						_mm_and_si128(_mm_srli_epi16(sum_lo, 4), low),
+						_mm_and_si128(_mm_srli_epi16(sum_hi, 4), low)
+					);
+
+					_mm_storel_epi64((__m128i*)(residual + v * 8), _mm_packus_epi16(
+						_mm_and_si128(_mm_or_si128(next, _mm_srli_epi16(next, 4)), byte),
+						zero
+					));
+				}
+
+				in			+= COLOR_DITHER_LANES;
+				out			+= COLOR_DITHER_LANES;
+				residual	+= COLOR_DITHER_LANES / 2;
+			}
+			#endif
+
+			uint8_t channel = 0;
+			for (size_t i=0; i<length; i++) {
+				const uint8_t	shift	= (i & 1) << 2;
+				const uint8_t	carry	= (residual[i >> 1] >> shift) & 0x0f;
+				const uint16_t	sum		= in[i] * this->scale[channel] + (carry << 4);
+
+				out[i]				= sum >> 8;
+				residual[i >> 1]	= (residual[i >> 1] & (0xf0 >> shift))
+									| (((sum >> 4) & 0x0f) << shift);
+
+				if (++channel == 3) channel = 0;
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FOLD BRIGHTNESS AND WHITE BALANCE INTO ONE 0-256 SCALE PER CHANNEL,
+		// IN G-R-B ORDER, WHERE 256 IS EXACTLY UNITY
+		////////////////////////////////////////////////////////////////////////
+		void update() {
+			this->scale[0] = color_t::scale256(this->level, this->white.g);
+			this->scale[1] = color_t::scale256(this->level, this->white.r);
+			this->scale[2] = color_t::scale256(this->level, this->white.b);
+
+			#if defined(__SSE2__)
+			for (uint8_t i=0; i<COLOR_DITHER_LANES; i++) {
+				this->pattern[i] = this->scale[i % 3];
+			}
+			#endif
+		}
+
+
+
+
+		uint8_t			*plane;
+		size_t			count;
+		uint8_t			level;
+		color_t			white;
+		uint16_t		scale[3];
+
+		#if defined(__SSE2__)
+		uint16_t		pattern[COLOR_DITHER_LANES];
+		#endif
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DITHER STAGE THAT OWNS ITS OWN RESIDUAL PLANE
+////////////////////////////////////////////////////////////////////////////////
+template <size_t COUNT>
+class color_dither_buffer_t : public color_dither_t {
+	public:
+		color_dither_buffer_t() : color_dither_t(storage, COUNT) {}
+
+		// THE BASE CLASS POINTS INTO THIS OBJECT, SO IT CANNOT BE COPIED
+		color_dither_buffer_t(const color_dither_buffer_t &) = delete;
+		color_dither_buffer_t &operator =(const color_dither_buffer_t &) = delete;
+
+	private:
+		uint8_t storage[(COUNT * sizeof(color_t) + 1) / 2];
+};
+
+
+
+
+#endif //__color_dither_h__
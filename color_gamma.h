@@ -0,0 +1,269 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| GAMMA CORRECTION TABLES GENERATED AT COMPILE TIME, PLUS A SINGLE-PASS        |
+| CORRECTION STAGE THAT APPLIES GAMMA, GLOBAL BRIGHTNESS, AND PER-CHANNEL      |
+| WHITE BALANCE TO A WHOLE BUFFER OF COLOR_T PIXELS.                           |
+|                                                                              |
+| TABLES ARE SELECTED BY GAMMA IN HUNDREDTHS, SO 2.2 IS COLOR_GAMMA<220>.      |
+| THEY ARE STORED IN PROGMEM, SO ON AVR THEY TAKE NO RAM.                      |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_gamma_h__
+#define __color_gamma_h__
+
+
+
+
+#include "color.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// KEEP A 3X256 BYTE COMBINED LOOKUP TABLE IN RAM, SO CORRECTION IS A PURE
+// TABLE LOOKUP. AVR BOARDS DON'T HAVE THE RAM FOR IT, SO THEY MULTIPLY INSTEAD
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_CORRECTION_LUT
+#ifdef __AVR__
+#define COLOR_CORRECTION_LUT	0
+#else
+#define COLOR_CORRECTION_LUT	1
+#endif
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CONSTEXPR MATH FOR THE TABLE GENERATOR
+// WRITTEN AS SINGLE-RETURN RECURSION SO IT IS VALID C++11 FOR AVR-GCC
+////////////////////////////////////////////////////////////////////////////////
+#define COLOR_GAMMA_LN2		0.69314718055994530942
+
+constexpr double color_gamma_square(double value) {
+	return value * value;
+}
+
+// ATANH SERIES: Y + Y^3/3 + Y^5/5 + ...
+constexpr double color_gamma_atanh(double y2, double term, int k) {
+	return (k > 41) ? 0 : (term / k) + color_gamma_atanh(y2, term * y2, k + 2);
+}
+
+// NATURAL LOG, HALVING THE RANGE UNTIL X IS IN [0.5, 1]
+constexpr double color_gamma_ln(double x) {
+	return (x < 0.5)
+		? color_gamma_ln(x * 2) - COLOR_GAMMA_LN2
+		: 2 * color_gamma_atanh(
+			color_gamma_square((x - 1) / (x + 1)),
+			(x - 1) / (x + 1),
+			1
+		);
+}
+
+// TAYLOR SERIES: 1 + Z + Z^2/2! + ...
+constexpr double color_gamma_taylor(double z, double term, int k) {
+	return (k > 20) ? 0 : term + color_gamma_taylor(z, term * z / k, k + 1);
+}
+
+// EXPONENT, SQUARING BACK UP FROM A SMALL ARGUMENT
+constexpr double color_gamma_exp(double z) {
+	return (z < -0.5)
+		? color_gamma_square(color_gamma_exp(z / 2))
+		: color_gamma_taylor(z, 1, 1);
+}
+
+// ROUND(255 * (INDEX / 255) ^ (GAMMA / 100))
+constexpr uint8_t color_gamma_value(uint16_t index, uint16_t gamma) {
+	return (index == 0)
+		? (gamma ? 0 : 255)
+		: (uint8_t)(255.0 * color_gamma_exp(color_gamma_ln(index / 255.0) * gamma / 100.0) + 0.5);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// INDEX SEQUENCE 0..N-1, AS <UTILITY> IS NOT AVAILABLE ON AVR
+////////////////////////////////////////////////////////////////////////////////
+template <uint16_t... INDEX>
+struct color_gamma_sequence {};
+
+template <uint16_t COUNT, uint16_t... INDEX>
+struct color_gamma_make : color_gamma_make<COUNT - 1, COUNT - 1, INDEX...> {};
+
+template <uint16_t... INDEX>
+struct color_gamma_make<0, INDEX...> {
+	typedef color_gamma_sequence<INDEX...> type;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// THE TABLES THEMSELVES. EACH GAMMA VALUE USED IN A SKETCH IS INSTANTIATED
+// ONCE, AND IS CONSTANT-INITIALIZED SO THERE IS NO STARTUP COST
+////////////////////////////////////////////////////////////////////////////////
+template <uint16_t GAMMA, class SEQUENCE>
+struct color_gamma_data;
+
+template <uint16_t GAMMA, uint16_t... INDEX>
+struct color_gamma_data<GAMMA, color_gamma_sequence<INDEX...>> {
+	static CONST uint8_t table[sizeof...(INDEX)];
+};
+
+template <uint16_t GAMMA, uint16_t... INDEX>
+CONST uint8_t color_gamma_data<GAMMA, color_gamma_sequence<INDEX...>>::table[sizeof...(INDEX)] = {
+	color_gamma_value(INDEX, GAMMA)...
+};
+
+template <uint16_t GAMMA>
+struct color_gamma : color_gamma_data<GAMMA, typename color_gamma_make<256>::type> {};
+
+
+
+
+class color_correction_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// SAME GAMMA CURVE ON EVERY CHANNEL, DEFAULTS TO GAMMA 2.2
+		////////////////////////////////////////////////////////////////////////
+		color_correction_t(const uint8_t *curve=color_gamma<220>::table)
+			: color_correction_t(curve, curve, curve) {}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SEPARATE GAMMA CURVE FOR EACH CHANNEL, ALL IN PROGMEM
+		////////////////////////////////////////////////////////////////////////
+		color_correction_t(const uint8_t *r, const uint8_t *g, const uint8_t *b) {
+			this->curve_g	= g;
+			this->curve_r	= r;
+			this->curve_b	= b;
+			this->level		= 255;
+			this->white		= color_t(255, 255, 255);
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// GLOBAL BRIGHTNESS, 255 IS FULL BRIGHTNESS
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint8_t brightness() const {
+			return this->level;
+		}
+
+		INLINE void brightness(const uint8_t level) {
+			this->level = level;
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// WHITE BALANCE AS A PER-CHANNEL SCALE, 255 LEAVES A CHANNEL UNCHANGED
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_t balance() const {
+			return this->white;
+		}
+
+		INLINE void balance(const color_t white) {
+			this->white = white;
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CORRECT A SINGLE COLOR
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_t apply(const color_t color) const {
+			color_t output;
+			this->apply(&color, &output, 1);
+			return output;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CORRECT A BUFFER IN PLACE, OR FROM SOURCE INTO DESTINATION
+		////////////////////////////////////////////////////////////////////////
+		INLINE void apply(color_t *pixels, size_t count) const {
+			this->apply(pixels, pixels, count);
+		}
+
+		void apply(const color_t *source, color_t *destination, size_t count) const {
+			for (size_t i=0; i<count; i++) {
+				const color_t &in = source[i];
+				color_t &out = destination[i];
+
+				#if COLOR_CORRECTION_LUT
+				out.g = this->lut_g[in.g];
+				out.r = this->lut_r[in.r];
+				out.b = this->lut_b[in.b];
+				#else
+				out.g = (pgm_read_byte(this->curve_g + in.g) * this->scale_g) >> 8;
+				out.r = (pgm_read_byte(this->curve_r + in.r) * this->scale_r) >> 8;
+				out.b = (pgm_read_byte(this->curve_b + in.b) * this->scale_b) >> 8;
+				#endif
+			}
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// FOLD BRIGHTNESS AND WHITE BALANCE INTO ONE 0-256 SCALE PER CHANNEL,
+		// WHERE 256 IS EXACTLY UNITY (SO FULL BRIGHTNESS IS LOSSLESS)
+		////////////////////////////////////////////////////////////////////////
+		void update() {
+			this->scale_g = color_t::scale256(this->level, this->white.g);
+			this->scale_r = color_t::scale256(this->level, this->white.r);
+			this->scale_b = color_t::scale256(this->level, this->white.b);
+
+			#if COLOR_CORRECTION_LUT
+			for (uint16_t i=0; i<256; i++) {
+				this->lut_g[i] = (pgm_read_byte(this->curve_g + i) * this->scale_g) >> 8;
+				this->lut_r[i] = (pgm_read_byte(this->curve_r + i) * this->scale_r) >> 8;
+				this->lut_b[i] = (pgm_read_byte(this->curve_b + i) * this->scale_b) >> 8;
+			}
+			#endif
+		}
+
+
+
+
+		const uint8_t	*curve_g;
+		const uint8_t	*curve_r;
+		const uint8_t	*curve_b;
+		uint8_t			level;
+		color_t			white;
+		uint16_t		scale_g;
+		uint16_t		scale_r;
+		uint16_t		scale_b;
+
+		#if COLOR_CORRECTION_LUT
+		uint8_t			lut_g[256];
+		uint8_t			lut_r[256];
+		uint8_t			lut_b[256];
+		#endif
+};
+
+
+
+
+#endif //__color_gamma_h__
@@ -0,0 +1,260 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| BULK HEX TEXT PARSING AND FORMATTING FOR WHOLE FRAMES OF PIXELS.             |
+| A FRAME IS A LIST OF HEX COLOR CODES, EACH WITH AN OPTIONAL "#" OR "0X"      |
+| PREFIX, SEPARATED BY WHITESPACE, COMMAS, OR SEMICOLONS (OR NOT AT ALL).      |
+| NEITHER DIRECTION USES THE HEAP. ON 32 AND 64 BIT LITTLE ENDIAN TARGETS,     |
+| THE SIX DIGITS OF A PIXEL ARE VALIDATED AND DECODED TOGETHER AS ONE 64 BIT   |
+| WORD (SWAR), AND FORMATTING USES A 256 ENTRY TABLE OF DIGIT PAIRS.           |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_hex_h__
+#define __color_hex_h__
+
+
+
+
+#include "color.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DECODE DIGITS EIGHT AT A TIME IN A 64 BIT WORD. AVR IS AN 8 BIT CPU, SO IT
+// IS FASTER THERE TO DECODE ONE CHARACTER AT A TIME
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_HEX_SWAR
+#if !defined(__AVR__)  &&  defined(__BYTE_ORDER__)  &&  (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define COLOR_HEX_SWAR		1
+#else
+#define COLOR_HEX_SWAR		0
+#endif
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PER PIXEL RESULT OF COLOR_T::PARSE_HEX_FRAME(). FAILED PIXELS ARE BLACK
+////////////////////////////////////////////////////////////////////////////////
+enum COLOR_HEX_STATUS {
+	COLOR_HEX_OK,			// SIX VALID HEX DIGITS
+	COLOR_HEX_INVALID,		// A CHARACTER THAT IS NOT A HEX DIGIT
+	COLOR_HEX_TRUNCATED,	// FEWER THAN SIX DIGITS BEFORE A SEPARATOR
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EVERY BYTE VALUE AS TWO UPPER CASE HEX DIGITS, MATCHING COLOR_T::HEX()
+////////////////////////////////////////////////////////////////////////////////
+#define COLOR_HEX_ROW(h)												\
+	{h,'0'}, {h,'1'}, {h,'2'}, {h,'3'}, {h,'4'}, {h,'5'}, {h,'6'}, {h,'7'},	\
+	{h,'8'}, {h,'9'}, {h,'A'}, {h,'B'}, {h,'C'}, {h,'D'}, {h,'E'}, {h,'F'}
+
+static CONST char color_hex_pairs[256][2] = {
+	COLOR_HEX_ROW('0'), COLOR_HEX_ROW('1'), COLOR_HEX_ROW('2'), COLOR_HEX_ROW('3'),
+	COLOR_HEX_ROW('4'), COLOR_HEX_ROW('5'), COLOR_HEX_ROW('6'), COLOR_HEX_ROW('7'),
+	COLOR_HEX_ROW('8'), COLOR_HEX_ROW('9'), COLOR_HEX_ROW('A'), COLOR_HEX_ROW('B'),
+	COLOR_HEX_ROW('C'), COLOR_HEX_ROW('D'), COLOR_HEX_ROW('E'), COLOR_HEX_ROW('F'),
+};
+
+#undef COLOR_HEX_ROW
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// LENGTH OF THE PREFIX WRITTEN FOR EACH COLOR_HEX_TYPE
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint8_t color_hex_prefix(const COLOR_HEX_TYPE type) {
+	return (type == COLOR_HEX_LITERAL) ? 2 : (type == COLOR_HEX_HTML) ? 1 : 0;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BUFFER SIZE NEEDED BY COLOR_T::FORMAT_HEX_FRAME(), INCLUDING THE NULL BYTE
+////////////////////////////////////////////////////////////////////////////////
+INLINE size_t color_hex_frame_size(const size_t count, const COLOR_HEX_TYPE type=COLOR_HEX_NORMAL) {
+	return count * (color_hex_prefix(type) + 7) + 1;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CHARACTERS ALLOWED BETWEEN PIXELS: WHITESPACE, CONTROL CODES, ',' AND ';'
+////////////////////////////////////////////////////////////////////////////////
+INLINE bool color_hex_separator(const char c) {
+	return ((uint8_t)c <= ' ')  ||  (c == ',')  ||  (c == ';');
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// VALUE OF A SINGLE HEX DIGIT, OR 0XFF IF IT ISN'T ONE
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint8_t color_hex_digit(const char c) {
+	if (c >= '0'  &&  c <= '9') return c - '0';
+
+	const char lower = c | 0x20;
+	if (lower >= 'a'  &&  lower <= 'f') return lower - 'a' + 0x0A;
+
+	return 0xff;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DECODE THE SIX DIGITS OF ONE PIXEL, READING NO MORE THAN LENGTH CHARACTERS.
+// RETURNS HOW MANY LEADING DIGITS WERE VALID, SO SIX MEANS SUCCESS
+////////////////////////////////////////////////////////////////////////////////
+#if COLOR_HEX_SWAR
+
+INLINE uint8_t color_hex_decode(const char *text, size_t length, color_t &color) {
+	const uint64_t ONES		= 0x0101010101010101ull;
+	const uint64_t HIGH		= 0x8080808080808080ull;
+	const uint64_t WANT		= 0x0000808080808080ull;
+
+	// A FIXED SIZE COPY BECOMES A SINGLE LOAD. ONLY THE LAST PIXEL IN THE
+	// TEXT SHOULD EVER NEED THE SLOWER PADDED COPY
+	uint64_t word = 0;
+	if (length >= 8) {
+		memcpy(&word, text, 8);
+	} else {
+		memcpy(&word, text, length);
+	}
+
+	// CLEAR BIT 7 FIRST SO THE RANGE CHECKS BELOW CAN NEVER CARRY INTO THE
+	// NEXT BYTE. BYTES THAT HAD BIT 7 SET ARE REJECTED AT THE END
+	const uint64_t ascii	= word & ~HIGH;
+	const uint64_t lower	= ascii | (0x20 * ONES);
+	const uint64_t digit	= (ascii + (0x80 - '0') * ONES) & ~(ascii + (0x7f - '9') * ONES);
+	const uint64_t alpha	= (lower + (0x80 - 'a') * ONES) & ~(lower + (0x7f - 'f') * ONES);
+	const uint64_t valid	= (digit | alpha) & ~word & WANT;
+
+	if (valid != WANT) {
+		return __builtin_ctzll(~valid & WANT) >> 3;
+	}
+
+	// DIGITS ARE 0-9 FROM THE LOW NIBBLE, LETTERS ARE 1-6 FROM THE LOW NIBBLE
+	// PLUS NINE. THEN MERGE EACH PAIR OF NIBBLES INTO A BYTE: R, G, B
+	const uint64_t nibble	= (ascii & (0x0f * ONES)) + ((alpha & HIGH) >> 7) * 9;
+	const uint64_t pairs	= ((nibble << 4) | (nibble >> 8)) & 0x00ff00ff00ff00ffull;
+
+	color.r = pairs;
+	color.g = pairs >> 16;
+	color.b = pairs >> 32;
+	return 6;
+}
+
+#else
+
+INLINE uint8_t color_hex_decode(const char *text, size_t length, color_t &color) {
+	uint8_t value[6];
+
+	for (uint8_t i=0; i<6; i++) {
+		if (i >= length) return i;
+		value[i] = color_hex_digit(text[i]);
+		if (value[i] > 0x0f) return i;
+	}
+
+	color.r = (value[0] << 4) | value[1];
+	color.g = (value[2] << 4) | value[3];
+	color.b = (value[4] << 4) | value[5];
+	return 6;
+}
+
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PARSE A FRAME OF HEX TEXT
+////////////////////////////////////////////////////////////////////////////////
+inline size_t color_t::parse_hex_frame(const char *text, size_t length, color_t *pixels, size_t count, uint8_t *status) {
+	const char	*end	= text + length;
+	size_t		i		= 0;
+
+	for (; i<count; i++) {
+		while (text < end  &&  color_hex_separator(*text)) text++;
+		if (text == end) break;
+
+		if (*text == '#') {
+			text += 1;
+		} else if (end - text >= 2  &&  text[0] == '0'  &&  (text[1] | 0x20) == 'x') {
+			text += 2;
+		}
+
+		color_t color;
+		const uint8_t digits = color_hex_decode(text, end - text, color);
+		text += digits;
+
+		// SIX DIGITS MUST BE FOLLOWED BY THE END, A SEPARATOR, OR THE NEXT PIXEL
+		uint8_t result = COLOR_HEX_OK;
+		if (digits < 6) {
+			result = (text == end  ||  color_hex_separator(*text))
+				? COLOR_HEX_TRUNCATED
+				: COLOR_HEX_INVALID;
+		} else if (text < end  &&  *text != '#'  &&  !color_hex_separator(*text)  &&  color_hex_digit(*text) > 0x0f) {
+			result = COLOR_HEX_INVALID;
+		}
+
+		// ON ERROR, SKIP THE REST OF THE BAD PIXEL AND PICK UP AFTER IT
+		if (result != COLOR_HEX_OK) {
+			color = color_t();
+			while (text < end  &&  !color_hex_separator(*text)) text++;
+		}
+
+		pixels[i] = color;
+		if (status) status[i] = result;
+	}
+
+	return i;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FORMAT A FRAME AS HEX TEXT
+////////////////////////////////////////////////////////////////////////////////
+inline size_t color_t::format_hex_frame(const color_t *pixels, size_t count, char *text, COLOR_HEX_TYPE type, char separator) {
+	char *out = text;
+
+	for (size_t i=0; i<count; i++) {
+		if (i  &&  separator) *out++ = separator;
+
+		switch (type) {
+			case COLOR_HEX_HTML:	*out++ = '#';					break;
+			case COLOR_HEX_LITERAL:	*out++ = '0';	*out++ = 'x';	break;
+			case COLOR_HEX_NORMAL:	break; // DO NOTHING
+		}
+
+		memcpy_P(out + 0, color_hex_pairs[pixels[i].r], 2);
+		memcpy_P(out + 2, color_hex_pairs[pixels[i].g], 2);
+		memcpy_P(out + 4, color_hex_pairs[pixels[i].b], 2);
+		out += 6;
+	}
+
+	*out = nullbyte;
+
+	return out - text;
+}
+
+
+
+
+#endif //__color_hex_h__
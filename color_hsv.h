@@ -0,0 +1,233 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| FIXED POINT HSV AND HSL CONVERSIONS, WITHOUT ANY FLOATING POINT MATH.        |
+| HUE IS 16 BITS FOR THE FULL CIRCLE, SO IT WRAPS NATURALLY: RED IS 0, GREEN   |
+| IS 21845, AND BLUE IS 43690. SATURATION, VALUE, AND LIGHTNESS ARE 8 BITS.    |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_hsv_h__
+#define __color_hsv_h__
+
+
+
+
+#include "color.h"
+
+
+
+
+#define COLOR_HSV_SECTOR	0x10000l
+#define COLOR_HSV_CIRCLE	(6 * COLOR_HSV_SECTOR)
+
+
+
+
+struct color_hsv_t {
+	uint16_t	h;
+	uint8_t		s;
+	uint8_t		v;
+};
+
+
+
+struct color_hsl_t {
+	uint16_t	h;
+	uint8_t		s;
+	uint8_t		l;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// X / 255, ROUNDED TO NEAREST, FOR X FROM 0 TO 255 * 255
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint8_t color_hsv_div255(uint16_t x) {
+	x += 128;
+	return (x + (x >> 8)) >> 8;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BUILD A PIXEL FROM ONE SIXTH OF THE HUE CIRCLE. WITHIN EACH SIXTH, ONE
+// CHANNEL IS AT THE VALUE, ONE IS AT THE FLOOR, AND ONE RAMPS BETWEEN THEM
+////////////////////////////////////////////////////////////////////////////////
+INLINE color_t color_hsv_sector(uint8_t sector, uint8_t fraction, uint8_t floor, uint8_t val) {
+	const uint8_t ramp		= color_hsv_div255((uint16_t)(val - floor) * fraction);
+	const uint8_t rising	= floor + ramp;
+	const uint8_t falling	= val - ramp;
+
+	switch (sector) {
+		case 0:		return color_t(val,		rising,		floor);
+		case 1:		return color_t(falling,	val,		floor);
+		case 2:		return color_t(floor,	val,		rising);
+		case 3:		return color_t(floor,	falling,	val);
+		case 4:		return color_t(rising,	floor,		val);
+		default:	return color_t(val,		floor,		falling);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HUE OF AN RGB COLOR, SHARED BY HSV AND HSL. MAX AND MIN ARE THE LARGEST AND
+// SMALLEST CHANNELS, ALREADY FOUND BY THE CALLER
+////////////////////////////////////////////////////////////////////////////////
+inline uint16_t color_hsv_hue(const color_t color, uint8_t max, uint8_t min) {
+	const uint8_t delta = max - min;
+	if (!delta) return 0;
+
+	int32_t hue;
+	if (max == color.r) {
+		hue = 0 * COLOR_HSV_SECTOR + (((int32_t)color.g - color.b) << 16) / delta;
+	} else if (max == color.g) {
+		hue = 2 * COLOR_HSV_SECTOR + (((int32_t)color.b - color.r) << 16) / delta;
+	} else {
+		hue = 4 * COLOR_HSV_SECTOR + (((int32_t)color.r - color.g) << 16) / delta;
+	}
+
+	if (hue < 0) hue += COLOR_HSV_CIRCLE;
+	return (uint16_t)((hue + 3) / 6);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HSV TO RGB
+////////////////////////////////////////////////////////////////////////////////
+inline color_t color_t::from_hsv(uint16_t hue, uint8_t sat, uint8_t val) {
+	const uint32_t	circle	= (uint32_t)hue * 6;
+	const uint8_t	floor	= color_hsv_div255((uint16_t)val * (uint8_t)(255 - sat));
+
+	return color_hsv_sector(circle >> 16, circle >> 8, floor, val);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HSL TO RGB, BY WAY OF THE EQUIVALENT HSV COLOR
+////////////////////////////////////////////////////////////////////////////////
+inline color_t color_t::from_hsl(uint16_t hue, uint8_t sat, uint8_t light) {
+	const uint8_t	chroma	= color_hsv_div255((uint16_t)sat * _min(light, (uint8_t)(255 - light)));
+	const uint8_t	val		= _min(light + chroma, 255);
+	const uint32_t	circle	= (uint32_t)hue * 6;
+
+	return color_hsv_sector(circle >> 16, circle >> 8, light - chroma, val);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RGB TO HSV
+////////////////////////////////////////////////////////////////////////////////
+inline color_hsv_t color_t::to_hsv() const {
+	const uint8_t max = _max(_max(this->r, this->g), this->b);
+	const uint8_t min = _min(_min(this->r, this->g), this->b);
+
+	color_hsv_t hsv;
+	hsv.h = color_hsv_hue(*this, max, min);
+	hsv.s = max ? (((uint16_t)(max - min) * 255 + (max >> 1)) / max) : 0;
+	hsv.v = max;
+	return hsv;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RGB TO HSL
+////////////////////////////////////////////////////////////////////////////////
+inline color_hsl_t color_t::to_hsl() const {
+	const uint8_t	max		= _max(_max(this->r, this->g), this->b);
+	const uint8_t	min		= _min(_min(this->r, this->g), this->b);
+	const uint16_t	sum		= max + min;
+	const uint16_t	range	= (sum > 255) ? (510 - sum) : sum;
+
+	color_hsl_t hsl;
+	hsl.h = color_hsv_hue(*this, max, min);
+	hsl.s = range ? (((uint16_t)(max - min) * 255 + (range >> 1)) / range) : 0;
+	hsl.l = (sum + 1) >> 1;
+	return hsl;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FILL A BUFFER WITH A HUE SWEEP, MOVING STEP HUE UNITS PER PIXEL (NEGATIVE
+// STEPS SWEEP BACKWARDS). THE SATURATION AND VALUE ARE FIXED, SO THE FLOOR IS
+// WORKED OUT ONCE. THE SWEEP IS SPLIT INTO RUNS THAT STAY IN ONE SIXTH OF THE
+// CIRCLE, SO EACH PIXEL IS ONLY AN ADD AND ONE MULTIPLY FOR THE RAMPING
+// CHANNEL. THE RESULT IS IDENTICAL TO CALLING FROM_HSV() FOR EVERY PIXEL
+////////////////////////////////////////////////////////////////////////////////
+inline void color_hsv_fill(color_t *pixels, size_t count, uint16_t hue, int16_t step, uint8_t sat=255, uint8_t val=255) {
+	const uint8_t	floor	= color_hsv_div255((uint16_t)val * (uint8_t)(255 - sat));
+	const uint8_t	span	= val - floor;
+	const int32_t	delta	= (int32_t)step * 6;
+	int32_t			circle	= (int32_t)hue * 6;
+	size_t			i		= 0;
+
+	while (i < count) {
+		const uint8_t	sector	= circle >> 16;
+		const int32_t	start	= sector * COLOR_HSV_SECTOR;
+
+		// NUMBER OF PIXELS BEFORE THE SWEEP LEAVES THIS SIXTH OF THE CIRCLE
+		size_t run = count - i;
+		if (delta > 0) {
+			run = _min(run, (size_t)((start + COLOR_HSV_SECTOR - circle + delta - 1) / delta));
+		} else if (delta < 0) {
+			run = _min(run, (size_t)((circle - start) / -delta + 1));
+		}
+
+		// BYTE OFFSETS INTO COLOR_T (G=0, R=1, B=2) FOR EACH ROLE
+		uint8_t high, low, ramp;
+		switch (sector) {
+			case 0:		high = 1;	ramp = 0;	low = 2;	break;
+			case 1:		high = 0;	ramp = 1;	low = 2;	break;
+			case 2:		high = 0;	ramp = 2;	low = 1;	break;
+			case 3:		high = 2;	ramp = 0;	low = 1;	break;
+			case 4:		high = 2;	ramp = 1;	low = 0;	break;
+			default:	high = 1;	ramp = 2;	low = 0;	break;
+		}
+
+		uint8_t *out = (uint8_t*)(pixels + i);
+		i += run;
+
+		if (sector & 1) {
+			for (; run; run--, out+=3, circle+=delta) {
+				out[high]	= val;
+				out[low]	= floor;
+				out[ramp]	= val - color_hsv_div255((uint16_t)span * (uint8_t)(circle >> 8));
+			}
+		} else {
+			for (; run; run--, out+=3, circle+=delta) {
+				out[high]	= val;
+				out[low]	= floor;
+				out[ramp]	= floor + color_hsv_div255((uint16_t)span * (uint8_t)(circle >> 8));
+			}
+		}
+
+		if (circle >= COLOR_HSV_CIRCLE) {
+			circle -= COLOR_HSV_CIRCLE;
+		} else if (circle < 0) {
+			circle += COLOR_HSV_CIRCLE;
+		}
+	}
+}
+
+
+
+
+#endif //__color_hsv_h__
@@ -0,0 +1,421 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| INDEXED COLOR FRAME STORAGE. EACH PIXEL IS A 4-BIT (16 COLOR) OR 8-BIT (256  |
+| COLOR) INDEX INTO A PALETTE OF COLOR_T KEPT IN RAM, SO A FRAME TAKES A SIXTH |
+| OR A THIRD OF THE MEMORY OF COLOR_T. PIXELS ARE ONLY LOOKED UP IN THE        |
+| PALETTE AS THEY ARE SENT, A SMALL BLOCK AT A TIME, STRAIGHT INTO THE WS2812B |
+| ENCODER. CHANGING THE PALETTE (COLOR CYCLING, FADES) TOUCHES EVERY ENTRY,    |
+| BUT NOT A SINGLE PIXEL.                                                      |
+|                                                                              |
+| 4-BIT PIXELS ARE PACKED TWO PER BYTE, THE EVEN PIXEL IN THE LOW NIBBLE.      |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_indexed_h__
+#define __color_indexed_h__
+
+
+
+
+#include <stddef.h>
+#include <string.h>
+#include "color.h"
+#include "color_ws2812.h"
+
+
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PIXELS LOOKED UP AND ENCODED PER BLOCK, HELD ON THE STACK. IT MUST BE EVEN,
+// SO 4-BIT BLOCKS START ON A WHOLE BYTE, AND A MULTIPLE OF 16 FILLS WHOLE
+// SIMD VECTORS. AVR DOESN'T HAVE THE STACK FOR LARGE BLOCKS
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_INDEXED_BLOCK
+#ifdef __AVR__
+#define COLOR_INDEXED_BLOCK		16
+#else
+#define COLOR_INDEXED_BLOCK		256
+#endif
+#endif
+
+static_assert(COLOR_INDEXED_BLOCK % 16 == 0, "COLOR_INDEXED_BLOCK MUST BE A MULTIPLE OF 16");
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BYTES OF INDEX STORAGE NEEDED FOR A STRIP
+////////////////////////////////////////////////////////////////////////////////
+INLINE size_t color_indexed_size(size_t count, uint8_t bits) {
+	return (count * bits + 7) / 8;
+}
+
+
+
+
+template <uint8_t BITS=4>
+class color_indexed_strip_t {
+	static_assert(BITS == 4  ||  BITS == 8, "INDEXED PIXELS ARE 4 OR 8 BITS");
+
+	public:
+		enum {
+			COLORS = 1 << BITS,
+		};
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INDEXES MUST HOLD COLOR_INDEXED_SIZE(COUNT, BITS) BYTES. THE PALETTE
+		// STARTS AS THE 16 COLORS FROM COLOR_T::PALETTE(), THE REST BLACK, SO
+		// INDEX 0 IS WHITE UNTIL THE PALETTE IS CHANGED
+		////////////////////////////////////////////////////////////////////////
+		color_indexed_strip_t(uint8_t *indexes, size_t count) {
+			this->indexes	= indexes;
+			this->count		= count;
+
+			for (uint16_t i=0; i<COLORS; i++) {
+				this->colors[i] = color_t::palette(i);
+			}
+			this->update();
+		}
+
+
+
+
+		INLINE size_t size() const {
+			return this->count;
+		}
+
+		INLINE uint8_t *data() {
+			return this->indexes;
+		}
+
+		INLINE const uint8_t *data() const {
+			return this->indexes;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PIXEL ACCESS BY PALETTE INDEX. OUT OF RANGE WRITES ARE IGNORED, AND
+		// READS GIVE INDEX 0. INDEXES ARE MASKED TO THE PALETTE SIZE
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint8_t get(size_t pixel) const {
+			if (pixel >= this->count) return 0;
+			if (BITS == 8) return this->indexes[pixel];
+			return (this->indexes[pixel >> 1] >> ((pixel & 1) << 2)) & 0x0f;
+		}
+
+		INLINE void set(size_t pixel, uint8_t index) {
+			if (pixel >= this->count) return;
+			if (BITS == 8) {
+				this->indexes[pixel] = index;
+				return;
+			}
+
+			const uint8_t shift = (pixel & 1) << 2;
+			uint8_t &byte = this->indexes[pixel >> 1];
+			byte = (byte & (0xf0 >> shift)) | ((index & 0x0f) << shift);
+		}
+
+		INLINE color_t color(size_t pixel) const {
+			return this->colors[this->get(pixel)];
+		}
+
+		INLINE void fill(uint8_t index) {
+			this->fill(0, this->count, index);
+		}
+
+		void fill(size_t first, size_t length, uint8_t index) {
+			if (first >= this->count) return;
+			length = _min(length, this->count - first);
+
+			if (BITS == 8) {
+				memset(this->indexes + first, index, length);
+				return;
+			}
+
+			// ODD PIXELS AT EITHER END SHARE A BYTE WITH THEIR NEIGHBOUR
+			if (length  &&  (first & 1)) {
+				this->set(first++, index);
+				length--;
+			}
+
+			if (length & 1) this->set(first + length - 1, index);
+
+			index &= 0x0f;
+			memset(this->indexes + (first >> 1), index | (index << 4), length >> 1);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PALETTE ACCESS. EVERY CHANGE IS O(PALETTE), NO MATTER HOW MANY
+		// PIXELS USE THE ENTRIES
+		////////////////////////////////////////////////////////////////////////
+		INLINE const color_t *palette() const {
+			return this->colors;
+		}
+
+		INLINE color_t palette(uint8_t index) const {
+			return this->colors[index & (COLORS - 1)];
+		}
+
+		INLINE void palette(uint8_t index, const color_t color) {
+			this->colors[index & (COLORS - 1)] = color;
+			this->update();
+		}
+
+		void load(const color_t *colors, uint16_t size=COLORS) {
+			size = _min(size, (uint16_t)COLORS);
+			memcpy((void*)this->colors, colors, size * sizeof(color_t));
+			this->update();
+		}
+
+		void load(const color_palette_t &palette) {
+			for (uint16_t i=0; i<COLORS; i++) {
+				this->colors[i] = palette.get(i);
+			}
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COLOR CYCLING: ROTATE LENGTH ENTRIES STARTING AT FIRST, SO ENTRY
+		// FIRST + STEP MOVES DOWN TO FIRST. DONE IN PLACE WITH THREE REVERSALS
+		////////////////////////////////////////////////////////////////////////
+		void cycle(uint8_t step=1, uint8_t first=0, uint16_t length=COLORS) {
+			if (first >= COLORS) return;
+			length = _min(length, (uint16_t)(COLORS - first));
+			if (length < 2) return;
+
+			step %= length;
+			if (!step) return;
+
+			color_t *entries = this->colors + first;
+			reverse(entries, step);
+			reverse(entries + step, length - step);
+			reverse(entries, length);
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FADE: SET EVERY ENTRY PART WAY BETWEEN TWO ARRAYS OF COLORS
+		// ENTRIES. ALPHA 0 GIVES FROM, 255 GIVES TO
+		////////////////////////////////////////////////////////////////////////
+		void fade(const color_t *from, const color_t *to, uint8_t alpha) {
+			for (uint16_t i=0; i<COLORS; i++) {
+				this->colors[i] = color_t::lerp(from[i], to[i], alpha);
+			}
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// LOOK UP A SPAN OF THE STRIP INTO COLOR_T. RETURNS HOW MANY PIXELS
+		// WERE CONVERTED, WHICH IS LESS THAN LENGTH AT THE END
+		////////////////////////////////////////////////////////////////////////
+		size_t expand(color_t *dst, size_t first, size_t length) const {
+			if (first >= this->count) return 0;
+			length = _min(length, this->count - first);
+
+			if (BITS == 8) {
+				const uint8_t *in = this->indexes + first;
+				for (size_t i=0; i<length; i++) {
+					dst[i] = this->colors[in[i]];
+				}
+				return length;
+			}
+
+			size_t i = 0;
+			if (length  &&  (first & 1)) {
+				dst[i++] = this->color(first);
+			}
+
+			#if defined(__SSSE3__)
+			const size_t whole = (length - i) - (length - i) % 16;
+			this->expand_ssse3(this->indexes + ((first + i) >> 1), dst + i, whole);
+			i += whole;
+			#endif
+
+			for (; i<length; i++) {
+				dst[i] = this->color(first + i);
+			}
+
+			return length;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// LOOK UP AND ENCODE THE WHOLE STRIP INTO A WS2812B SPI STREAM,
+		// FOLLOWED BY RESET BYTES OF ZERO PADDING. OUT MUST HOLD
+		// COLOR_WS2812_SIZE3/4(COUNT, RESET) BYTES. RETURNS THE BYTES WRITTEN
+		////////////////////////////////////////////////////////////////////////
+		INLINE size_t encode3(uint8_t *out, size_t reset=0) const {
+			return this->stream(out, reset, color_ws2812_encode3_bytes);
+		}
+
+		INLINE size_t encode4(uint8_t *out, size_t reset=0) const {
+			return this->stream(out, reset, color_ws2812_encode4_bytes);
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// LOOK UP ONE BLOCK INTO A SMALL STACK BUFFER, THEN ENCODE IT
+		////////////////////////////////////////////////////////////////////////
+		template <class ENCODE>
+		INLINE size_t stream(uint8_t *out, size_t reset, ENCODE encode) const {
+			uint8_t	*end = out;
+			color_t	block[COLOR_INDEXED_BLOCK];
+
+			for (size_t i=0; i<this->count; i+=COLOR_INDEXED_BLOCK) {
+				const size_t length = this->expand(block, i, COLOR_INDEXED_BLOCK);
+				end = encode((const uint8_t*)block, length * sizeof(color_t), end);
+			}
+
+			memset(end, 0, reset);
+			return (end - out) + reset;
+		}
+
+
+
+
+		#if defined(__SSSE3__)
+		////////////////////////////////////////////////////////////////////////
+		// SSSE3 4-BIT LOOKUP, 16 PIXELS (8 BYTES IN, 48 BYTES OUT) PER LOOP.
+		// A 16 ENTRY PALETTE SPLIT INTO G, R, AND B PLANES FITS IN THREE
+		// REGISTERS, SO EACH CHANNEL IS ONE PSHUFB, AND THREE MORE PER OUTPUT
+		// VECTOR INTERLEAVE THEM. COUNT MUST BE A MULTIPLE OF 16
+		////////////////////////////////////////////////////////////////////////
+		INLINE void expand_ssse3(const uint8_t *in, color_t *dst, size_t count) const {
+			const __m128i g_plane	= _mm_loadu_si128((const __m128i*)this->planes[0]);
+			const __m128i r_plane	= _mm_loadu_si128((const __m128i*)this->planes[1]);
+			const __m128i b_plane	= _mm_loadu_si128((const __m128i*)this->planes[2]);
+			const __m128i nibble	= _mm_set1_epi8(0x0f);
+
+			// INTERLEAVE G, R, B INTO G0 R0 B0 G1 R1 B1 ..., THE SAME AS THE
+			// WS2812B ENCODER'S BIT GROUPS
+			const __m128i g0 = _mm_setr_epi8( 0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1,  5);
+			const __m128i r0 = _mm_setr_epi8(-1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1);
+			const __m128i b0 = _mm_setr_epi8(-1, -1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1);
+			const __m128i g1 = _mm_setr_epi8(-1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10, -1);
+			const __m128i r1 = _mm_setr_epi8( 5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10);
+			const __m128i b1 = _mm_setr_epi8(-1,  5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1);
+			const __m128i g2 = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+			const __m128i r2 = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+			const __m128i b2 = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+
+			for (size_t i=0; i<count; i+=16, in+=8) {
+				const __m128i packed	= _mm_loadl_epi64((const __m128i*)in);
+				const __m128i index		= _mm_unpacklo_epi8(
+					_mm_and_si128(packed, nibble),
+					_mm_and_si128(_mm_srli_epi16(packed, 4), nibble)
+				);
+
+				const __m128i g	= _mm_shuffle_epi8(g_plane, index);
+				const __m128i r	= _mm_shuffle_epi8(r_plane, index);
+				const __m128i b	= _mm_shuffle_epi8(b_plane, index);
+
+				__m128i *out = (__m128i*)(dst + i);
+				_mm_storeu_si128(out + 0, _mm_or_si128(_mm_or_si128(
+					_mm_shuffle_epi8(g, g0), _mm_shuffle_epi8(r, r0)), _mm_shuffle_epi8(b, b0)));
+				_mm_storeu_si128(out + 1, _mm_or_si128(_mm_or_si128(
+					_mm_shuffle_epi8(g, g1), _mm_shuffle_epi8(r, r1)), _mm_shuffle_epi8(b, b1)));
+				_mm_storeu_si128(out + 2, _mm_or_si128(_mm_or_si128(
+					_mm_shuffle_epi8(g, g2), _mm_shuffle_epi8(r, r2)), _mm_shuffle_epi8(b, b2)));
+			}
+		}
+		#endif
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// KEEP THE PER-CHANNEL PLANES USED BY THE SSSE3 LOOKUP IN STEP WITH
+		// THE PALETTE. NOTHING TO DO FOR 8-BIT OR WITHOUT SSSE3
+		////////////////////////////////////////////////////////////////////////
+		INLINE void update() {
+			#if defined(__SSSE3__)
+			if (BITS != 4) return;
+			for (uint8_t i=0; i<16; i++) {
+				this->planes[0][i] = this->colors[i & (COLORS - 1)].g;
+				this->planes[1][i] = this->colors[i & (COLORS - 1)].r;
+				this->planes[2][i] = this->colors[i & (COLORS - 1)].b;
+			}
+			#endif
+		}
+
+
+
+		static INLINE void reverse(color_t *entries, uint16_t length) {
+			for (uint16_t a=0, b=length-1; a<b; a++, b--) {
+				const color_t swap = entries[a];
+				entries[a] = entries[b];
+				entries[b] = swap;
+			}
+		}
+
+
+
+
+		uint8_t		*indexes;
+		size_t		count;
+		color_t		colors[COLORS];
+
+		#if defined(__SSSE3__)
+		uint8_t		planes[3][16];
+		#endif
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// INDEXED STRIP THAT OWNS ITS OWN INDEX STORAGE
+////////////////////////////////////////////////////////////////////////////////
+template <size_t COUNT, uint8_t BITS=4>
+class color_indexed_framebuffer_t : public color_indexed_strip_t<BITS> {
+	public:
+		color_indexed_framebuffer_t() : color_indexed_strip_t<BITS>(storage, COUNT) {
+			memset(storage, 0, sizeof(storage));
+		}
+
+		// THE BASE CLASS POINTS INTO THIS OBJECT, SO IT CANNOT BE COPIED
+		color_indexed_framebuffer_t(const color_indexed_framebuffer_t &) = delete;
+		color_indexed_framebuffer_t &operator =(const color_indexed_framebuffer_t &) = delete;
+
+	private:
+		uint8_t storage[(COUNT * BITS + 7) / 8];
+};
+
+
+
+
+#endif //__color_indexed_h__
@@ -0,0 +1,473 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| X/Y ADDRESSING FOR LED MATRICES WIRED AS ONE LONG STRIP. THE WIRING LAYOUT   |
+| (ROWS, COLUMNS, SERPENTINE, PANELS TILED INTO A LARGER DISPLAY, OR ANY MAP   |
+| AT ALL) IS TURNED INTO A LOOKUP TABLE ONCE, SO FINDING A PIXEL IS A SINGLE   |
+| TABLE READ. THE TABLE IS ALSO SCANNED FOR RUNS OF PIXELS THAT SIT NEXT TO    |
+| EACH OTHER IN MEMORY, FORWARDS OR BACKWARDS, SO RECTANGLE FILLS, BLITS, AND  |
+| SCROLLS MOVE WHOLE RUNS AT A TIME INSTEAD OF LOOKING UP EVERY PIXEL.         |
+|                                                                              |
+| X GOES LEFT TO RIGHT AND Y TOP TO BOTTOM, WITH 0,0 AT THE FIRST LED.         |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_matrix_h__
+#define __color_matrix_h__
+
+
+
+
+#include <stddef.h>
+#include <string.h>
+#include "color.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MAP ENTRY FOR A POSITION WITH NO LED BEHIND IT. WRITES THERE ARE DROPPED,
+// AND READS GIVE BLACK
+////////////////////////////////////////////////////////////////////////////////
+#define COLOR_MATRIX_NONE		0xffff
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// WIRING WITHIN A MATRIX (OR WITHIN EACH PANEL OF A TILED DISPLAY). ROWS RUN
+// LEFT TO RIGHT, COLUMNS TOP TO BOTTOM, AND THE SERPENTINE LAYOUTS REVERSE
+// EVERY SECOND ROW OR COLUMN
+////////////////////////////////////////////////////////////////////////////////
+enum COLOR_MATRIX_LAYOUT {
+	COLOR_MATRIX_ROWS,
+	COLOR_MATRIX_COLUMNS,
+	COLOR_MATRIX_SERPENTINE,
+	COLOR_MATRIX_COLUMNS_SERPENTINE,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// STRIP INDEX OF ONE POSITION IN A LAYOUT. PANELS OF PANEL_WIDTH BY
+// PANEL_HEIGHT ARE CHAINED ONE AFTER ANOTHER, LEFT TO RIGHT AND THEN TOP TO
+// BOTTOM, EACH WIRED WITH THE SAME LAYOUT. A PANEL SIZE OF 0 MEANS ONE PANEL
+////////////////////////////////////////////////////////////////////////////////
+inline uint16_t color_matrix_locate(COLOR_MATRIX_LAYOUT layout,
+		uint16_t width, uint16_t height, uint16_t x, uint16_t y,
+		uint16_t panel_width=0, uint16_t panel_height=0) {
+
+	uint16_t base = 0;
+
+	if (panel_width  &&  panel_height) {
+		const uint16_t across = width / panel_width;
+		base	= ((y / panel_height) * across + x / panel_width) * panel_width * panel_height;
+		x		%= panel_width;
+		y		%= panel_height;
+		width	= panel_width;
+		height	= panel_height;
+	}
+
+	const bool	columns	= layout == COLOR_MATRIX_COLUMNS  ||  layout == COLOR_MATRIX_COLUMNS_SERPENTINE;
+	const bool	snake	= layout == COLOR_MATRIX_SERPENTINE  ||  layout == COLOR_MATRIX_COLUMNS_SERPENTINE;
+	uint16_t	major	= columns ? x : y;
+	uint16_t	minor	= columns ? y : x;
+	uint16_t	length	= columns ? height : width;
+
+	if (snake  &&  (major & 1)) minor = length - 1 - minor;
+
+	return base + major * length + minor;
+}
+
+
+
+
+class color_matrix_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// PIXELS HOLDS COUNT LEDS, AND MAP HOLDS WIDTH * HEIGHT ENTRIES THAT
+		// ARE FILLED IN FROM THE LAYOUT. PANEL SIZES MUST DIVIDE THE MATRIX
+		// SIZE EXACTLY, OTHERWISE THE WHOLE MATRIX IS TREATED AS ONE PANEL
+		////////////////////////////////////////////////////////////////////////
+		color_matrix_t(color_t *pixels, size_t count, uint16_t width, uint16_t height, uint16_t *map,
+				COLOR_MATRIX_LAYOUT layout=COLOR_MATRIX_ROWS, uint16_t panel_width=0, uint16_t panel_height=0) {
+			this->pixels	= pixels;
+			this->count		= count;
+			this->columns	= width;
+			this->rows		= height;
+			this->table		= map;
+			this->layout(layout, panel_width, panel_height);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// REBUILD THE MAP FOR A DIFFERENT LAYOUT
+		////////////////////////////////////////////////////////////////////////
+		void layout(COLOR_MATRIX_LAYOUT layout, uint16_t panel_width=0, uint16_t panel_height=0) {
+			if (!panel_width  ||  !panel_height
+			||  this->columns % panel_width  ||  this->rows % panel_height) {
+				panel_width = panel_height = 0;
+			}
+
+			for (uint16_t y=0; y<this->rows; y++) {
+				for (uint16_t x=0; x<this->columns; x++) {
+					const uint16_t index = color_matrix_locate(layout, this->columns, this->rows, x, y, panel_width, panel_height);
+					this->table[y * this->columns + x] = index < this->count ? index : COLOR_MATRIX_NONE;
+				}
+			}
+
+			this->update();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// USE ANY MAP AT ALL, WIDTH * HEIGHT STRIP INDEXES IN ROW ORDER. AN
+		// ENTRY OF COLOR_MATRIX_NONE (OR PAST THE END OF THE STRIP) IS A GAP
+		////////////////////////////////////////////////////////////////////////
+		void remap(const uint16_t *lookup) {
+			const size_t total = (size_t)this->columns * this->rows;
+			for (size_t i=0; i<total; i++) {
+				this->table[i] = lookup[i] < this->count ? lookup[i] : COLOR_MATRIX_NONE;
+			}
+
+			this->update();
+		}
+
+
+
+
+		INLINE uint16_t width() const {
+			return this->columns;
+		}
+
+		INLINE uint16_t height() const {
+			return this->rows;
+		}
+
+		INLINE color_t *data() {
+			return this->pixels;
+		}
+
+		INLINE const uint16_t *map() const {
+			return this->table;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// LENGTH OF THE RUNS EACH ROW IS SPLIT INTO. THE WIDTH FOR PLAIN AND
+		// SERPENTINE ROWS, THE PANEL WIDTH FOR TILED ROWS, 1 FOR COLUMNS
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint16_t run() const {
+			return this->span;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SINGLE PIXEL ACCESS. OUT OF RANGE WRITES ARE DROPPED, READS GIVE
+		// BLACK, AND INDEX() GIVES COLOR_MATRIX_NONE
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint16_t index(int16_t x, int16_t y) const {
+			if (x < 0  ||  y < 0  ||  x >= this->columns  ||  y >= this->rows) {
+				return COLOR_MATRIX_NONE;
+			}
+			return this->table[y * this->columns + x];
+		}
+
+		INLINE color_t get(int16_t x, int16_t y) const {
+			const uint16_t index = this->index(x, y);
+			return index == COLOR_MATRIX_NONE ? color_t() : this->pixels[index];
+		}
+
+		INLINE void set(int16_t x, int16_t y, const color_t color) {
+			const uint16_t index = this->index(x, y);
+			if (index != COLOR_MATRIX_NONE) this->pixels[index] = color;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FILL A RECTANGLE, CLIPPED TO THE MATRIX
+		////////////////////////////////////////////////////////////////////////
+		INLINE void fill(const color_t color) {
+			this->fill(0, 0, this->columns, this->rows, color);
+		}
+
+		void fill(int16_t x, int16_t y, int16_t w, int16_t h, const color_t color) {
+			int16_t sx = 0, sy = 0;
+			if (!this->clip(x, y, w, h, sx, sy)) return;
+
+			for (int16_t row=y; row<y+h; row++) {
+				for (uint16_t a=x; a<x+w; ) {
+					uint16_t length;
+					int8_t step;
+					color_t *out = this->segment(row, a, x + w, length, step);
+
+					if (!out) {
+						a++;
+						continue;
+					}
+
+					if (step < 0) out -= length - 1;
+					for (uint16_t i=0; i<length; i++) out[i] = color;
+					a += length;
+				}
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COPY A ROW-MAJOR IMAGE OF W BY H PIXELS, STRIDE PIXELS PER ROW, TO
+		// X,Y ON THE MATRIX. PARTS OF THE IMAGE OFF THE MATRIX ARE CLIPPED
+		////////////////////////////////////////////////////////////////////////
+		void blit(const color_t *image, uint16_t stride, int16_t x, int16_t y, int16_t w, int16_t h) {
+			int16_t sx = 0, sy = 0;
+			if (!this->clip(x, y, w, h, sx, sy)) return;
+
+			for (int16_t row=0; row<h; row++) {
+				const color_t *in = image + (size_t)(sy + row) * stride + sx;
+
+				for (uint16_t a=x; a<x+w; ) {
+					uint16_t length;
+					int8_t step;
+					color_t *out = this->segment(y + row, a, x + w, length, step);
+
+					if (!out) {
+						a++;
+						continue;
+					}
+
+					copy(out, step, in + (a - x), 1, length);
+					a += length;
+				}
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SCROLL THE WHOLE MATRIX BY DX,DY. POSITIVE VALUES MOVE THE PICTURE
+		// RIGHT AND DOWN. THE AREA SCROLLED IN IS FILLED WITH A COLOR
+		////////////////////////////////////////////////////////////////////////
+		void scroll(int16_t dx, int16_t dy, const color_t color=color_t()) {
+			const int16_t w = this->columns;
+			const int16_t h = this->rows;
+
+			if (dx <= -w  ||  dx >= w  ||  dy <= -h  ||  dy >= h) {
+				this->fill(color);
+				return;
+			}
+
+			// WORK AWAY FROM THE SIDE BEING MOVED ONTO, SO NOTHING IS
+			// OVERWRITTEN BEFORE IT HAS BEEN READ
+			const int16_t first	= dy > 0 ? h - 1 : 0;
+			const int16_t last	= dy > 0 ? dy - 1 : h + dy;
+			const int16_t next	= dy > 0 ? -1 : 1;
+
+			for (int16_t y=first; y!=last; y+=next) {
+				this->shift(y, y - dy, dx);
+			}
+
+			if (dy > 0) this->fill(0, 0, w, dy, color);
+			if (dy < 0) this->fill(0, h + dy, w, -dy, color);
+			if (dx > 0) this->fill(0, 0, dx, h, color);
+			if (dx < 0) this->fill(w + dx, 0, -dx, h, color);
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// FIND THE LONGEST RUN LENGTH THAT SPLITS EVERY ROW INTO PIECES THAT
+		// ARE EACH CONTIGUOUS IN MEMORY, EITHER FORWARDS OR BACKWARDS
+		////////////////////////////////////////////////////////////////////////
+		void update() {
+			for (this->span=this->columns; this->span>1; this->span--) {
+				if (this->columns % this->span == 0  &&  this->contiguous(this->span)) return;
+			}
+			this->span = 1;
+		}
+
+		bool contiguous(uint16_t length) const {
+			for (uint16_t y=0; y<this->rows; y++) {
+				const uint16_t *row = this->table + y * this->columns;
+
+				for (uint16_t x=0; x<this->columns; x+=length) {
+					if (row[x] == COLOR_MATRIX_NONE) return false;
+					const int32_t step = (int32_t)row[x + 1] - row[x];
+					if (step != 1  &&  step != -1) return false;
+
+					for (uint16_t i=x+1; i<x+length; i++) {
+						if (row[i] == COLOR_MATRIX_NONE) return false;
+						if ((int32_t)row[i] - row[i - 1] != step) return false;
+					}
+				}
+			}
+			return true;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// THE PIECE OF A ROW FROM X UP TO (NOT INCLUDING) END THAT IS
+		// CONTIGUOUS IN MEMORY. RETURNS A POINTER TO THE PIXEL FOR X, WITH
+		// STEP SAYING WHICH WAY THE REST FOLLOW, OR NULLPTR FOR A GAP
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_t *segment(uint16_t y, uint16_t x, uint16_t end, uint16_t &length, int8_t &step) const {
+			const uint16_t	*row	= this->table + y * this->columns;
+			const uint16_t	start	= x - x % this->span;
+
+			length	= 1;
+			step	= 1;
+			if (row[x] == COLOR_MATRIX_NONE) return nullptr;
+
+			length	= _min(end, (uint16_t)(start + this->span)) - x;
+			if (this->span > 1  &&  row[start + 1] < row[start]) step = -1;
+
+			return this->pixels + row[x];
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CLIP A RECTANGLE TO THE MATRIX. SX,SY SAY HOW FAR THE TOP LEFT
+		// CORNER MOVED, FOR OFFSETTING INTO A SOURCE IMAGE
+		////////////////////////////////////////////////////////////////////////
+		INLINE bool clip(int16_t &x, int16_t &y, int16_t &w, int16_t &h, int16_t &sx, int16_t &sy) const {
+			if (x < 0) { sx = -x; w += x; x = 0; }
+			if (y < 0) { sy = -y; h += y; y = 0; }
+			w = _min(w, (int16_t)(this->columns - x));
+			h = _min(h, (int16_t)(this->rows - y));
+			return w > 0  &&  h > 0;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COPY N PIXELS BETWEEN TWO RUNS, EACH GOING FORWARDS OR BACKWARDS
+		// FROM THE POINTER GIVEN. THE RUNS MAY OVERLAP IF THEY GO THE SAME WAY
+		////////////////////////////////////////////////////////////////////////
+		static INLINE void copy(color_t *out, int8_t out_step, const color_t *in, int8_t in_step, uint16_t n) {
+			if (out_step == in_step) {
+				if (out_step < 0) {
+					out	-= n - 1;
+					in	-= n - 1;
+				}
+				memmove((void*)out, in, n * sizeof(color_t));
+				return;
+			}
+
+			for (uint16_t i=0; i<n; i++) {
+				*out	= *in;
+				out		+= out_step;
+				in		+= in_step;
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COPY ROW FROM INTO ROW TO, MOVED DX TO THE RIGHT, A RUN AT A TIME
+		// WHEN THE RUNS OF BOTH ROWS LINE UP. TWO DIFFERENT ROWS NEVER SHARE A
+		// PIXEL, AND A ROW MOVED ALONG ITSELF IS ONLY DONE THIS WAY WHEN IT IS
+		// ONE RUN (ONE MEMMOVE). ANYTHING ELSE GOES PIXEL BY PIXEL, IN THE
+		// ORDER THAT NEVER OVERWRITES A PIXEL STILL TO BE READ
+		////////////////////////////////////////////////////////////////////////
+		void shift(int16_t to, int16_t from, int16_t dx) {
+			const int16_t	w		= this->columns;
+			const int16_t	length	= w - (dx < 0 ? -dx : dx);
+			const int16_t	src		= dx < 0 ? -dx : 0;
+			const int16_t	dst		= dx < 0 ? 0 : dx;
+
+			if (this->span == w  ||  (to != from  &&  dx % this->span == 0)) {
+				for (int16_t x=0; x<length; ) {
+					uint16_t	out_length, in_length;
+					int8_t		out_step, in_step;
+					color_t		*out	= this->segment(to, dst + x, dst + length, out_length, out_step);
+					color_t		*in		= this->segment(from, src + x, src + length, in_length, in_step);
+
+					if (!out) {
+						x++;
+					} else if (!in) {
+						*out = color_t();
+						x++;
+					} else {
+						const uint16_t n = _min(out_length, in_length);
+						copy(out, out_step, in, in_step, n);
+						x += n;
+					}
+				}
+				return;
+			}
+
+			const uint16_t *a = this->table + to * w;
+			const uint16_t *b = this->table + from * w;
+
+			for (int16_t i=0; i<length; i++) {
+				const int16_t x = dx > 0 ? length - 1 - i : i;
+				if (a[dst + x] == COLOR_MATRIX_NONE) continue;
+				this->pixels[a[dst + x]] = b[src + x] == COLOR_MATRIX_NONE
+					? color_t()
+					: this->pixels[b[src + x]];
+			}
+		}
+
+
+
+
+		color_t			*pixels;
+		size_t			count;
+		uint16_t		*table;
+		uint16_t		columns;
+		uint16_t		rows;
+		uint16_t		span;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MATRIX THAT OWNS ITS OWN PIXELS AND MAP
+////////////////////////////////////////////////////////////////////////////////
+template <uint16_t WIDTH, uint16_t HEIGHT>
+class color_matrix_framebuffer_t : public color_matrix_t {
+	public:
+		color_matrix_framebuffer_t(COLOR_MATRIX_LAYOUT layout=COLOR_MATRIX_ROWS, uint16_t panel_width=0, uint16_t panel_height=0)
+			: color_matrix_t(storage, WIDTH * HEIGHT, WIDTH, HEIGHT, lookup, layout, panel_width, panel_height) {}
+
+		// THE BASE CLASS POINTS INTO THIS OBJECT, SO IT CANNOT BE COPIED
+		color_matrix_framebuffer_t(const color_matrix_framebuffer_t &) = delete;
+		color_matrix_framebuffer_t &operator =(const color_matrix_framebuffer_t &) = delete;
+
+	private:
+		color_t		storage[WIDTH * HEIGHT];
+		uint16_t	lookup[WIDTH * HEIGHT];
+};
+
+
+
+
+#endif //__color_matrix_h__
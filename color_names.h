@@ -0,0 +1,130 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| LOOKUP OF THE VGA AND X11 NAMED COLORS BY THEIR NAME AS A STRING.            |
+| THE NAMES ARE STORED IN A MINIMAL PERFECT HASH TABLE (COLOR_NAMES_TABLE.H),  |
+| SO A LOOKUP IS ONE HASH OF THE NAME, ONE SEED READ, AND ONE COMPARE, WITH    |
+| NO HEAP USE. EVERYTHING IS IN PROGMEM. AFTER CHANGING THE NAMED COLORS IN    |
+| COLOR.H, RUN TOOLS/COLOR_NAMES.PY TO REBUILD THE TABLE.                      |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_names_h__
+#define __color_names_h__
+
+
+
+
+#include "color.h"
+#include "color_names_table.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ASCII LOWER CASE, WITHOUT DEPENDING ON THE C LOCALE
+////////////////////////////////////////////////////////////////////////////////
+INLINE char color_names_lower(const char c) {
+	return (c >= 'A'  &&  c <= 'Z') ? (c - 'A' + 'a') : c;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FNV-1A OVER THE LOWER-CASED NAME - MUST MATCH TOOLS/COLOR_NAMES.PY
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint32_t color_names_hash(const char *name) {
+	uint32_t hash = 2166136261ul;
+	while (*name) {
+		hash = (hash ^ (uint8_t)color_names_lower(*name++)) * 16777619ul;
+	}
+	return hash;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MURMUR3 FINALIZER MIXED WITH A BUCKET SEED - MUST MATCH TOOLS/COLOR_NAMES.PY
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint32_t color_names_mix(uint32_t hash, const uint8_t seed) {
+	hash ^= seed * 0x9e3779b9ul;
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bul;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35ul;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FIND THE TABLE SLOT FOR A NAME, OR -1 IF IT IS NOT A NAMED COLOR
+////////////////////////////////////////////////////////////////////////////////
+inline int16_t color_names_find(const char *name) {
+	if (!name  ||  !*name) return -1;
+
+	// ANYTHING LONGER THAN THE LONGEST NAME CAN'T MATCH, SO DON'T HASH IT
+	for (uint8_t i=0; name[i]; i++) {
+		if (i >= COLOR_NAMES_LONGEST) return -1;
+	}
+
+	const uint32_t	hash	= color_names_hash(name);
+	const uint8_t	seed	= pgm_read_byte(&color_names_seed[hash % COLOR_NAMES_BUCKETS]);
+	const uint16_t	slot	= color_names_mix(hash, seed) % COLOR_NAMES_COUNT;
+	const char		*text	= color_names_text + pgm_read_word(&color_names_offset[slot]);
+
+	// A PERFECT HASH ONLY SEPARATES KNOWN NAMES, SO CONFIRM IT IS THIS ONE
+	for (;; name++, text++) {
+		const char c = pgm_read_byte(text);
+		if (c != color_names_lower(*name)) return -1;
+		if (!c) return slot;
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// GET A COLOR FROM ITS NAME, SUCH AS "AliceBlue" OR "antiquewhite3"
+////////////////////////////////////////////////////////////////////////////////
+inline bool color_t::from_name(const char *name, color_t &color) {
+	const int16_t slot = color_names_find(name);
+	if (slot < 0) return false;
+
+	color = color_t::progmem(&color_names_colors[slot]);
+	return true;
+}
+
+inline color_t color_t::from_name(const char *name) {
+	color_t color;
+	color_t::from_name(name, color);
+	return color;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// GET THE NAME OF A TABLE SLOT, FOR ITERATING OVER EVERY NAMED COLOR.
+// THE RETURNED POINTER IS INTO PROGMEM
+////////////////////////////////////////////////////////////////////////////////
+INLINE const char *color_names_name(const uint16_t slot) {
+	return color_names_text + pgm_read_word(&color_names_offset[slot]);
+}
+
+INLINE color_t color_names_color(const uint16_t slot) {
+	return color_t::progmem(&color_names_colors[slot]);
+}
+
+
+
+
+#endif //__color_names_h__
@@ -0,0 +1,1865 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| GENERATED BY TOOLS/COLOR_NAMES.PY FROM COLOR.H - DO NOT EDIT BY HAND.        |
+| MINIMAL PERFECT HASH TABLE OF EVERY NAMED COLOR, SEE COLOR_NAMES.H.          |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_names_table_h__
+#define __color_names_table_h__
+
+
+
+
+#define COLOR_NAMES_COUNT		562
+#define COLOR_NAMES_BUCKETS		242
+#define COLOR_NAMES_LONGEST		20
+
+
+
+
+// PER-BUCKET SEEDS
+static CONST uint8_t color_names_seed[COLOR_NAMES_BUCKETS] = {
+	 18,   0,   6,   3,   3,   9,  11,   1,   4,   2,   3,  11,   3,   0,  25,   5,
+	  8,  27,   1,   0,  11,   5,  22,   3,  10,   0,  23,  11,   2,  38,  34,   5,
+	 12,   1,  24,   7,   3,   0,   8,  30,  23,  17,  20,   3,  39,   3,   2,   0,
+	  1,   8,   2,   0,   0,  10,   6,   3,   2,  17,   6,  15,  33,   4,  15,  11,
+	  0,   5,   4,  22,  17,   6,   3,  21,   4,   0,   5,   0,   3,   1,  66,   0,
+	 14,   0,   0,   1,  10,   3,   4,  23,   0,   0,   0,   0,   0,  10,  19,   0,
+	  1,   0,   5,   1,   0,   8,  21,   0,  11,   0,   0,   0,   9,  40,  12,  44,
+	  7,   2,   0,   6,   0,   0,   4,   2,  20,   1,  31,   5,  28,   6,  11,   5,
+	  9,  72,   0,  37,   3,   4,  10,   5,   2,  17,   7,   0,   0,   3,  30,  48,
+	 31,  28,   0,   0, 109,   0,   0,   0,   2,   2,   0,   8,   0,   0,   5,  23,
+	  0,  16,  36,  31,   1,  36,   0,  52,   0,  30,   0,   2,  47,   6,  13,  59,
+	  0,   1,  78,   0,   1,  33,   1,   4,  29,   3,   1,  21,   4,  54,  32,  14,
+	 23,  31,  13,   1,  19,  22,  15,   0,   2,  22,  14,  17,  12,   1,   1,   2,
+	 10,   1,   0,   9,  12, 113,  39,  31,  26,  15,  22,  34,  36, 154,  41,   0,
+	 25, 106, 131,  42,  62, 127,  53, 118, 193,   0,  68,  11,  12, 247,   3,  15,
+	 13,   5,
+};
+
+
+
+
+// SLOT OF EACH NAMED COLOR, IN THE ORDER THEY ARE DECLARED IN COLOR.H
+enum COLOR_NAME : uint16_t {
+	COLOR_NAME_BLACK				= 289,
+	COLOR_NAME_WHITE				= 140,
+	COLOR_NAME_RED					= 342,
+	COLOR_NAME_YELLOW				= 343,
+	COLOR_NAME_LIME					= 67,
+	COLOR_NAME_AQUA					= 367,
+	COLOR_NAME_BLUE					= 426,
+	COLOR_NAME_FUCHSIA				= 169,
+	COLOR_NAME_ORANGE				= 448,
+	COLOR_NAME_GRAY					= 211,
+	COLOR_NAME_SILVER				= 418,
+	COLOR_NAME_MAROON				= 391,
+	COLOR_NAME_OLIVE				= 551,
+	COLOR_NAME_GREEN				= 62,
+	COLOR_NAME_TEAL					= 536,
+	COLOR_NAME_NAVY					= 516,
+	COLOR_NAME_PURPLE				= 279,
+	COLOR_NAME_ALICEBLUE			= 245,
+	COLOR_NAME_ANTIQUEWHITE			= 57,
+	COLOR_NAME_ANTIQUEWHITE1		= 278,
+	COLOR_NAME_ANTIQUEWHITE2		= 26,
+	COLOR_NAME_ANTIQUEWHITE3		= 508,
+	COLOR_NAME_ANTIQUEWHITE4		= 235,
+	COLOR_NAME_AQUAMARINE			= 157,
+	COLOR_NAME_AQUAMARINE1			= 511,
+	COLOR_NAME_AQUAMARINE2			= 200,
+	COLOR_NAME_AQUAMARINE4			= 501,
+	COLOR_NAME_AZURE				= 286,
+	COLOR_NAME_AZURE1				= 58,
+	COLOR_NAME_AZURE2				= 415,
+	COLOR_NAME_AZURE3				= 314,
+	COLOR_NAME_AZURE4				= 146,
+	COLOR_NAME_BEIGE				= 450,
+	COLOR_NAME_BISQUE				= 238,
+	COLOR_NAME_BISQUE1				= 409,
+	COLOR_NAME_BISQUE2				= 535,
+	COLOR_NAME_BISQUE3				= 295,
+	COLOR_NAME_BISQUE4				= 338,
+	COLOR_NAME_BLANCHEDALMOND		= 54,
+	COLOR_NAME_BLUE1				= 452,
+	COLOR_NAME_BLUE2				= 298,
+	COLOR_NAME_BLUE4				= 402,
+	COLOR_NAME_BLUEVIOLET			= 369,
+	COLOR_NAME_BROWN				= 203,
+	COLOR_NAME_BROWN1				= 175,
+	COLOR_NAME_BROWN2				= 312,
+	COLOR_NAME_BROWN3				= 9,
+	COLOR_NAME_BROWN4				= 272,
+	COLOR_NAME_BURLYWOOD			= 277,
+	COLOR_NAME_BURLYWOOD1			= 39,
+	COLOR_NAME_BURLYWOOD2			= 78,
+	COLOR_NAME_BURLYWOOD3			= 557,
+	COLOR_NAME_BURLYWOOD4			= 37,
+	COLOR_NAME_CADETBLUE			= 230,
+	COLOR_NAME_CADETBLUE1			= 319,
+	COLOR_NAME_CADETBLUE2			= 248,
+	COLOR_NAME_CADETBLUE3			= 530,
+	COLOR_NAME_CADETBLUE4			= 422,
+	COLOR_NAME_CHARTREUSE			= 64,
+	COLOR_NAME_CHARTREUSE1			= 142,
+	COLOR_NAME_CHARTREUSE2			= 519,
+	COLOR_NAME_CHARTREUSE3			= 428,
+	COLOR_NAME_CHARTREUSE4			= 379,
+	COLOR_NAME_CHOCOLATE			= 365,
+	COLOR_NAME_CHOCOLATE1			= 457,
+	COLOR_NAME_CHOCOLATE2			= 421,
+	COLOR_NAME_CHOCOLATE3			= 317,
+	COLOR_NAME_CORAL				= 325,
+	COLOR_NAME_CORAL1				= 339,
+	COLOR_NAME_CORAL2				= 38,
+	COLOR_NAME_CORAL3				= 444,
+	COLOR_NAME_CORAL4				= 463,
+	COLOR_NAME_CORNFLOWERBLUE		= 255,
+	COLOR_NAME_CORNSILK				= 528,
+	COLOR_NAME_CORNSILK1			= 33,
+	COLOR_NAME_CORNSILK2			= 118,
+	COLOR_NAME_CORNSILK3			= 284,
+	COLOR_NAME_CORNSILK4			= 522,
+	COLOR_NAME_CRIMSON				= 192,
+	COLOR_NAME_CYAN					= 270,
+	COLOR_NAME_CYAN1				= 524,
+	COLOR_NAME_CYAN2				= 333,
+	COLOR_NAME_CYAN3				= 5,
+	COLOR_NAME_CYAN4				= 182,
+	COLOR_NAME_DARKBLUE				= 69,
+	COLOR_NAME_DARKCYAN				= 276,
+	COLOR_NAME_DARKGOLDENROD		= 31,
+	COLOR_NAME_DARKGOLDENROD1		= 509,
+	COLOR_NAME_DARKGOLDENROD2		= 474,
+	COLOR_NAME_DARKGOLDENROD3		= 77,
+	COLOR_NAME_DARKGOLDENROD4		= 41,
+	COLOR_NAME_DARKGRAY				= 368,
+	COLOR_NAME_DARKGREEN			= 233,
+	COLOR_NAME_DARKGREY				= 104,
+	COLOR_NAME_DARKKHAKI			= 303,
+	COLOR_NAME_DARKMAGENTA			= 258,
+	COLOR_NAME_DARKOLIVEGREEN		= 326,
+	COLOR_NAME_DARKOLIVEGREEN1		= 70,
+	COLOR_NAME_DARKOLIVEGREEN2		= 173,
+	COLOR_NAME_DARKOLIVEGREEN3		= 410,
+	COLOR_NAME_DARKOLIVEGREEN4		= 461,
+	COLOR_NAME_DARKORANGE			= 76,
+	COLOR_NAME_DARKORANGE1			= 165,
+	COLOR_NAME_DARKORANGE2			= 560,
+	COLOR_NAME_DARKORANGE3			= 21,
+	COLOR_NAME_DARKORANGE4			= 28,
+	COLOR_NAME_DARKORCHID			= 241,
+	COLOR_NAME_DARKORCHID1			= 250,
+	COLOR_NAME_DARKORCHID2			= 510,
+	COLOR_NAME_DARKORCHID3			= 222,
+	COLOR_NAME_DARKORCHID4			= 194,
+	COLOR_NAME_DARKRED				= 143,
+	COLOR_NAME_DARKSALMON			= 503,
+	COLOR_NAME_DARKSEAGREEN			= 283,
+	COLOR_NAME_DARKSEAGREEN1		= 51,
+	COLOR_NAME_DARKSEAGREEN2		= 188,
+	COLOR_NAME_DARKSEAGREEN3		= 7,
+	COLOR_NAME_DARKSEAGREEN4		= 180,
+	COLOR_NAME_DARKSLATEBLUE		= 323,
+	COLOR_NAME_DARKSLATEGRAY		= 377,
+	COLOR_NAME_DARKSLATEGRAY1		= 152,
+	COLOR_NAME_DARKSLATEGRAY2		= 454,
+	COLOR_NAME_DARKSLATEGRAY3		= 164,
+	COLOR_NAME_DARKSLATEGRAY4		= 311,
+	COLOR_NAME_DARKSLATEGREY		= 121,
+	COLOR_NAME_DARKTURQUOISE		= 172,
+	COLOR_NAME_DARKVIOLET			= 310,
+	COLOR_NAME_DEEPPINK				= 432,
+	COLOR_NAME_DEEPPINK1			= 168,
+	COLOR_NAME_DEEPPINK2			= 313,
+	COLOR_NAME_DEEPPINK3			= 93,
+	COLOR_NAME_DEEPPINK4			= 267,
+	COLOR_NAME_DEEPSKYBLUE			= 141,
+	COLOR_NAME_DEEPSKYBLUE1			= 435,
+	COLOR_NAME_DEEPSKYBLUE2			= 458,
+	COLOR_NAME_DEEPSKYBLUE3			= 491,
+	COLOR_NAME_DEEPSKYBLUE4			= 19,
+	COLOR_NAME_DIMGRAY				= 401,
+	COLOR_NAME_DIMGREY				= 345,
+	COLOR_NAME_DODGERBLUE			= 321,
+	COLOR_NAME_DODGERBLUE1			= 133,
+	COLOR_NAME_DODGERBLUE2			= 436,
+	COLOR_NAME_DODGERBLUE3			= 268,
+	COLOR_NAME_DODGERBLUE4			= 244,
+	COLOR_NAME_FIREBRICK			= 302,
+	COLOR_NAME_FIREBRICK1			= 99,
+	COLOR_NAME_FIREBRICK2			= 176,
+	COLOR_NAME_FIREBRICK3			= 226,
+	COLOR_NAME_FIREBRICK4			= 539,
+	COLOR_NAME_FLORALWHITE			= 136,
+	COLOR_NAME_FORESTGREEN			= 273,
+	COLOR_NAME_GAINSBORO			= 181,
+	COLOR_NAME_GHOSTWHITE			= 288,
+	COLOR_NAME_GOLD					= 22,
+	COLOR_NAME_GOLD1				= 217,
+	COLOR_NAME_GOLD2				= 332,
+	COLOR_NAME_GOLD3				= 400,
+	COLOR_NAME_GOLD4				= 218,
+	COLOR_NAME_GOLDENROD			= 466,
+	COLOR_NAME_GOLDENROD1			= 137,
+	COLOR_NAME_GOLDENROD2			= 534,
+	COLOR_NAME_GOLDENROD3			= 25,
+	COLOR_NAME_GOLDENROD4			= 556,
+	COLOR_NAME_GRAY0				= 388,
+	COLOR_NAME_GRAY1				= 132,
+	COLOR_NAME_GRAY2				= 403,
+	COLOR_NAME_GRAY3				= 68,
+	COLOR_NAME_GRAY4				= 216,
+	COLOR_NAME_GRAY5				= 106,
+	COLOR_NAME_GRAY6				= 201,
+	COLOR_NAME_GRAY7				= 460,
+	COLOR_NAME_GRAY8				= 47,
+	COLOR_NAME_GRAY9				= 499,
+	COLOR_NAME_GRAY10				= 397,
+	COLOR_NAME_GRAY11				= 434,
+	COLOR_NAME_GRAY12				= 20,
+	COLOR_NAME_GRAY13				= 327,
+	COLOR_NAME_GRAY14				= 430,
+	COLOR_NAME_GRAY15				= 419,
+	COLOR_NAME_GRAY16				= 553,
+	COLOR_NAME_GRAY17				= 14,
+	COLOR_NAME_GRAY18				= 83,
+	COLOR_NAME_GRAY19				= 446,
+	COLOR_NAME_GRAY20				= 309,
+	COLOR_NAME_GRAY21				= 92,
+	COLOR_NAME_GRAY22				= 98,
+	COLOR_NAME_GRAY23				= 374,
+	COLOR_NAME_GRAY24				= 127,
+	COLOR_NAME_GRAY25				= 378,
+	COLOR_NAME_GRAY26				= 11,
+	COLOR_NAME_GRAY27				= 549,
+	COLOR_NAME_GRAY28				= 60,
+	COLOR_NAME_GRAY29				= 153,
+	COLOR_NAME_GRAY30				= 179,
+	COLOR_NAME_GRAY31				= 527,
+	COLOR_NAME_GRAY32				= 209,
+	COLOR_NAME_GRAY33				= 420,
+	COLOR_NAME_GRAY34				= 269,
+	COLOR_NAME_GRAY35				= 361,
+	COLOR_NAME_GRAY36				= 247,
+	COLOR_NAME_GRAY37				= 81,
+	COLOR_NAME_GRAY38				= 408,
+	COLOR_NAME_GRAY39				= 341,
+	COLOR_NAME_GRAY40				= 529,
+	COLOR_NAME_GRAY41				= 318,
+	COLOR_NAME_GRAY42				= 531,
+	COLOR_NAME_GRAY43				= 301,
+	COLOR_NAME_GRAY44				= 383,
+	COLOR_NAME_GRAY45				= 155,
+	COLOR_NAME_GRAY46				= 396,
+	COLOR_NAME_GRAY47				= 220,
+	COLOR_NAME_GRAY48				= 107,
+	COLOR_NAME_GRAY49				= 246,
+	COLOR_NAME_GRAY50				= 103,
+	COLOR_NAME_GRAY51				= 385,
+	COLOR_NAME_GRAY52				= 478,
+	COLOR_NAME_GRAY53				= 442,
+	COLOR_NAME_GRAY54				= 336,
+	COLOR_NAME_GRAY55				= 178,
+	COLOR_NAME_GRAY56				= 540,
+	COLOR_NAME_GRAY57				= 281,
+	COLOR_NAME_GRAY58				= 122,
+	COLOR_NAME_GRAY59				= 131,
+	COLOR_NAME_GRAY60				= 349,
+	COLOR_NAME_GRAY61				= 151,
+	COLOR_NAME_GRAY62				= 148,
+	COLOR_NAME_GRAY63				= 48,
+	COLOR_NAME_GRAY64				= 479,
+	COLOR_NAME_GRAY65				= 413,
+	COLOR_NAME_GRAY66				= 407,
+	COLOR_NAME_GRAY67				= 425,
+	COLOR_NAME_GRAY68				= 16,
+	COLOR_NAME_GRAY69				= 520,
+	COLOR_NAME_GRAY70				= 61,
+	COLOR_NAME_GRAY71				= 541,
+	COLOR_NAME_GRAY72				= 120,
+	COLOR_NAME_GRAY73				= 299,
+	COLOR_NAME_GRAY74				= 253,
+	COLOR_NAME_GRAY75				= 73,
+	COLOR_NAME_GRAY76				= 331,
+	COLOR_NAME_GRAY77				= 285,
+	COLOR_NAME_GRAY78				= 472,
+	COLOR_NAME_GRAY79				= 405,
+	COLOR_NAME_GRAY80				= 55,
+	COLOR_NAME_GRAY81				= 346,
+	COLOR_NAME_GRAY82				= 476,
+	COLOR_NAME_GRAY83				= 495,
+	COLOR_NAME_GRAY84				= 75,
+	COLOR_NAME_GRAY85				= 199,
+	COLOR_NAME_GRAY86				= 124,
+	COLOR_NAME_GRAY87				= 505,
+	COLOR_NAME_GRAY88				= 158,
+	COLOR_NAME_GRAY89				= 32,
+	COLOR_NAME_GRAY90				= 166,
+	COLOR_NAME_GRAY91				= 160,
+	COLOR_NAME_GRAY92				= 429,
+	COLOR_NAME_GRAY93				= 485,
+	COLOR_NAME_GRAY94				= 532,
+	COLOR_NAME_GRAY95				= 108,
+	COLOR_NAME_GRAY97				= 471,
+	COLOR_NAME_GRAY98				= 91,
+	COLOR_NAME_GRAY99				= 404,
+	COLOR_NAME_GREEN1				= 559,
+	COLOR_NAME_GREEN2				= 24,
+	COLOR_NAME_GREEN3				= 190,
+	COLOR_NAME_GREEN4				= 205,
+	COLOR_NAME_GREENYELLOW			= 451,
+	COLOR_NAME_GREY					= 324,
+	COLOR_NAME_HONEYDEW				= 112,
+	COLOR_NAME_HONEYDEW1			= 210,
+	COLOR_NAME_HONEYDEW2			= 6,
+	COLOR_NAME_HONEYDEW3			= 159,
+	COLOR_NAME_HONEYDEW4			= 259,
+	COLOR_NAME_HOTPINK				= 494,
+	COLOR_NAME_HOTPINK1				= 512,
+	COLOR_NAME_HOTPINK2				= 477,
+	COLOR_NAME_HOTPINK3				= 212,
+	COLOR_NAME_HOTPINK4				= 117,
+	COLOR_NAME_INDIANRED			= 162,
+	COLOR_NAME_INDIANRED1			= 381,
+	COLOR_NAME_INDIANRED2			= 433,
+	COLOR_NAME_INDIANRED3			= 366,
+	COLOR_NAME_INDIANRED4			= 237,
+	COLOR_NAME_INDIGO				= 189,
+	COLOR_NAME_IVORY				= 27,
+	COLOR_NAME_IVORY1				= 149,
+	COLOR_NAME_IVORY2				= 480,
+	COLOR_NAME_IVORY3				= 360,
+	COLOR_NAME_IVORY4				= 497,
+	COLOR_NAME_KHAKI				= 223,
+	COLOR_NAME_KHAKI1				= 462,
+	COLOR_NAME_KHAKI2				= 94,
+	COLOR_NAME_KHAKI3				= 202,
+	COLOR_NAME_KHAKI4				= 414,
+	COLOR_NAME_LAVENDER				= 251,
+	COLOR_NAME_LAVENDERBLUSH		= 195,
+	COLOR_NAME_LAVENDERBLUSH1		= 358,
+	COLOR_NAME_LAVENDERBLUSH2		= 445,
+	COLOR_NAME_LAVENDERBLUSH3		= 525,
+	COLOR_NAME_LAVENDERBLUSH4		= 72,
+	COLOR_NAME_LAWNGREEN			= 213,
+	COLOR_NAME_LEMONCHIFFON			= 305,
+	COLOR_NAME_LEMONCHIFFON1		= 320,
+	COLOR_NAME_LEMONCHIFFON2		= 46,
+	COLOR_NAME_LEMONCHIFFON3		= 183,
+	COLOR_NAME_LEMONCHIFFON4		= 150,
+	COLOR_NAME_LIGHT				= 85,
+	COLOR_NAME_LIGHTBLUE			= 335,
+	COLOR_NAME_LIGHTBLUE1			= 206,
+	COLOR_NAME_LIGHTBLUE2			= 344,
+	COLOR_NAME_LIGHTBLUE3			= 35,
+	COLOR_NAME_LIGHTBLUE4			= 254,
+	COLOR_NAME_LIGHTCORAL			= 395,
+	COLOR_NAME_LIGHTCYAN			= 558,
+	COLOR_NAME_LIGHTCYAN1			= 88,
+	COLOR_NAME_LIGHTCYAN2			= 296,
+	COLOR_NAME_LIGHTCYAN3			= 526,
+	COLOR_NAME_LIGHTCYAN4			= 156,
+	COLOR_NAME_LIGHTGOLDENROD1		= 56,
+	COLOR_NAME_LIGHTGOLDENROD2		= 275,
+	COLOR_NAME_LIGHTGOLDENROD3		= 363,
+	COLOR_NAME_LIGHTGOLDENROD4		= 193,
+	COLOR_NAME_LIGHTGOLDENRODYELLOW	= 161,
+	COLOR_NAME_LIGHTGRAY			= 239,
+	COLOR_NAME_LIGHTGREEN			= 229,
+	COLOR_NAME_LIGHTGREY			= 252,
+	COLOR_NAME_LIGHTPINK			= 488,
+	COLOR_NAME_LIGHTPINK1			= 263,
+	COLOR_NAME_LIGHTPINK2			= 493,
+	COLOR_NAME_LIGHTPINK3			= 109,
+	COLOR_NAME_LIGHTPINK4			= 260,
+	COLOR_NAME_LIGHTSALMON			= 300,
+	COLOR_NAME_LIGHTSALMON1			= 126,
+	COLOR_NAME_LIGHTSALMON2			= 74,
+	COLOR_NAME_LIGHTSALMON3			= 3,
+	COLOR_NAME_LIGHTSALMON4			= 30,
+	COLOR_NAME_LIGHTSEAGREEN		= 544,
+	COLOR_NAME_LIGHTSKYBLUE			= 42,
+	COLOR_NAME_LIGHTSKYBLUE1		= 154,
+	COLOR_NAME_LIGHTSKYBLUE2		= 447,
+	COLOR_NAME_LIGHTSKYBLUE3		= 315,
+	COLOR_NAME_LIGHTSKYBLUE4		= 265,
+	COLOR_NAME_LIGHTSLATEBLUE		= 348,
+	COLOR_NAME_LIGHTSLATEGRAY		= 12,
+	COLOR_NAME_LIGHTSLATEGREY		= 290,
+	COLOR_NAME_LIGHTSTEELBLUE		= 101,
+	COLOR_NAME_LIGHTSTEELBLUE1		= 187,
+	COLOR_NAME_LIGHTSTEELBLUE2		= 464,
+	COLOR_NAME_LIGHTSTEELBLUE3		= 489,
+	COLOR_NAME_LIGHTSTEELBLUE4		= 427,
+	COLOR_NAME_LIGHTYELLOW			= 382,
+	COLOR_NAME_LIGHTYELLOW1			= 443,
+	COLOR_NAME_LIGHTYELLOW2			= 437,
+	COLOR_NAME_LIGHTYELLOW3			= 221,
+	COLOR_NAME_LIGHTYELLOW4			= 214,
+	COLOR_NAME_LIMEGREEN			= 231,
+	COLOR_NAME_LINEN				= 293,
+	COLOR_NAME_MAGENTA				= 322,
+	COLOR_NAME_MAGENTA2				= 390,
+	COLOR_NAME_MAGENTA3				= 294,
+	COLOR_NAME_MAGENTA4				= 484,
+	COLOR_NAME_MAROON0				= 66,
+	COLOR_NAME_MAROON1				= 282,
+	COLOR_NAME_MAROON2				= 96,
+	COLOR_NAME_MAROON3				= 17,
+	COLOR_NAME_MAROON4				= 234,
+	COLOR_NAME_MEDIUM				= 469,
+	COLOR_NAME_MEDIUMAQUAMARINE		= 227,
+	COLOR_NAME_MEDIUMBLUE			= 547,
+	COLOR_NAME_MEDIUMORCHID			= 65,
+	COLOR_NAME_MEDIUMORCHID1		= 357,
+	COLOR_NAME_MEDIUMORCHID2		= 40,
+	COLOR_NAME_MEDIUMORCHID3		= 115,
+	COLOR_NAME_MEDIUMORCHID4		= 100,
+	COLOR_NAME_MEDIUMPURPLE			= 308,
+	COLOR_NAME_MEDIUMPURPLE1		= 208,
+	COLOR_NAME_MEDIUMPURPLE2		= 561,
+	COLOR_NAME_MEDIUMPURPLE3		= 63,
+	COLOR_NAME_MEDIUMPURPLE4		= 59,
+	COLOR_NAME_MEDIUMSEAGREEN		= 380,
+	COLOR_NAME_MEDIUMSLATEBLUE		= 274,
+	COLOR_NAME_MEDIUMSPRINGGREEN	= 95,
+	COLOR_NAME_MEDIUMTURQUOISE		= 481,
+	COLOR_NAME_MEDIUMVIOLETRED		= 487,
+	COLOR_NAME_MIDNIGHTBLUE			= 316,
+	COLOR_NAME_MINTCREAM			= 424,
+	COLOR_NAME_MISTYROSE			= 110,
+	COLOR_NAME_MISTYROSE1			= 280,
+	COLOR_NAME_MISTYROSE2			= 398,
+	COLOR_NAME_MISTYROSE3			= 439,
+	COLOR_NAME_MISTYROSE4			= 134,
+	COLOR_NAME_MOCCASIN				= 291,
+	COLOR_NAME_NAVAJOWHITE			= 287,
+	COLOR_NAME_NAVAJOWHITE1			= 45,
+	COLOR_NAME_NAVAJOWHITE2			= 116,
+	COLOR_NAME_NAVAJOWHITE3			= 18,
+	COLOR_NAME_NAVAJOWHITE4			= 359,
+	COLOR_NAME_NAVYBLUE				= 125,
+	COLOR_NAME_OLDLACE				= 90,
+	COLOR_NAME_OLIVEDRAB			= 215,
+	COLOR_NAME_OLIVEDRAB1			= 440,
+	COLOR_NAME_OLIVEDRAB2			= 266,
+	COLOR_NAME_OLIVEDRAB4			= 550,
+	COLOR_NAME_ORANGE1				= 79,
+	COLOR_NAME_ORANGE2				= 306,
+	COLOR_NAME_ORANGE3				= 475,
+	COLOR_NAME_ORANGE4				= 352,
+	COLOR_NAME_ORANGERED			= 375,
+	COLOR_NAME_ORANGERED1			= 129,
+	COLOR_NAME_ORANGERED2			= 490,
+	COLOR_NAME_ORANGERED3			= 482,
+	COLOR_NAME_ORANGERED4			= 197,
+	COLOR_NAME_ORCHID				= 514,
+	COLOR_NAME_ORCHID1				= 87,
+	COLOR_NAME_ORCHID2				= 84,
+	COLOR_NAME_ORCHID3				= 167,
+	COLOR_NAME_ORCHID4				= 292,
+	COLOR_NAME_PALE					= 147,
+	COLOR_NAME_PALEGOLDENROD		= 416,
+	COLOR_NAME_PALEGREEN			= 515,
+	COLOR_NAME_PALEGREEN1			= 394,
+	COLOR_NAME_PALEGREEN2			= 506,
+	COLOR_NAME_PALEGREEN3			= 185,
+	COLOR_NAME_PALEGREEN4			= 459,
+	COLOR_NAME_PALETURQUOISE		= 144,
+	COLOR_NAME_PALETURQUOISE1		= 219,
+	COLOR_NAME_PALETURQUOISE2		= 411,
+	COLOR_NAME_PALETURQUOISE3		= 52,
+	COLOR_NAME_PALETURQUOISE4		= 10,
+	COLOR_NAME_PALEVIOLETRED		= 371,
+	COLOR_NAME_PALEVIOLETRED1		= 431,
+	COLOR_NAME_PALEVIOLETRED2		= 261,
+	COLOR_NAME_PALEVIOLETRED3		= 177,
+	COLOR_NAME_PALEVIOLETRED4		= 453,
+	COLOR_NAME_PAPAYAWHIP			= 423,
+	COLOR_NAME_PEACHPUFF			= 502,
+	COLOR_NAME_PEACHPUFF1			= 135,
+	COLOR_NAME_PEACHPUFF2			= 537,
+	COLOR_NAME_PEACHPUFF3			= 196,
+	COLOR_NAME_PEACHPUFF4			= 171,
+	COLOR_NAME_PERU					= 356,
+	COLOR_NAME_PINK					= 372,
+	COLOR_NAME_PINK1				= 362,
+	COLOR_NAME_PINK2				= 350,
+	COLOR_NAME_PINK3				= 552,
+	COLOR_NAME_PINK4				= 406,
+	COLOR_NAME_PLUM					= 340,
+	COLOR_NAME_PLUM1				= 138,
+	COLOR_NAME_PLUM2				= 29,
+	COLOR_NAME_PLUM3				= 465,
+	COLOR_NAME_PLUM4				= 186,
+	COLOR_NAME_POWDERBLUE			= 517,
+	COLOR_NAME_PURPLE0				= 500,
+	COLOR_NAME_PURPLE1				= 297,
+	COLOR_NAME_PURPLE2				= 184,
+	COLOR_NAME_PURPLE3				= 548,
+	COLOR_NAME_PURPLE4				= 191,
+	COLOR_NAME_REBECCAPURPLE		= 470,
+	COLOR_NAME_RED1					= 13,
+	COLOR_NAME_RED2					= 328,
+	COLOR_NAME_RED3					= 139,
+	COLOR_NAME_RED4					= 170,
+	COLOR_NAME_ROSYBROWN			= 224,
+	COLOR_NAME_ROSYBROWN1			= 240,
+	COLOR_NAME_ROSYBROWN2			= 123,
+	COLOR_NAME_ROSYBROWN3			= 441,
+	COLOR_NAME_ROSYBROWN4			= 538,
+	COLOR_NAME_ROYALBLUE			= 256,
+	COLOR_NAME_ROYALBLUE1			= 351,
+	COLOR_NAME_ROYALBLUE2			= 399,
+	COLOR_NAME_ROYALBLUE3			= 370,
+	COLOR_NAME_ROYALBLUE4			= 347,
+	COLOR_NAME_SADDLEBROWN			= 555,
+	COLOR_NAME_SALMON				= 554,
+	COLOR_NAME_SALMON1				= 523,
+	COLOR_NAME_SALMON2				= 43,
+	COLOR_NAME_SALMON3				= 86,
+	COLOR_NAME_SALMON4				= 232,
+	COLOR_NAME_SANDYBROWN			= 44,
+	COLOR_NAME_SEAGREEN				= 105,
+	COLOR_NAME_SEAGREEN1			= 50,
+	COLOR_NAME_SEAGREEN2			= 119,
+	COLOR_NAME_SEAGREEN3			= 387,
+	COLOR_NAME_SEAGREEN4			= 334,
+	COLOR_NAME_SEASHELL				= 373,
+	COLOR_NAME_SEASHELL1			= 329,
+	COLOR_NAME_SEASHELL2			= 386,
+	COLOR_NAME_SEASHELL3			= 242,
+	COLOR_NAME_SEASHELL4			= 393,
+	COLOR_NAME_SIENNA				= 376,
+	COLOR_NAME_SIENNA1				= 412,
+	COLOR_NAME_SIENNA2				= 307,
+	COLOR_NAME_SIENNA3				= 34,
+	COLOR_NAME_SIENNA4				= 264,
+	COLOR_NAME_SKYBLUE				= 89,
+	COLOR_NAME_SKYBLUE1				= 518,
+	COLOR_NAME_SKYBLUE2				= 545,
+	COLOR_NAME_SKYBLUE3				= 304,
+	COLOR_NAME_SKYBLUE4				= 521,
+	COLOR_NAME_SLATEBLUE			= 130,
+	COLOR_NAME_SLATEBLUE1			= 392,
+	COLOR_NAME_SLATEBLUE2			= 504,
+	COLOR_NAME_SLATEBLUE3			= 15,
+	COLOR_NAME_SLATEBLUE4			= 496,
+	COLOR_NAME_SLATEGRAY			= 355,
+	COLOR_NAME_SLATEGRAY1			= 337,
+	COLOR_NAME_SLATEGRAY2			= 0,
+	COLOR_NAME_SLATEGRAY3			= 262,
+	COLOR_NAME_SLATEGRAY4			= 449,
+	COLOR_NAME_SLATEGREY			= 467,
+	COLOR_NAME_SNOW					= 102,
+	COLOR_NAME_SNOW1				= 207,
+	COLOR_NAME_SNOW2				= 163,
+	COLOR_NAME_SNOW3				= 174,
+	COLOR_NAME_SNOW4				= 438,
+	COLOR_NAME_SPRINGGREEN			= 354,
+	COLOR_NAME_SPRINGGREEN1			= 468,
+	COLOR_NAME_SPRINGGREEN2			= 53,
+	COLOR_NAME_SPRINGGREEN3			= 389,
+	COLOR_NAME_SPRINGGREEN4			= 36,
+	COLOR_NAME_STEELBLUE			= 228,
+	COLOR_NAME_STEELBLUE1			= 473,
+	COLOR_NAME_STEELBLUE2			= 236,
+	COLOR_NAME_STEELBLUE3			= 533,
+	COLOR_NAME_STEELBLUE4			= 82,
+	COLOR_NAME_TAN					= 204,
+	COLOR_NAME_TAN1					= 128,
+	COLOR_NAME_TAN2					= 455,
+	COLOR_NAME_TAN3					= 492,
+	COLOR_NAME_TAN4					= 417,
+	COLOR_NAME_THISTLE				= 2,
+	COLOR_NAME_THISTLE1				= 4,
+	COLOR_NAME_THISTLE2				= 249,
+	COLOR_NAME_THISTLE3				= 330,
+	COLOR_NAME_THISTLE4				= 225,
+	COLOR_NAME_TOMATO				= 114,
+	COLOR_NAME_TOMATO1				= 546,
+	COLOR_NAME_TOMATO2				= 543,
+	COLOR_NAME_TOMATO3				= 97,
+	COLOR_NAME_TOMATO4				= 145,
+	COLOR_NAME_TURQUOISE			= 271,
+	COLOR_NAME_TURQUOISE1			= 8,
+	COLOR_NAME_TURQUOISE2			= 456,
+	COLOR_NAME_TURQUOISE3			= 384,
+	COLOR_NAME_TURQUOISE4			= 1,
+	COLOR_NAME_VIOLET				= 513,
+	COLOR_NAME_VIOLETRED			= 353,
+	COLOR_NAME_VIOLETRED1			= 80,
+	COLOR_NAME_VIOLETRED2			= 49,
+	COLOR_NAME_VIOLETRED3			= 483,
+	COLOR_NAME_VIOLETRED4			= 364,
+	COLOR_NAME_WHEAT				= 198,
+	COLOR_NAME_WHEAT1				= 243,
+	COLOR_NAME_WHEAT2				= 542,
+	COLOR_NAME_WHEAT3				= 507,
+	COLOR_NAME_WHEAT4				= 71,
+	COLOR_NAME_WHITESMOKE			= 111,
+	COLOR_NAME_YELLOW1				= 486,
+	COLOR_NAME_YELLOW2				= 113,
+	COLOR_NAME_YELLOW3				= 498,
+	COLOR_NAME_YELLOW4				= 23,
+	COLOR_NAME_YELLOWGREEN			= 257,
+};
+
+
+
+
+// COLOR FOR EACH SLOT. USABLE IN CONSTANT EXPRESSIONS, BUT IN PROGMEM ON AVR,
+// SO READ IT AT RUN TIME WITH COLOR_NAMES_COLOR()
+static constexpr color_t color_names_colors[COLOR_NAMES_COUNT] PROGMEM = {
+	color_t(0xb9, 0xd3, 0xee),	// slategray2
+	color_t(0x00, 0x86, 0x8b),	// turquoise4
+	color_t(0xd8, 0xbf, 0xd8),	// thistle
+	color_t(0xcd, 0x81, 0x62),	// lightsalmon3
+	color_t(0xff, 0xe1, 0xff),	// thistle1
+	color_t(0x00, 0xcd, 0xcd),	// cyan3
+	color_t(0xe0, 0xee, 0xe0),	// honeydew2
+	color_t(0x9b, 0xcd, 0x9b),	// darkseagreen3
+	color_t(0x00, 0xf5, 0xff),	// turquoise1
+	color_t(0xcd, 0x33, 0x33),	// brown3
+	color_t(0x66, 0x8b, 0x8b),	// paleturquoise4
+	color_t(0x42, 0x42, 0x42),	// gray26
+	color_t(0x77, 0x88, 0x99),	// lightslategray
+	color_t(0xff, 0x00, 0x00),	// red1
+	color_t(0x2b, 0x2b, 0x2b),	// gray17
+	color_t(0x69, 0x59, 0xcd),	// slateblue3
+	color_t(0xad, 0xad, 0xad),	// gray68
+	color_t(0xcd, 0x29, 0x90),	// maroon3
+	color_t(0xcd, 0xb3, 0x8b),	// navajowhite3
+	color_t(0x00, 0x68, 0x8b),	// deepskyblue4
+	color_t(0x1f, 0x1f, 0x1f),	// gray12
+	color_t(0xcd, 0x66, 0x00),	// darkorange3
+	color_t(0xff, 0xd7, 0x00),	// gold
+	color_t(0x8b, 0x8b, 0x00),	// yellow4
+	color_t(0x00, 0xee, 0x00),	// green2
+	color_t(0xcd, 0x9b, 0x1d),	// goldenrod3
+	color_t(0xee, 0xdf, 0xcc),	// antiquewhite2
+	color_t(0xff, 0xff, 0xf0),	// ivory
+	color_t(0x8b, 0x45, 0x00),	// darkorange4
+	color_t(0xee, 0xae, 0xee),	// plum2
+	color_t(0x8b, 0x57, 0x42),	// lightsalmon4
+	color_t(0xb8, 0x86, 0x0b),	// darkgoldenrod
+	color_t(0xe3, 0xe3, 0xe3),	// gray89
+	color_t(0xff, 0xf8, 0xdc),	// cornsilk1
+	color_t(0xcd, 0x68, 0x39),	// sienna3
+	color_t(0x9a, 0xc0, 0xcd),	// lightblue3
+	color_t(0x00, 0x8b, 0x45),	// springgreen4
+	color_t(0x8b, 0x73, 0x55),	// burlywood4
+	color_t(0xee, 0x6a, 0x50),	// coral2
+	color_t(0xff, 0xd3, 0x9b),	// burlywood1
+	color_t(0xd1, 0x5f, 0xee),	// mediumorchid2
+	color_t(0x8b, 0x65, 0x08),	// darkgoldenrod4
+	color_t(0x87, 0xce, 0xfa),	// lightskyblue
+	color_t(0xee, 0x82, 0x62),	// salmon2
+	color_t(0xf4, 0xa4, 0x60),	// sandybrown
+	color_t(0xff, 0xde, 0xad),	// navajowhite1
+	color_t(0xee, 0xe9, 0xbf),	// lemonchiffon2
+	color_t(0x14, 0x14, 0x14),	// gray8
+	color_t(0xa1, 0xa1, 0xa1),	// gray63
+	color_t(0xee, 0x3a, 0x8c),	// violetred2
+	color_t(0x54, 0xff, 0x9f),	// seagreen1
+	color_t(0xc1, 0xff, 0xc1),	// darkseagreen1
+	color_t(0x96, 0xcd, 0xcd),	// paleturquoise3
+	color_t(0x00, 0xee, 0x76),	// springgreen2
+	color_t(0xff, 0xeb, 0xcd),	// blanchedalmond
+	color_t(0xcc, 0xcc, 0xcc),	// gray80
+	color_t(0xff, 0xec, 0x8b),	// lightgoldenrod1
+	color_t(0xfa, 0xeb, 0xd7),	// antiquewhite
+	color_t(0xf0, 0xff, 0xff),	// azure1
+	color_t(0x5d, 0x47, 0x8b),	// mediumpurple4
+	color_t(0x47, 0x47, 0x47),	// gray28
+	color_t(0xb3, 0xb3, 0xb3),	// gray70
+	color_t(0x00, 0x80, 0x00),	// green
+	color_t(0x89, 0x68, 0xcd),	// mediumpurple3
+	color_t(0x7f, 0xff, 0x00),	// chartreuse
+	color_t(0xba, 0x55, 0xd3),	// mediumorchid
+	color_t(0xb0, 0x30, 0x60),	// maroon0
+	color_t(0x00, 0xff, 0x00),	// lime
+	color_t(0x08, 0x08, 0x08),	// gray3
+	color_t(0x00, 0x00, 0x8b),	// darkblue
+	color_t(0xca, 0xff, 0x70),	// darkolivegreen1
+	color_t(0x8b, 0x7e, 0x66),	// wheat4
+	color_t(0x8b, 0x83, 0x86),	// lavenderblush4
+	color_t(0xbf, 0xbf, 0xbf),	// gray75
+	color_t(0xee, 0x95, 0x72),	// lightsalmon2
+	color_t(0xd6, 0xd6, 0xd6),	// gray84
+	color_t(0xff, 0x8c, 0x00),	// darkorange
+	color_t(0xcd, 0x95, 0x0c),	// darkgoldenrod3
+	color_t(0xee, 0xc5, 0x91),	// burlywood2
+	color_t(0xff, 0xa5, 0x00),	// orange1
+	color_t(0xff, 0x3e, 0x96),	// violetred1
+	color_t(0x5e, 0x5e, 0x5e),	// gray37
+	color_t(0x36, 0x64, 0x8b),	// steelblue4
+	color_t(0x2e, 0x2e, 0x2e),	// gray18
+	color_t(0xee, 0x7a, 0xe9),	// orchid2
+	color_t(0xee, 0xdd, 0x82),	// light
+	color_t(0xcd, 0x70, 0x54),	// salmon3
+	color_t(0xff, 0x83, 0xfa),	// orchid1
+	color_t(0xe0, 0xff, 0xff),	// lightcyan1
+	color_t(0x87, 0xce, 0xeb),	// skyblue
+	color_t(0xfd, 0xf5, 0xe6),	// oldlace
+	color_t(0xfa, 0xfa, 0xfa),	// gray98
+	color_t(0x36, 0x36, 0x36),	// gray21
+	color_t(0xcd, 0x10, 0x76),	// deeppink3
+	color_t(0xee, 0xe6, 0x85),	// khaki2
+	color_t(0x00, 0xfa, 0x9a),	// mediumspringgreen
+	color_t(0xee, 0x30, 0xa7),	// maroon2
+	color_t(0xcd, 0x4f, 0x39),	// tomato3
+	color_t(0x38, 0x38, 0x38),	// gray22
+	color_t(0xff, 0x30, 0x30),	// firebrick1
+	color_t(0x7a, 0x37, 0x8b),	// mediumorchid4
+	color_t(0xb0, 0xc4, 0xde),	// lightsteelblue
+	color_t(0xff, 0xfa, 0xfa),	// snow
+	color_t(0x7f, 0x7f, 0x7f),	// gray50
+	color_t(0xa9, 0xa9, 0xa9),	// darkgrey
+	color_t(0x2e, 0x8b, 0x57),	// seagreen
+	color_t(0x0d, 0x0d, 0x0d),	// gray5
+	color_t(0x7a, 0x7a, 0x7a),	// gray48
+	color_t(0xf2, 0xf2, 0xf2),	// gray95
+	color_t(0xcd, 0x8c, 0x95),	// lightpink3
+	color_t(0xff, 0xe4, 0xe1),	// mistyrose
+	color_t(0xf5, 0xf5, 0xf5),	// whitesmoke
+	color_t(0xf0, 0xff, 0xf0),	// honeydew
+	color_t(0xee, 0xee, 0x00),	// yellow2
+	color_t(0xff, 0x63, 0x47),	// tomato
+	color_t(0xb4, 0x52, 0xcd),	// mediumorchid3
+	color_t(0xee, 0xcf, 0xa1),	// navajowhite2
+	color_t(0x8b, 0x3a, 0x62),	// hotpink4
+	color_t(0xee, 0xe8, 0xcd),	// cornsilk2
+	color_t(0x4e, 0xee, 0x94),	// seagreen2
+	color_t(0xb8, 0xb8, 0xb8),	// gray72
+	color_t(0x2f, 0x4f, 0x4f),	// darkslategrey
+	color_t(0x94, 0x94, 0x94),	// gray58
+	color_t(0xee, 0xb4, 0xb4),	// rosybrown2
+	color_t(0xdb, 0xdb, 0xdb),	// gray86
+	color_t(0x00, 0x00, 0x80),	// navyblue
+	color_t(0xff, 0xa0, 0x7a),	// lightsalmon1
+	color_t(0x3d, 0x3d, 0x3d),	// gray24
+	color_t(0xff, 0xa5, 0x4f),	// tan1
+	color_t(0xff, 0x45, 0x00),	// orangered1
+	color_t(0x6a, 0x5a, 0xcd),	// slateblue
+	color_t(0x96, 0x96, 0x96),	// gray59
+	color_t(0x03, 0x03, 0x03),	// gray1
+	color_t(0x1e, 0x90, 0xff),	// dodgerblue1
+	color_t(0x8b, 0x7d, 0x7b),	// mistyrose4
+	color_t(0xff, 0xda, 0xb9),	// peachpuff1
+	color_t(0xff, 0xfa, 0xf0),	// floralwhite
+	color_t(0xff, 0xc1, 0x25),	// goldenrod1
+	color_t(0xff, 0xbb, 0xff),	// plum1
+	color_t(0xcd, 0x00, 0x00),	// red3
+	color_t(0xff, 0xff, 0xff),	// white
+	color_t(0x00, 0xbf, 0xff),	// deepskyblue
+	color_t(0x7f, 0xff, 0x00),	// chartreuse1
+	color_t(0x8b, 0x00, 0x00),	// darkred
+	color_t(0xaf, 0xee, 0xee),	// paleturquoise
+	color_t(0x8b, 0x36, 0x26),	// tomato4
+	color_t(0x83, 0x8b, 0x8b),	// azure4
+	color_t(0xdb, 0x70, 0x93),	// pale
+	color_t(0x9e, 0x9e, 0x9e),	// gray62
+	color_t(0xff, 0xff, 0xf0),	// ivory1
+	color_t(0x8b, 0x89, 0x70),	// lemonchiffon4
+	color_t(0x9c, 0x9c, 0x9c),	// gray61
+	color_t(0x97, 0xff, 0xff),	// darkslategray1
+	color_t(0x4a, 0x4a, 0x4a),	// gray29
+	color_t(0xb0, 0xe2, 0xff),	// lightskyblue1
+	color_t(0x73, 0x73, 0x73),	// gray45
+	color_t(0x7a, 0x8b, 0x8b),	// lightcyan4
+	color_t(0x7f, 0xff, 0xd4),	// aquamarine
+	color_t(0xe0, 0xe0, 0xe0),	// gray88
+	color_t(0xc1, 0xcd, 0xc1),	// honeydew3
+	color_t(0xe8, 0xe8, 0xe8),	// gray91
+	color_t(0xfa, 0xfa, 0xd2),	// lightgoldenrodyellow
+	color_t(0xcd, 0x5c, 0x5c),	// indianred
+	color_t(0xee, 0xe9, 0xe9),	// snow2
+	color_t(0x79, 0xcd, 0xcd),	// darkslategray3
+	color_t(0xff, 0x7f, 0x00),	// darkorange1
+	color_t(0xe5, 0xe5, 0xe5),	// gray90
+	color_t(0xcd, 0x69, 0xc9),	// orchid3
+	color_t(0xff, 0x14, 0x93),	// deeppink1
+	color_t(0xff, 0x00, 0xff),	// fuchsia
+	color_t(0x8b, 0x00, 0x00),	// red4
+	color_t(0x8b, 0x77, 0x65),	// peachpuff4
+	color_t(0x00, 0xce, 0xd1),	// darkturquoise
+	color_t(0xbc, 0xee, 0x68),	// darkolivegreen2
+	color_t(0xcd, 0xc9, 0xc9),	// snow3
+	color_t(0xff, 0x40, 0x40),	// brown1
+	color_t(0xee, 0x2c, 0x2c),	// firebrick2
+	color_t(0xcd, 0x68, 0x89),	// palevioletred3
+	color_t(0x8c, 0x8c, 0x8c),	// gray55
+	color_t(0x4d, 0x4d, 0x4d),	// gray30
+	color_t(0x69, 0x8b, 0x69),	// darkseagreen4
+	color_t(0xdc, 0xdc, 0xdc),	// gainsboro
+	color_t(0x00, 0x8b, 0x8b),	// cyan4
+	color_t(0xcd, 0xc9, 0xa5),	// lemonchiffon3
+	color_t(0x91, 0x2c, 0xee),	// purple2
+	color_t(0x7c, 0xcd, 0x7c),	// palegreen3
+	color_t(0x8b, 0x66, 0x8b),	// plum4
+	color_t(0xca, 0xe1, 0xff),	// lightsteelblue1
+	color_t(0xb4, 0xee, 0xb4),	// darkseagreen2
+	color_t(0x4b, 0x00, 0x82),	// indigo
+	color_t(0x00, 0xcd, 0x00),	// green3
+	color_t(0x55, 0x1a, 0x8b),	// purple4
+	color_t(0xdc, 0x14, 0x3c),	// crimson
+	color_t(0x8b, 0x81, 0x4c),	// lightgoldenrod4
+	color_t(0x68, 0x22, 0x8b),	// darkorchid4
+	color_t(0xff, 0xf0, 0xf5),	// lavenderblush
+	color_t(0xcd, 0xaf, 0x95),	// peachpuff3
+	color_t(0x8b, 0x25, 0x00),	// orangered4
+	color_t(0xf5, 0xde, 0xb3),	// wheat
+	color_t(0xd9, 0xd9, 0xd9),	// gray85
+	color_t(0x76, 0xee, 0xc6),	// aquamarine2
+	color_t(0x0f, 0x0f, 0x0f),	// gray6
+	color_t(0xcd, 0xc6, 0x73),	// khaki3
+	color_t(0xa5, 0x2a, 0x2a),	// brown
+	color_t(0xd2, 0xb4, 0x8c),	// tan
+	color_t(0x00, 0x8b, 0x00),	// green4
+	color_t(0xbf, 0xef, 0xff),	// lightblue1
+	color_t(0xff, 0xfa, 0xfa),	// snow1
+	color_t(0xab, 0x82, 0xff),	// mediumpurple1
+	color_t(0x52, 0x52, 0x52),	// gray32
+	color_t(0xf0, 0xff, 0xf0),	// honeydew1
+	color_t(0x80, 0x80, 0x80),	// gray
+	color_t(0xcd, 0x60, 0x90),	// hotpink3
+	color_t(0x7c, 0xfc, 0x00),	// lawngreen
+	color_t(0x8b, 0x8b, 0x7a),	// lightyellow4
+	color_t(0x6b, 0x8e, 0x23),	// olivedrab
+	color_t(0x0a, 0x0a, 0x0a),	// gray4
+	color_t(0xff, 0xd7, 0x00),	// gold1
+	color_t(0x8b, 0x75, 0x00),	// gold4
+	color_t(0xbb, 0xff, 0xff),	// paleturquoise1
+	color_t(0x78, 0x78, 0x78),	// gray47
+	color_t(0xcd, 0xcd, 0xb4),	// lightyellow3
+	color_t(0x9a, 0x32, 0xcd),	// darkorchid3
+	color_t(0xf0, 0xe6, 0x8c),	// khaki
+	color_t(0xbc, 0x8f, 0x8f),	// rosybrown
+	color_t(0x8b, 0x7b, 0x8b),	// thistle4
+	color_t(0xcd, 0x26, 0x26),	// firebrick3
+	color_t(0x66, 0xcd, 0xaa),	// mediumaquamarine
+	color_t(0x46, 0x82, 0xb4),	// steelblue
+	color_t(0x90, 0xee, 0x90),	// lightgreen
+	color_t(0x5f, 0x9e, 0xa0),	// cadetblue
+	color_t(0x32, 0xcd, 0x32),	// limegreen
+	color_t(0x8b, 0x4c, 0x39),	// salmon4
+	color_t(0x00, 0x64, 0x00),	// darkgreen
+	color_t(0x8b, 0x1c, 0x62),	// maroon4
+	color_t(0x8b, 0x83, 0x78),	// antiquewhite4
+	color_t(0x5c, 0xac, 0xee),	// steelblue2
+	color_t(0x8b, 0x3a, 0x3a),	// indianred4
+	color_t(0xff, 0xe4, 0xc4),	// bisque
+	color_t(0xd3, 0xd3, 0xd3),	// lightgray
+	color_t(0xff, 0xc1, 0xc1),	// rosybrown1
+	color_t(0x99, 0x32, 0xcc),	// darkorchid
+	color_t(0xcd, 0xc5, 0xbf),	// seashell3
+	color_t(0xff, 0xe7, 0xba),	// wheat1
+	color_t(0x10, 0x4e, 0x8b),	// dodgerblue4
+	color_t(0xf0, 0xf8, 0xff),	// aliceblue
+	color_t(0x7d, 0x7d, 0x7d),	// gray49
+	color_t(0x5c, 0x5c, 0x5c),	// gray36
+	color_t(0x8e, 0xe5, 0xee),	// cadetblue2
+	color_t(0xee, 0xd2, 0xee),	// thistle2
+	color_t(0xbf, 0x3e, 0xff),	// darkorchid1
+	color_t(0xe6, 0xe6, 0xfa),	// lavender
+	color_t(0xd3, 0xd3, 0xd3),	// lightgrey
+	color_t(0xbd, 0xbd, 0xbd),	// gray74
+	color_t(0x68, 0x83, 0x8b),	// lightblue4
+	color_t(0x64, 0x95, 0xed),	// cornflowerblue
+	color_t(0x41, 0x69, 0xe1),	// royalblue
+	color_t(0x9a, 0xcd, 0x32),	// yellowgreen
+	color_t(0x8b, 0x00, 0x8b),	// darkmagenta
+	color_t(0x83, 0x8b, 0x83),	// honeydew4
+	color_t(0x8b, 0x5f, 0x65),	// lightpink4
+	color_t(0xee, 0x79, 0x9f),	// palevioletred2
+	color_t(0x9f, 0xb6, 0xcd),	// slategray3
+	color_t(0xff, 0xae, 0xb9),	// lightpink1
+	color_t(0x8b, 0x47, 0x26),	// sienna4
+	color_t(0x60, 0x7b, 0x8b),	// lightskyblue4
+	color_t(0xb3, 0xee, 0x3a),	// olivedrab2
+	color_t(0x8b, 0x0a, 0x50),	// deeppink4
+	color_t(0x18, 0x74, 0xcd),	// dodgerblue3
+	color_t(0x57, 0x57, 0x57),	// gray34
+	color_t(0x00, 0xff, 0xff),	// cyan
+	color_t(0x40, 0xe0, 0xd0),	// turquoise
+	color_t(0x8b, 0x23, 0x23),	// brown4
+	color_t(0x22, 0x8b, 0x22),	// forestgreen
+	color_t(0x7b, 0x68, 0xee),	// mediumslateblue
+	color_t(0xee, 0xdc, 0x82),	// lightgoldenrod2
+	color_t(0x00, 0x8b, 0x8b),	// darkcyan
+	color_t(0xde, 0xb8, 0x87),	// burlywood
+	color_t(0xff, 0xef, 0xdb),	// antiquewhite1
+	color_t(0x80, 0x00, 0x80),	// purple
+	color_t(0xff, 0xe4, 0xe1),	// mistyrose1
+	color_t(0x91, 0x91, 0x91),	// gray57
+	color_t(0xff, 0x34, 0xb3),	// maroon1
+	color_t(0x8f, 0xbc, 0x8f),	// darkseagreen
+	color_t(0xcd, 0xc8, 0xb1),	// cornsilk3
+	color_t(0xc4, 0xc4, 0xc4),	// gray77
+	color_t(0xf0, 0xff, 0xff),	// azure
+	color_t(0xff, 0xde, 0xad),	// navajowhite
+	color_t(0xf8, 0xf8, 0xff),	// ghostwhite
+	color_t(0x00, 0x00, 0x00),	// black
+	color_t(0x77, 0x88, 0x99),	// lightslategrey
+	color_t(0xff, 0xe4, 0xb5),	// moccasin
+	color_t(0x8b, 0x47, 0x89),	// orchid4
+	color_t(0xfa, 0xf0, 0xe6),	// linen
+	color_t(0xcd, 0x00, 0xcd),	// magenta3
+	color_t(0xcd, 0xb7, 0x9e),	// bisque3
+	color_t(0xd1, 0xee, 0xee),	// lightcyan2
+	color_t(0x9b, 0x30, 0xff),	// purple1
+	color_t(0x00, 0x00, 0xee),	// blue2
+	color_t(0xba, 0xba, 0xba),	// gray73
+	color_t(0xff, 0xa0, 0x7a),	// lightsalmon
+	color_t(0x6e, 0x6e, 0x6e),	// gray43
+	color_t(0xb2, 0x22, 0x22),	// firebrick
+	color_t(0xbd, 0xb7, 0x6b),	// darkkhaki
+	color_t(0x6c, 0xa6, 0xcd),	// skyblue3
+	color_t(0xff, 0xfa, 0xcd),	// lemonchiffon
+	color_t(0xee, 0x9a, 0x00),	// orange2
+	color_t(0xee, 0x79, 0x42),	// sienna2
+	color_t(0x93, 0x70, 0xdb),	// mediumpurple
+	color_t(0x33, 0x33, 0x33),	// gray20
+	color_t(0x94, 0x00, 0xd3),	// darkviolet
+	color_t(0x52, 0x8b, 0x8b),	// darkslategray4
+	color_t(0xee, 0x3b, 0x3b),	// brown2
+	color_t(0xee, 0x12, 0x89),	// deeppink2
+	color_t(0xc1, 0xcd, 0xcd),	// azure3
+	color_t(0x8d, 0xb6, 0xcd),	// lightskyblue3
+	color_t(0x19, 0x19, 0x70),	// midnightblue
+	color_t(0xcd, 0x66, 0x1d),	// chocolate3
+	color_t(0x69, 0x69, 0x69),	// gray41
+	color_t(0x98, 0xf5, 0xff),	// cadetblue1
+	color_t(0xff, 0xfa, 0xcd),	// lemonchiffon1
+	color_t(0x1e, 0x90, 0xff),	// dodgerblue
+	color_t(0xff, 0x00, 0xff),	// magenta
+	color_t(0x48, 0x3d, 0x8b),	// darkslateblue
+	color_t(0x80, 0x80, 0x80),	// grey
+	color_t(0xff, 0x7f, 0x50),	// coral
+	color_t(0x55, 0x6b, 0x2f),	// darkolivegreen
+	color_t(0x21, 0x21, 0x21),	// gray13
+	color_t(0xee, 0x00, 0x00),	// red2
+	color_t(0xff, 0xf5, 0xee),	// seashell1
+	color_t(0xcd, 0xb5, 0xcd),	// thistle3
+	color_t(0xc2, 0xc2, 0xc2),	// gray76
+	color_t(0xee, 0xc9, 0x00),	// gold2
+	color_t(0x00, 0xee, 0xee),	// cyan2
+	color_t(0x2e, 0x8b, 0x57),	// seagreen4
+	color_t(0xad, 0xd8, 0xe6),	// lightblue
+	color_t(0x8a, 0x8a, 0x8a),	// gray54
+	color_t(0xc6, 0xe2, 0xff),	// slategray1
+	color_t(0x8b, 0x7d, 0x6b),	// bisque4
+	color_t(0xff, 0x72, 0x56),	// coral1
+	color_t(0xdd, 0xa0, 0xdd),	// plum
+	color_t(0x63, 0x63, 0x63),	// gray39
+	color_t(0xff, 0x00, 0x00),	// red
+	color_t(0xff, 0xff, 0x00),	// yellow
+	color_t(0xb2, 0xdf, 0xee),	// lightblue2
+	color_t(0x69, 0x69, 0x69),	// dimgrey
+	color_t(0xcf, 0xcf, 0xcf),	// gray81
+	color_t(0x27, 0x40, 0x8b),	// royalblue4
+	color_t(0x84, 0x70, 0xff),	// lightslateblue
+	color_t(0x99, 0x99, 0x99),	// gray60
+	color_t(0xee, 0xa9, 0xb8),	// pink2
+	color_t(0x48, 0x76, 0xff),	// royalblue1
+	color_t(0x8b, 0x5a, 0x00),	// orange4
+	color_t(0xd0, 0x20, 0x90),	// violetred
+	color_t(0x00, 0xff, 0x7f),	// springgreen
+	color_t(0x70, 0x80, 0x90),	// slategray
+	color_t(0xcd, 0x85, 0x3f),	// peru
+	color_t(0xe0, 0x66, 0xff),	// mediumorchid1
+	color_t(0xff, 0xf0, 0xf5),	// lavenderblush1
+	color_t(0x8b, 0x79, 0x5e),	// navajowhite4
+	color_t(0xcd, 0xcd, 0xc1),	// ivory3
+	color_t(0x59, 0x59, 0x59),	// gray35
+	color_t(0xff, 0xb5, 0xc5),	// pink1
+	color_t(0xcd, 0xbe, 0x70),	// lightgoldenrod3
+	color_t(0x8b, 0x22, 0x52),	// violetred4
+	color_t(0xd2, 0x69, 0x1e),	// chocolate
+	color_t(0xcd, 0x55, 0x55),	// indianred3
+	color_t(0x00, 0xff, 0xff),	// aqua
+	color_t(0xa9, 0xa9, 0xa9),	// darkgray
+	color_t(0x8a, 0x2b, 0xe2),	// blueviolet
+	color_t(0x3a, 0x5f, 0xcd),	// royalblue3
+	color_t(0xdb, 0x70, 0x93),	// palevioletred
+	color_t(0xff, 0xc0, 0xcb),	// pink
+	color_t(0xff, 0xf5, 0xee),	// seashell
+	color_t(0x3b, 0x3b, 0x3b),	// gray23
+	color_t(0xff, 0x45, 0x00),	// orangered
+	color_t(0xa0, 0x52, 0x2d),	// sienna
+	color_t(0x2f, 0x4f, 0x4f),	// darkslategray
+	color_t(0x40, 0x40, 0x40),	// gray25
+	color_t(0x45, 0x8b, 0x00),	// chartreuse4
+	color_t(0x3c, 0xb3, 0x71),	// mediumseagreen
+	color_t(0xff, 0x6a, 0x6a),	// indianred1
+	color_t(0xff, 0xff, 0xe0),	// lightyellow
+	color_t(0x70, 0x70, 0x70),	// gray44
+	color_t(0x00, 0xc5, 0xcd),	// turquoise3
+	color_t(0x82, 0x82, 0x82),	// gray51
+	color_t(0xee, 0xe5, 0xde),	// seashell2
+	color_t(0x43, 0xcd, 0x80),	// seagreen3
+	color_t(0xbe, 0xbe, 0xbe),	// gray0
+	color_t(0x00, 0xcd, 0x66),	// springgreen3
+	color_t(0xee, 0x00, 0xee),	// magenta2
+	color_t(0x80, 0x00, 0x00),	// maroon
+	color_t(0x83, 0x6f, 0xff),	// slateblue1
+	color_t(0x8b, 0x86, 0x82),	// seashell4
+	color_t(0x9a, 0xff, 0x9a),	// palegreen1
+	color_t(0xf0, 0x80, 0x80),	// lightcoral
+	color_t(0x75, 0x75, 0x75),	// gray46
+	color_t(0x1a, 0x1a, 0x1a),	// gray10
+	color_t(0xee, 0xd5, 0xd2),	// mistyrose2
+	color_t(0x43, 0x6e, 0xee),	// royalblue2
+	color_t(0xcd, 0xad, 0x00),	// gold3
+	color_t(0x69, 0x69, 0x69),	// dimgray
+	color_t(0x00, 0x00, 0x8b),	// blue4
+	color_t(0x05, 0x05, 0x05),	// gray2
+	color_t(0xfc, 0xfc, 0xfc),	// gray99
+	color_t(0xc9, 0xc9, 0xc9),	// gray79
+	color_t(0x8b, 0x63, 0x6c),	// pink4
+	color_t(0xa8, 0xa8, 0xa8),	// gray66
+	color_t(0x61, 0x61, 0x61),	// gray38
+	color_t(0xff, 0xe4, 0xc4),	// bisque1
+	color_t(0xa2, 0xcd, 0x5a),	// darkolivegreen3
+	color_t(0xae, 0xee, 0xee),	// paleturquoise2
+	color_t(0xff, 0x82, 0x47),	// sienna1
+	color_t(0xa6, 0xa6, 0xa6),	// gray65
+	color_t(0x8b, 0x86, 0x4e),	// khaki4
+	color_t(0xe0, 0xee, 0xee),	// azure2
+	color_t(0xee, 0xe8, 0xaa),	// palegoldenrod
+	color_t(0x8b, 0x5a, 0x2b),	// tan4
+	color_t(0xc0, 0xc0, 0xc0),	// silver
+	color_t(0x26, 0x26, 0x26),	// gray15
+	color_t(0x54, 0x54, 0x54),	// gray33
+	color_t(0xee, 0x76, 0x21),	// chocolate2
+	color_t(0x53, 0x86, 0x8b),	// cadetblue4
+	color_t(0xff, 0xef, 0xd5),	// papayawhip
+	color_t(0xf5, 0xff, 0xfa),	// mintcream
+	color_t(0xab, 0xab, 0xab),	// gray67
+	color_t(0x00, 0x00, 0xff),	// blue
+	color_t(0x6e, 0x7b, 0x8b),	// lightsteelblue4
+	color_t(0x66, 0xcd, 0x00),	// chartreuse3
+	color_t(0xeb, 0xeb, 0xeb),	// gray92
+	color_t(0x24, 0x24, 0x24),	// gray14
+	color_t(0xff, 0x82, 0xab),	// palevioletred1
+	color_t(0xff, 0x14, 0x93),	// deeppink
+	color_t(0xee, 0x63, 0x63),	// indianred2
+	color_t(0x1c, 0x1c, 0x1c),	// gray11
+	color_t(0x00, 0xbf, 0xff),	// deepskyblue1
+	color_t(0x1c, 0x86, 0xee),	// dodgerblue2
+	color_t(0xee, 0xee, 0xd1),	// lightyellow2
+	color_t(0x8b, 0x89, 0x89),	// snow4
+	color_t(0xcd, 0xb7, 0xb5),	// mistyrose3
+	color_t(0xc0, 0xff, 0x3e),	// olivedrab1
+	color_t(0xcd, 0x9b, 0x9b),	// rosybrown3
+	color_t(0x87, 0x87, 0x87),	// gray53
+	color_t(0xff, 0xff, 0xe0),	// lightyellow1
+	color_t(0xcd, 0x5b, 0x45),	// coral3
+	color_t(0xee, 0xe0, 0xe5),	// lavenderblush2
+	color_t(0x30, 0x30, 0x30),	// gray19
+	color_t(0xa4, 0xd3, 0xee),	// lightskyblue2
+	color_t(0xff, 0x80, 0x00),	// orange
+	color_t(0x6c, 0x7b, 0x8b),	// slategray4
+	color_t(0xf5, 0xf5, 0xdc),	// beige
+	color_t(0xad, 0xff, 0x2f),	// greenyellow
+	color_t(0x00, 0x00, 0xff),	// blue1
+	color_t(0x8b, 0x47, 0x5d),	// palevioletred4
+	color_t(0x8d, 0xee, 0xee),	// darkslategray2
+	color_t(0xee, 0x9a, 0x49),	// tan2
+	color_t(0x00, 0xe5, 0xee),	// turquoise2
+	color_t(0xff, 0x7f, 0x24),	// chocolate1
+	color_t(0x00, 0xb2, 0xee),	// deepskyblue2
+	color_t(0x54, 0x8b, 0x54),	// palegreen4
+	color_t(0x12, 0x12, 0x12),	// gray7
+	color_t(0x6e, 0x8b, 0x3d),	// darkolivegreen4
+	color_t(0xff, 0xf6, 0x8f),	// khaki1
+	color_t(0x8b, 0x3e, 0x2f),	// coral4
+	color_t(0xbc, 0xd2, 0xee),	// lightsteelblue2
+	color_t(0xcd, 0x96, 0xcd),	// plum3
+	color_t(0xda, 0xa5, 0x20),	// goldenrod
+	color_t(0x70, 0x80, 0x90),	// slategrey
+	color_t(0x00, 0xff, 0x7f),	// springgreen1
+	color_t(0x66, 0xcd, 0xaa),	// medium
+	color_t(0x66, 0x33, 0x99),	// rebeccapurple
+	color_t(0xf7, 0xf7, 0xf7),	// gray97
+	color_t(0xc7, 0xc7, 0xc7),	// gray78
+	color_t(0x63, 0xb8, 0xff),	// steelblue1
+	color_t(0xee, 0xad, 0x0e),	// darkgoldenrod2
+	color_t(0xcd, 0x85, 0x00),	// orange3
+	color_t(0xd1, 0xd1, 0xd1),	// gray82
+	color_t(0xee, 0x6a, 0xa7),	// hotpink2
+	color_t(0x85, 0x85, 0x85),	// gray52
+	color_t(0xa3, 0xa3, 0xa3),	// gray64
+	color_t(0xee, 0xee, 0xe0),	// ivory2
+	color_t(0x48, 0xd1, 0xcc),	// mediumturquoise
+	color_t(0xcd, 0x37, 0x00),	// orangered3
+	color_t(0xcd, 0x32, 0x78),	// violetred3
+	color_t(0x8b, 0x00, 0x8b),	// magenta4
+	color_t(0xed, 0xed, 0xed),	// gray93
+	color_t(0xff, 0xff, 0x00),	// yellow1
+	color_t(0xc7, 0x15, 0x85),	// mediumvioletred
+	color_t(0xff, 0xb6, 0xc1),	// lightpink
+	color_t(0xa2, 0xb5, 0xcd),	// lightsteelblue3
+	color_t(0xee, 0x40, 0x00),	// orangered2
+	color_t(0x00, 0x9a, 0xcd),	// deepskyblue3
+	color_t(0xcd, 0x85, 0x3f),	// tan3
+	color_t(0xee, 0xa2, 0xad),	// lightpink2
+	color_t(0xff, 0x69, 0xb4),	// hotpink
+	color_t(0xd4, 0xd4, 0xd4),	// gray83
+	color_t(0x47, 0x3c, 0x8b),	// slateblue4
+	color_t(0x8b, 0x8b, 0x83),	// ivory4
+	color_t(0xcd, 0xcd, 0x00),	// yellow3
+	color_t(0x17, 0x17, 0x17),	// gray9
+	color_t(0xa0, 0x20, 0xf0),	// purple0
+	color_t(0x45, 0x8b, 0x74),	// aquamarine4
+	color_t(0xff, 0xda, 0xb9),	// peachpuff
+	color_t(0xe9, 0x96, 0x7a),	// darksalmon
+	color_t(0x7a, 0x67, 0xee),	// slateblue2
+	color_t(0xde, 0xde, 0xde),	// gray87
+	color_t(0x90, 0xee, 0x90),	// palegreen2
+	color_t(0xcd, 0xba, 0x96),	// wheat3
+	color_t(0xcd, 0xc0, 0xb0),	// antiquewhite3
+	color_t(0xff, 0xb9, 0x0f),	// darkgoldenrod1
+	color_t(0xb2, 0x3a, 0xee),	// darkorchid2
+	color_t(0x7f, 0xff, 0xd4),	// aquamarine1
+	color_t(0xff, 0x6e, 0xb4),	// hotpink1
+	color_t(0xee, 0x82, 0xee),	// violet
+	color_t(0xda, 0x70, 0xd6),	// orchid
+	color_t(0x98, 0xfb, 0x98),	// palegreen
+	color_t(0x00, 0x00, 0x80),	// navy
+	color_t(0xb0, 0xe0, 0xe6),	// powderblue
+	color_t(0x87, 0xce, 0xff),	// skyblue1
+	color_t(0x76, 0xee, 0x00),	// chartreuse2
+	color_t(0xb0, 0xb0, 0xb0),	// gray69
+	color_t(0x4a, 0x70, 0x8b),	// skyblue4
+	color_t(0x8b, 0x88, 0x78),	// cornsilk4
+	color_t(0xff, 0x8c, 0x69),	// salmon1
+	color_t(0x00, 0xff, 0xff),	// cyan1
+	color_t(0xcd, 0xc1, 0xc5),	// lavenderblush3
+	color_t(0xb4, 0xcd, 0xcd),	// lightcyan3
+	color_t(0x4f, 0x4f, 0x4f),	// gray31
+	color_t(0xff, 0xf8, 0xdc),	// cornsilk
+	color_t(0x66, 0x66, 0x66),	// gray40
+	color_t(0x7a, 0xc5, 0xcd),	// cadetblue3
+	color_t(0x6b, 0x6b, 0x6b),	// gray42
+	color_t(0xf0, 0xf0, 0xf0),	// gray94
+	color_t(0x4f, 0x94, 0xcd),	// steelblue3
+	color_t(0xee, 0xb4, 0x22),	// goldenrod2
+	color_t(0xee, 0xd5, 0xb7),	// bisque2
+	color_t(0x00, 0x80, 0x80),	// teal
+	color_t(0xee, 0xcb, 0xad),	// peachpuff2
+	color_t(0x8b, 0x69, 0x69),	// rosybrown4
+	color_t(0x8b, 0x1a, 0x1a),	// firebrick4
+	color_t(0x8f, 0x8f, 0x8f),	// gray56
+	color_t(0xb5, 0xb5, 0xb5),	// gray71
+	color_t(0xee, 0xd8, 0xae),	// wheat2
+	color_t(0xee, 0x5c, 0x42),	// tomato2
+	color_t(0x20, 0xb2, 0xaa),	// lightseagreen
+	color_t(0x7e, 0xc0, 0xee),	// skyblue2
+	color_t(0xff, 0x63, 0x47),	// tomato1
+	color_t(0x00, 0x00, 0xcd),	// mediumblue
+	color_t(0x7d, 0x26, 0xcd),	// purple3
+	color_t(0x45, 0x45, 0x45),	// gray27
+	color_t(0x69, 0x8b, 0x22),	// olivedrab4
+	color_t(0x80, 0x80, 0x00),	// olive
+	color_t(0xcd, 0x91, 0x9e),	// pink3
+	color_t(0x29, 0x29, 0x29),	// gray16
+	color_t(0xfa, 0x80, 0x72),	// salmon
+	color_t(0x8b, 0x45, 0x13),	// saddlebrown
+	color_t(0x8b, 0x69, 0x14),	// goldenrod4
+	color_t(0xcd, 0xaa, 0x7d),	// burlywood3
+	color_t(0xe0, 0xff, 0xff),	// lightcyan
+	color_t(0x00, 0xff, 0x00),	// green1
+	color_t(0xee, 0x76, 0x00),	// darkorange2
+	color_t(0x9f, 0x79, 0xee),	// mediumpurple2
+};
+
+
+
+
+// OFFSET OF EACH SLOT'S NAME IN COLOR_NAMES_TEXT
+static CONST uint16_t color_names_offset[COLOR_NAMES_COUNT] = {
+	    0,    11,    22,    30,    43,    52,    58,    68,    82,    93,   100,   115,
+	  122,   137,   142,   149,   160,   167,   175,   188,   201,   208,   220,   225,
+	  233,   240,   251,   265,   271,   283,   289,   302,   316,   323,   333,   341,
+	  352,   365,   376,   383,   394,   408,   423,   436,   444,   455,   468,   482,
+	  488,   495,   506,   516,   530,   545,   558,   573,   580,   596,   609,   616,
+	  630,   637,   644,   650,   664,   675,   688,   696,   701,   707,   716,   732,
+	  739,   754,   761,   774,   781,   792,   807,   818,   826,   837,   844,   855,
+	  862,   870,   876,   884,   892,   903,   911,   919,   926,   933,   943,   950,
+	  968,   976,   984,   991,  1002,  1016,  1031,  1036,  1043,  1052,  1061,  1067,
+	 1074,  1081,  1092,  1102,  1113,  1122,  1130,  1137,  1151,  1164,  1173,  1183,
+	 1193,  1200,  1214,  1221,  1232,  1239,  1248,  1261,  1268,  1273,  1284,  1294,
+	 1301,  1307,  1319,  1330,  1341,  1353,  1364,  1370,  1375,  1381,  1393,  1405,
+	 1413,  1427,  1435,  1442,  1447,  1454,  1461,  1475,  1482,  1497,  1504,  1518,
+	 1525,  1536,  1547,  1554,  1564,  1571,  1592,  1602,  1608,  1623,  1635,  1642,
+	 1650,  1660,  1668,  1673,  1684,  1698,  1714,  1720,  1727,  1738,  1753,  1760,
+	 1767,  1781,  1791,  1797,  1811,  1819,  1830,  1836,  1852,  1866,  1873,  1880,
+	 1888,  1896,  1912,  1924,  1938,  1949,  1960,  1966,  1973,  1985,  1991,  1998,
+	 2004,  2008,  2015,  2026,  2032,  2046,  2053,  2063,  2068,  2077,  2087,  2100,
+	 2110,  2116,  2122,  2128,  2143,  2150,  2163,  2175,  2181,  2191,  2200,  2211,
+	 2228,  2238,  2249,  2259,  2269,  2277,  2287,  2295,  2309,  2320,  2331,  2338,
+	 2348,  2359,  2370,  2380,  2387,  2399,  2409,  2416,  2423,  2434,  2443,  2455,
+	 2464,  2474,  2481,  2492,  2507,  2517,  2529,  2541,  2551,  2562,  2577,  2588,
+	 2599,  2607,  2621,  2632,  2642,  2654,  2661,  2666,  2676,  2683,  2695,  2711,
+	 2727,  2736,  2746,  2760,  2767,  2778,  2785,  2793,  2806,  2816,  2823,  2829,
+	 2841,  2852,  2858,  2873,  2882,  2890,  2896,  2905,  2913,  2924,  2932,  2938,
+	 2945,  2957,  2964,  2974,  2984,  2993,  3006,  3014,  3022,  3035,  3042,  3053,
+	 3068,  3075,  3085,  3092,  3106,  3119,  3130,  3137,  3148,  3162,  3173,  3181,
+	 3195,  3200,  3206,  3221,  3228,  3233,  3243,  3252,  3259,  3265,  3271,  3281,
+	 3291,  3298,  3309,  3317,  3324,  3329,  3336,  3340,  3347,  3358,  3366,  3373,
+	 3384,  3399,  3406,  3412,  3423,  3431,  3441,  3453,  3463,  3468,  3482,  3497,
+	 3510,  3517,  3524,  3530,  3546,  3557,  3567,  3578,  3583,  3592,  3603,  3614,
+	 3628,  3633,  3642,  3649,  3659,  3666,  3680,  3687,  3699,  3714,  3725,  3737,
+	 3744,  3755,  3762,  3772,  3782,  3788,  3801,  3810,  3817,  3828,  3838,  3849,
+	 3860,  3867,  3874,  3885,  3896,  3902,  3910,  3916,  3922,  3929,  3936,  3942,
+	 3949,  3956,  3964,  3980,  3995,  4003,  4010,  4017,  4024,  4038,  4043,  4050,
+	 4057,  4064,  4075,  4086,  4097,  4107,  4114,  4119,  4135,  4147,  4154,  4161,
+	 4176,  4185,  4196,  4203,  4216,  4228,  4241,  4247,  4258,  4269,  4280,  4287,
+	 4300,  4307,  4322,  4329,  4343,  4350,  4361,  4367,  4379,  4385,  4400,  4415,
+	 4420,  4431,  4442,  4455,  4466,  4472,  4488,  4495,  4502,  4518,  4524,  4534,
+	 4544,  4557,  4564,  4578,  4585,  4592,  4603,  4618,  4626,  4633,  4642,  4649,
+	 4656,  4663,  4679,  4690,  4701,  4710,  4717,  4725,  4741,  4751,  4767,  4778,
+	 4791,  4796,  4807,  4815,  4822,  4833,  4840,  4848,  4854,  4862,  4874,  4884,
+	 4895,  4906,  4913,  4924,  4931,  4945,  4960,  4972,  4984,  4993,  5000,  5007,
+	 5017,  5022,  5033,  5042,  5054,  5061,  5070,  5080,  5088,  5094,  5109,  5120,
+	 5127,  5136,  5143,  5154,  5161,  5168,  5179,  5190,  5198,  5203,  5214,  5225,
+	 5236,  5243,  5250,  5257,  5265,  5279,  5288,  5296,  5307,  5315,  5322,  5333,
+	 5339,  5345,  5352,  5359,  5371,  5382,  5393,  5403,  5410,  5422,
+};
+
+
+
+
+// SLOTS ORDERED AS AN IMPLICIT K-D TREE, SPLIT ON R, G, B BY DEPTH
+static CONST uint16_t color_names_kd[COLOR_NAMES_COUNT] = {
+	  289,   132,   403,    68,   216,   106,   201,   460,    47,   499,   397,   434,
+	   20,   327,   430,   419,   553,    14,    83,   446,   309,   233,    92,    98,
+	  374,   127,   378,    11,   549,   121,   377,    60,   153,   179,   527,   209,
+	  143,   170,   391,    28,   197,   539,   272,   555,   145,   267,   117,   237,
+	  264,   364,   203,   463,   453,   232,    41,    30,   326,   218,   352,   376,
+	  417,   556,   420,   269,   361,   247,    81,   408,    37,   359,   234,   125,
+	   69,   516,   316,   189,   191,   194,    59,   323,   402,   298,   426,   452,
+	  547,   470,   496,   347,   244,   341,    82,    19,   265,   529,   318,   345,
+	  401,   521,   370,   256,   268,   399,    15,   130,   351,   531,   279,   258,
+	  100,   186,   260,   484,   292,   406,   241,   548,   369,   184,   504,   310,
+	  500,   297,   222,    63,   301,   383,   155,   396,   220,   538,   171,   107,
+	  225,   274,   427,   449,   392,   308,   348,   561,   134,    62,    36,   205,
+	  273,   105,   180,   334,   379,   536,     1,   182,   276,   311,   422,   355,
+	  254,    10,   459,    24,   190,    67,   559,   428,   550,   215,   519,   231,
+	  389,    53,   354,   468,   380,   461,   501,   387,   156,   551,    71,   193,
+	  150,   235,   338,   414,   522,   246,   103,   211,   324,   385,   478,    72,
+	  393,   442,   438,   213,   185,    64,   142,    23,   214,   257,   410,   259,
+	  336,   146,   497,   178,   540,   283,   229,   467,   228,   533,   491,   544,
+	  230,    12,   290,   304,   255,   436,   458,   141,   435,   133,   321,   236,
+	  473,   384,   481,     5,   119,    95,    50,   227,   469,   200,   271,   172,
+	    8,   270,   333,   456,   367,   524,   164,   281,   122,   131,   349,   151,
+	  148,    48,   479,   413,   262,   489,   315,    35,   407,   208,   104,   368,
+	  545,   506,   530,   157,   511,    52,     7,   515,   394,    89,    42,   518,
+	  454,   248,   447,   319,   152,   425,   139,   302,     9,    21,   226,   176,
+	  482,   317,    34,    66,    93,    97,   162,   366,   192,   483,   444,   365,
+	   31,   356,    77,    25,   400,   475,   306,   466,   492,    86,     3,   303,
+	  363,   503,    38,    43,    74,   307,   328,   490,   421,   560,    13,   342,
+	  129,   375,    99,   312,   543,   114,   433,   175,   546,   381,   339,   165,
+	   76,    79,   474,   534,   412,   457,   448,   509,   455,   554,   126,    44,
+	  128,   325,   523,   300,   557,   487,    17,   109,   224,   177,   353,   212,
+	  441,   552,   510,   250,   115,    65,   167,   294,    40,   465,    16,   196,
+	  520,    18,    61,   295,   204,   439,   507,   541,   120,   299,   253,   388,
+	  330,    73,   418,     2,    49,    96,   147,   371,   313,   168,   432,    80,
+	  477,   390,   169,   357,   514,   282,   322,   494,   512,   261,   493,   350,
+	  123,   277,   395,   431,   263,   488,   362,    84,   340,    29,   513,    87,
+	  138,   372,   508,   202,   183,   159,   221,   242,    78,   284,   498,   360,
+	  331,   285,   472,   314,   405,   525,   174,    55,   526,   173,   188,   266,
+	  451,   440,    85,    94,    70,    46,   346,   476,    51,   239,   252,   495,
+	   26,   113,   332,   116,    22,   275,    39,   137,   217,    45,   287,   537,
+	  398,   535,   542,   198,   240,   135,   502,   238,   223,   243,   416,    56,
+	  291,   462,   343,   486,   409,   118,   437,   161,    54,   423,   305,   320,
+	   75,   199,   101,   124,   181,   505,   158,   445,    32,   335,     0,   344,
+	  517,   154,   464,   249,   187,   337,   166,   160,   429,     6,   144,   485,
+	  386,   163,   480,   296,   411,   206,   219,    88,   251,   415,   558,    58,
+	   57,   293,    90,   450,    33,   110,   280,   278,   329,   532,   108,   111,
+	  471,     4,   195,   358,   373,   245,    27,   136,   112,   210,   149,   528,
+	  382,   443,    91,   288,   286,   424,   404,   102,   207,   140,
+};
+
+
+
+
+// ALL NAMES, NUL SEPARATED, IN SLOT ORDER
+static CONST char color_names_text[] =
+	"slategray2\0"
+	"turquoise4\0"
+	"thistle\0"
+	"lightsalmon3\0"
+	"thistle1\0"
+	"cyan3\0"
+	"honeydew2\0"
+	"darkseagreen3\0"
+	"turquoise1\0"
+	"brown3\0"
+	"paleturquoise4\0"
+	"gray26\0"
+	"lightslategray\0"
+	"red1\0"
+	"gray17\0"
+	"slateblue3\0"
+	"gray68\0"
+	"maroon3\0"
+	"navajowhite3\0"
+	"deepskyblue4\0"
+	"gray12\0"
+	"darkorange3\0"
+	"gold\0"
+	"yellow4\0"
+	"green2\0"
+	"goldenrod3\0"
+	"antiquewhite2\0"
+	"ivory\0"
+	"darkorange4\0"
+	"plum2\0"
+	"lightsalmon4\0"
+	"darkgoldenrod\0"
+	"gray89\0"
+	"cornsilk1\0"
+	"sienna3\0"
+	"lightblue3\0"
+	"springgreen4\0"
+	"burlywood4\0"
+	"coral2\0"
+	"burlywood1\0"
+	"mediumorchid2\0"
+	"darkgoldenrod4\0"
+	"lightskyblue\0"
+	"salmon2\0"
+	"sandybrown\0"
+	"navajowhite1\0"
+	"lemonchiffon2\0"
+	"gray8\0"
+	"gray63\0"
+	"violetred2\0"
+	"seagreen1\0"
+	"darkseagreen1\0"
+	"paleturquoise3\0"
+	"springgreen2\0"
+	"blanchedalmond\0"
+	"gray80\0"
+	"lightgoldenrod1\0"
+	"antiquewhite\0"
+	"azure1\0"
+	"mediumpurple4\0"
+	"gray28\0"
+	"gray70\0"
+	"green\0"
+	"mediumpurple3\0"
+	"chartreuse\0"
+	"mediumorchid\0"
+	"maroon0\0"
+	"lime\0"
+	"gray3\0"
+	"darkblue\0"
+	"darkolivegreen1\0"
+	"wheat4\0"
+	"lavenderblush4\0"
+	"gray75\0"
+	"lightsalmon2\0"
+	"gray84\0"
+	"darkorange\0"
+	"darkgoldenrod3\0"
+	"burlywood2\0"
+	"orange1\0"
+	"violetred1\0"
+	"gray37\0"
+	"steelblue4\0"
+	"gray18\0"
+	"orchid2\0"
+	"light\0"
+	"salmon3\0"
+	"orchid1\0"
+	"lightcyan1\0"
+	"skyblue\0"
+	"oldlace\0"
+	"gray98\0"
+	"gray21\0"
+	"deeppink3\0"
+	"khaki2\0"
+	"mediumspringgreen\0"
+	"maroon2\0"
+	"tomato3\0"
+	"gray22\0"
+	"firebrick1\0"
+	"mediumorchid4\0"
+	"lightsteelblue\0"
+	"snow\0"
+	"gray50\0"
+	"darkgrey\0"
+	"seagreen\0"
+	"gray5\0"
+	"gray48\0"
+	"gray95\0"
+	"lightpink3\0"
+	"mistyrose\0"
+	"whitesmoke\0"
+	"honeydew\0"
+	"yellow2\0"
+	"tomato\0"
+	"mediumorchid3\0"
+	"navajowhite2\0"
+	"hotpink4\0"
+	"cornsilk2\0"
+	"seagreen2\0"
+	"gray72\0"
+	"darkslategrey\0"
+	"gray58\0"
+	"rosybrown2\0"
+	"gray86\0"
+	"navyblue\0"
+	"lightsalmon1\0"
+	"gray24\0"
+	"tan1\0"
+	"orangered1\0"
+	"slateblue\0"
+	"gray59\0"
+	"gray1\0"
+	"dodgerblue1\0"
+	"mistyrose4\0"
+	"peachpuff1\0"
+	"floralwhite\0"
+	"goldenrod1\0"
+	"plum1\0"
+	"red3\0"
+	"white\0"
+	"deepskyblue\0"
+	"chartreuse1\0"
+	"darkred\0"
+	"paleturquoise\0"
+	"tomato4\0"
+	"azure4\0"
+	"pale\0"
+	"gray62\0"
+	"ivory1\0"
+	"lemonchiffon4\0"
+	"gray61\0"
+	"darkslategray1\0"
+	"gray29\0"
+	"lightskyblue1\0"
+	"gray45\0"
+	"lightcyan4\0"
+	"aquamarine\0"
+	"gray88\0"
+	"honeydew3\0"
+	"gray91\0"
+	"lightgoldenrodyellow\0"
+	"indianred\0"
+	"snow2\0"
+	"darkslategray3\0"
+	"darkorange1\0"
+	"gray90\0"
+	"orchid3\0"
+	"deeppink1\0"
+	"fuchsia\0"
+	"red4\0"
+	"peachpuff4\0"
+	"darkturquoise\0"
+	"darkolivegreen2\0"
+	"snow3\0"
+	"brown1\0"
+	"firebrick2\0"
+	"palevioletred3\0"
+	"gray55\0"
+	"gray30\0"
+	"darkseagreen4\0"
+	"gainsboro\0"
+	"cyan4\0"
+	"lemonchiffon3\0"
+	"purple2\0"
+	"palegreen3\0"
+	"plum4\0"
+	"lightsteelblue1\0"
+	"darkseagreen2\0"
+	"indigo\0"
+	"green3\0"
+	"purple4\0"
+	"crimson\0"
+	"lightgoldenrod4\0"
+	"darkorchid4\0"
+	"lavenderblush\0"
+	"peachpuff3\0"
+	"orangered4\0"
+	"wheat\0"
+	"gray85\0"
+	"aquamarine2\0"
+	"gray6\0"
+	"khaki3\0"
+	"brown\0"
+	"tan\0"
+	"green4\0"
+	"lightblue1\0"
+	"snow1\0"
+	"mediumpurple1\0"
+	"gray32\0"
+	"honeydew1\0"
+	"gray\0"
+	"hotpink3\0"
+	"lawngreen\0"
+	"lightyellow4\0"
+	"olivedrab\0"
+	"gray4\0"
+	"gold1\0"
+	"gold4\0"
+	"paleturquoise1\0"
+	"gray47\0"
+	"lightyellow3\0"
+	"darkorchid3\0"
+	"khaki\0"
+	"rosybrown\0"
+	"thistle4\0"
+	"firebrick3\0"
+	"mediumaquamarine\0"
+	"steelblue\0"
+	"lightgreen\0"
+	"cadetblue\0"
+	"limegreen\0"
+	"salmon4\0"
+	"darkgreen\0"
+	"maroon4\0"
+	"antiquewhite4\0"
+	"steelblue2\0"
+	"indianred4\0"
+	"bisque\0"
+	"lightgray\0"
+	"rosybrown1\0"
+	"darkorchid\0"
+	"seashell3\0"
+	"wheat1\0"
+	"dodgerblue4\0"
+	"aliceblue\0"
+	"gray49\0"
+	"gray36\0"
+	"cadetblue2\0"
+	"thistle2\0"
+	"darkorchid1\0"
+	"lavender\0"
+	"lightgrey\0"
+	"gray74\0"
+	"lightblue4\0"
+	"cornflowerblue\0"
+	"royalblue\0"
+	"yellowgreen\0"
+	"darkmagenta\0"
+	"honeydew4\0"
+	"lightpink4\0"
+	"palevioletred2\0"
+	"slategray3\0"
+	"lightpink1\0"
+	"sienna4\0"
+	"lightskyblue4\0"
+	"olivedrab2\0"
+	"deeppink4\0"
+	"dodgerblue3\0"
+	"gray34\0"
+	"cyan\0"
+	"turquoise\0"
+	"brown4\0"
+	"forestgreen\0"
+	"mediumslateblue\0"
+	"lightgoldenrod2\0"
+	"darkcyan\0"
+	"burlywood\0"
+	"antiquewhite1\0"
+	"purple\0"
+	"mistyrose1\0"
+	"gray57\0"
+	"maroon1\0"
+	"darkseagreen\0"
+	"cornsilk3\0"
+	"gray77\0"
+	"azure\0"
+	"navajowhite\0"
+	"ghostwhite\0"
+	"black\0"
+	"lightslategrey\0"
+	"moccasin\0"
+	"orchid4\0"
+	"linen\0"
+	"magenta3\0"
+	"bisque3\0"
+	"lightcyan2\0"
+	"purple1\0"
+	"blue2\0"
+	"gray73\0"
+	"lightsalmon\0"
+	"gray43\0"
+	"firebrick\0"
+	"darkkhaki\0"
+	"skyblue3\0"
+	"lemonchiffon\0"
+	"orange2\0"
+	"sienna2\0"
+	"mediumpurple\0"
+	"gray20\0"
+	"darkviolet\0"
+	"darkslategray4\0"
+	"brown2\0"
+	"deeppink2\0"
+	"azure3\0"
+	"lightskyblue3\0"
+	"midnightblue\0"
+	"chocolate3\0"
+	"gray41\0"
+	"cadetblue1\0"
+	"lemonchiffon1\0"
+	"dodgerblue\0"
+	"magenta\0"
+	"darkslateblue\0"
+	"grey\0"
+	"coral\0"
+	"darkolivegreen\0"
+	"gray13\0"
+	"red2\0"
+	"seashell1\0"
+	"thistle3\0"
+	"gray76\0"
+	"gold2\0"
+	"cyan2\0"
+	"seagreen4\0"
+	"lightblue\0"
+	"gray54\0"
+	"slategray1\0"
+	"bisque4\0"
+	"coral1\0"
+	"plum\0"
+	"gray39\0"
+	"red\0"
+	"yellow\0"
+	"lightblue2\0"
+	"dimgrey\0"
+	"gray81\0"
+	"royalblue4\0"
+	"lightslateblue\0"
+	"gray60\0"
+	"pink2\0"
+	"royalblue1\0"
+	"orange4\0"
+	"violetred\0"
+	"springgreen\0"
+	"slategray\0"
+	"peru\0"
+	"mediumorchid1\0"
+	"lavenderblush1\0"
+	"navajowhite4\0"
+	"ivory3\0"
+	"gray35\0"
+	"pink1\0"
+	"lightgoldenrod3\0"
+	"violetred4\0"
+	"chocolate\0"
+	"indianred3\0"
+	"aqua\0"
+	"darkgray\0"
+	"blueviolet\0"
+	"royalblue3\0"
+	"palevioletred\0"
+	"pink\0"
+	"seashell\0"
+	"gray23\0"
+	"orangered\0"
+	"sienna\0"
+	"darkslategray\0"
+	"gray25\0"
+	"chartreuse4\0"
+	"mediumseagreen\0"
+	"indianred1\0"
+	"lightyellow\0"
+	"gray44\0"
+	"turquoise3\0"
+	"gray51\0"
+	"seashell2\0"
+	"seagreen3\0"
+	"gray0\0"
+	"springgreen3\0"
+	"magenta2\0"
+	"maroon\0"
+	"slateblue1\0"
+	"seashell4\0"
+	"palegreen1\0"
+	"lightcoral\0"
+	"gray46\0"
+	"gray10\0"
+	"mistyrose2\0"
+	"royalblue2\0"
+	"gold3\0"
+	"dimgray\0"
+	"blue4\0"
+	"gray2\0"
+	"gray99\0"
+	"gray79\0"
+	"pink4\0"
+	"gray66\0"
+	"gray38\0"
+	"bisque1\0"
+	"darkolivegreen3\0"
+	"paleturquoise2\0"
+	"sienna1\0"
+	"gray65\0"
+	"khaki4\0"
+	"azure2\0"
+	"palegoldenrod\0"
+	"tan4\0"
+	"silver\0"
+	"gray15\0"
+	"gray33\0"
+	"chocolate2\0"
+	"cadetblue4\0"
+	"papayawhip\0"
+	"mintcream\0"
+	"gray67\0"
+	"blue\0"
+	"lightsteelblue4\0"
+	"chartreuse3\0"
+	"gray92\0"
+	"gray14\0"
+	"palevioletred1\0"
+	"deeppink\0"
+	"indianred2\0"
+	"gray11\0"
+	"deepskyblue1\0"
+	"dodgerblue2\0"
+	"lightyellow2\0"
+	"snow4\0"
+	"mistyrose3\0"
+	"olivedrab1\0"
+	"rosybrown3\0"
+	"gray53\0"
+	"lightyellow1\0"
+	"coral3\0"
+	"lavenderblush2\0"
+	"gray19\0"
+	"lightskyblue2\0"
+	"orange\0"
+	"slategray4\0"
+	"beige\0"
+	"greenyellow\0"
+	"blue1\0"
+	"palevioletred4\0"
+	"darkslategray2\0"
+	"tan2\0"
+	"turquoise2\0"
+	"chocolate1\0"
+	"deepskyblue2\0"
+	"palegreen4\0"
+	"gray7\0"
+	"darkolivegreen4\0"
+	"khaki1\0"
+	"coral4\0"
+	"lightsteelblue2\0"
+	"plum3\0"
+	"goldenrod\0"
+	"slategrey\0"
+	"springgreen1\0"
+	"medium\0"
+	"rebeccapurple\0"
+	"gray97\0"
+	"gray78\0"
+	"steelblue1\0"
+	"darkgoldenrod2\0"
+	"orange3\0"
+	"gray82\0"
+	"hotpink2\0"
+	"gray52\0"
+	"gray64\0"
+	"ivory2\0"
+	"mediumturquoise\0"
+	"orangered3\0"
+	"violetred3\0"
+	"magenta4\0"
+	"gray93\0"
+	"yellow1\0"
+	"mediumvioletred\0"
+	"lightpink\0"
+	"lightsteelblue3\0"
+	"orangered2\0"
+	"deepskyblue3\0"
+	"tan3\0"
+	"lightpink2\0"
+	"hotpink\0"
+	"gray83\0"
+	"slateblue4\0"
+	"ivory4\0"
+	"yellow3\0"
+	"gray9\0"
+	"purple0\0"
+	"aquamarine4\0"
+	"peachpuff\0"
+	"darksalmon\0"
+	"slateblue2\0"
+	"gray87\0"
+	"palegreen2\0"
+	"wheat3\0"
+	"antiquewhite3\0"
+	"darkgoldenrod1\0"
+	"darkorchid2\0"
+	"aquamarine1\0"
+	"hotpink1\0"
+	"violet\0"
+	"orchid\0"
+	"palegreen\0"
+	"navy\0"
+	"powderblue\0"
+	"skyblue1\0"
+	"chartreuse2\0"
+	"gray69\0"
+	"skyblue4\0"
+	"cornsilk4\0"
+	"salmon1\0"
+	"cyan1\0"
+	"lavenderblush3\0"
+	"lightcyan3\0"
+	"gray31\0"
+	"cornsilk\0"
+	"gray40\0"
+	"cadetblue3\0"
+	"gray42\0"
+	"gray94\0"
+	"steelblue3\0"
+	"goldenrod2\0"
+	"bisque2\0"
+	"teal\0"
+	"peachpuff2\0"
+	"rosybrown4\0"
+	"firebrick4\0"
+	"gray56\0"
+	"gray71\0"
+	"wheat2\0"
+	"tomato2\0"
+	"lightseagreen\0"
+	"skyblue2\0"
+	"tomato1\0"
+	"mediumblue\0"
+	"purple3\0"
+	"gray27\0"
+	"olivedrab4\0"
+	"olive\0"
+	"pink3\0"
+	"gray16\0"
+	"salmon\0"
+	"saddlebrown\0"
+	"goldenrod4\0"
+	"burlywood3\0"
+	"lightcyan\0"
+	"green1\0"
+	"darkorange2\0"
+	"mediumpurple2\0"
+;
+
+
+
+
+#endif //__color_names_table_h__
@@ -0,0 +1,287 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| REVERSE COLOR LOOKUP: FIND THE CLOSEST NAMED COLOR OR PALETTE ENTRY TO AN    |
+| ARBITRARY COLOR_T. THE NAMED COLORS ARE SEARCHED THROUGH THE STATIC K-D TREE |
+| IN COLOR_NAMES_TABLE.H, SO A LOOKUP ONLY VISITS A FEW DOZEN OF THE 562       |
+| ENTRIES. THE SMALL PALETTES ARE SIMPLY SCANNED.                              |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_nearest_h__
+#define __color_nearest_h__
+
+
+
+
+#include "color.h"
+#include "color_names.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NUMBER OF RECENT LOOKUPS REMEMBERED BY THE BULK QUANTIZERS. MUST BE A POWER
+// OF TWO. MOST FRAMES REUSE A HANDFUL OF COLORS, SO EVEN A SMALL CACHE HELPS.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_NEAREST_CACHE
+#ifdef __AVR__
+#define COLOR_NEAREST_CACHE		16
+#else
+#define COLOR_NEAREST_CACHE		256
+#endif
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DISTANCE METRICS
+// RGB:			PLAIN SQUARED EUCLIDEAN DISTANCE
+// PERCEPTUAL:	SQUARED DISTANCE WEIGHTED 3:4:2 FOR R:G:B, A COMMON CHEAP
+//				APPROXIMATION OF HOW MUCH MORE SENSITIVE THE EYE IS TO GREEN
+// REDMEAN:		LIKE PERCEPTUAL, BUT THE RED AND BLUE WEIGHTS SLIDE BETWEEN 2
+//				AND 3 WITH THE AVERAGE RED OF THE TWO COLORS. CLOSER TO CIELAB
+//				THAN ANY FIXED WEIGHTING, AND STILL ALL INTEGER MATH
+////////////////////////////////////////////////////////////////////////////////
+enum COLOR_METRIC {
+	COLOR_METRIC_RGB,
+	COLOR_METRIC_PERCEPTUAL,
+	COLOR_METRIC_REDMEAN,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PER AXIS WEIGHT. FOR REDMEAN THIS IS THE SMALLEST WEIGHT THE AXIS CAN HAVE,
+// WHICH KEEPS THE K-D TREE PRUNING BELOW EXACT
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint8_t color_metric_weight(const COLOR_METRIC metric, const uint8_t axis) {
+	// AXIS 0 = RED, 1 = GREEN, 2 = BLUE
+	if (metric == COLOR_METRIC_RGB) return 1;
+	if (metric == COLOR_METRIC_REDMEAN) return (axis == 1) ? 4 : 2;
+	return (axis == 0) ? 3 : (axis == 1) ? 4 : 2;
+}
+
+
+
+INLINE uint32_t color_distance(const color_t a, const color_t b, const COLOR_METRIC metric=COLOR_METRIC_RGB) {
+	const int16_t dr = (int16_t)a.r - b.r;
+	const int16_t dg = (int16_t)a.g - b.g;
+	const int16_t db = (int16_t)a.b - b.b;
+
+	if (metric == COLOR_METRIC_REDMEAN) {
+		const uint16_t mean = ((uint16_t)a.r + b.r) >> 1;
+		return	(((uint32_t)(512 + mean) * (uint32_t)((int32_t)dr * dr)) >> 8)
+			+	4 * (uint32_t)((int32_t)dg * dg)
+			+	(((uint32_t)(767 - mean) * (uint32_t)((int32_t)db * db)) >> 8);
+	}
+
+	return	(uint32_t)color_metric_weight(metric, 0) * (uint32_t)((int32_t)dr * dr)
+		+	(uint32_t)color_metric_weight(metric, 1) * (uint32_t)((int32_t)dg * dg)
+		+	(uint32_t)color_metric_weight(metric, 2) * (uint32_t)((int32_t)db * db);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// K-D TREE SEARCH STATE
+////////////////////////////////////////////////////////////////////////////////
+struct color_nearest_search_t {
+	color_t			color;
+	COLOR_METRIC	metric;
+	uint32_t		best_distance;
+	uint16_t		best_slot;
+};
+
+
+
+INLINE uint8_t color_nearest_channel(const color_t color, const uint8_t axis) {
+	return (axis == 0) ? color.r : (axis == 1) ? color.g : color.b;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// VISIT THE NODE FOR RANGE [LO, HI), THEN THE HALF ON THE SAME SIDE OF THE
+// SPLIT AS THE TARGET, THEN THE OTHER HALF ONLY IF THE SPLITTING PLANE IS
+// CLOSER THAN THE BEST MATCH SO FAR
+////////////////////////////////////////////////////////////////////////////////
+inline void color_nearest_visit(color_nearest_search_t &search, uint16_t lo, uint16_t hi, uint8_t axis) {
+	if (lo >= hi) return;
+
+	const uint16_t	mid		= lo + (hi - lo) / 2;
+	const uint16_t	slot	= pgm_read_word(&color_names_kd[mid]);
+	const color_t	node	= color_names_color(slot);
+	const uint32_t	dist	= color_distance(search.color, node, search.metric);
+
+	if (dist < search.best_distance) {
+		search.best_distance	= dist;
+		search.best_slot		= slot;
+		if (!dist) return;
+	}
+
+	const int16_t	delta	= (int16_t)color_nearest_channel(search.color, axis) - color_nearest_channel(node, axis);
+	const uint8_t	next	= (axis == 2) ? 0 : axis + 1;
+
+	if (delta < 0) {
+		color_nearest_visit(search, lo, mid, next);
+	} else {
+		color_nearest_visit(search, mid + 1, hi, next);
+	}
+
+	if ((uint32_t)color_metric_weight(search.metric, axis) * (uint32_t)((int32_t)delta * delta) < search.best_distance) {
+		if (delta < 0) {
+			color_nearest_visit(search, mid + 1, hi, next);
+		} else {
+			color_nearest_visit(search, lo, mid, next);
+		}
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FIND THE CLOSEST NAMED COLOR. RETURNS ITS TABLE SLOT, WHICH CAN BE PASSED TO
+// COLOR_NAMES_NAME() AND COLOR_NAMES_COLOR(). WHEN SEVERAL NAMES SHARE THE
+// SAME VALUE (SUCH AS AQUA AND CYAN) ANY ONE OF THEM MAY BE RETURNED
+////////////////////////////////////////////////////////////////////////////////
+inline uint16_t color_nearest_name(const color_t color, const COLOR_METRIC metric=COLOR_METRIC_RGB) {
+	color_nearest_search_t search;
+	search.color			= color;
+	search.metric			= metric;
+	search.best_distance	= 0xffffffff;
+	search.best_slot		= 0;
+
+	color_nearest_visit(search, 0, COLOR_NAMES_COUNT, 0);
+	return search.best_slot;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FIND THE CLOSEST ENTRY IN ANY SMALL PALETTE HELD IN RAM
+////////////////////////////////////////////////////////////////////////////////
+inline uint16_t color_nearest(const color_t *palette, uint16_t size, const color_t color, const COLOR_METRIC metric=COLOR_METRIC_RGB) {
+	uint32_t best_distance	= 0xffffffff;
+	uint16_t best_index		= 0;
+
+	for (uint16_t i=0; i<size; i++) {
+		const uint32_t dist = color_distance(color, palette[i], metric);
+		if (dist < best_distance) {
+			best_distance	= dist;
+			best_index		= i;
+			if (!dist) break;
+		}
+	}
+
+	return best_index;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// FIND THE CLOSEST OF THE 16 COLOR_T::PALETTE() ENTRIES
+////////////////////////////////////////////////////////////////////////////////
+inline uint8_t color_nearest_palette(const color_t color, const COLOR_METRIC metric=COLOR_METRIC_RGB) {
+	color_t palette[16];
+	for (uint8_t i=0; i<16; i++) {
+		palette[i] = color_t::palette(i);
+	}
+	return color_nearest(palette, 16, color, metric);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DIRECT-MAPPED CACHE OF RECENT LOOKUPS FOR THE BULK QUANTIZERS
+////////////////////////////////////////////////////////////////////////////////
+struct color_nearest_cache_t {
+	color_t		key[COLOR_NEAREST_CACHE];
+	uint16_t	value[COLOR_NEAREST_CACHE];
+	bool		used[COLOR_NEAREST_CACHE];
+
+	INLINE color_nearest_cache_t() {
+		memset(this->used, 0, sizeof(this->used));
+	}
+
+	INLINE static uint16_t index(const color_t color) {
+		const uint32_t hash = ((uint32_t)color * 0x9e3779b1ul) >> 16;
+		return hash & (COLOR_NEAREST_CACHE - 1);
+	}
+
+	template <class FUNC>
+	INLINE uint16_t lookup(const color_t color, FUNC search) {
+		const uint16_t i = index(color);
+		if (this->used[i]  &&  this->key[i].g == color.g  &&  this->key[i].r == color.r  &&  this->key[i].b == color.b) {
+			return this->value[i];
+		}
+
+		this->used[i]	= true;
+		this->key[i]	= color;
+		this->value[i]	= search(color);
+		return this->value[i];
+	}
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SNAP EVERY PIXEL IN A BUFFER TO ITS CLOSEST NAMED COLOR
+////////////////////////////////////////////////////////////////////////////////
+inline void color_nearest_quantize(color_t *pixels, size_t count, const COLOR_METRIC metric=COLOR_METRIC_RGB) {
+	color_nearest_cache_t cache;
+
+	for (size_t i=0; i<count; i++) {
+		const uint16_t slot = cache.lookup(pixels[i], [metric](const color_t color) {
+			return color_nearest_name(color, metric);
+		});
+		pixels[i] = color_names_color(slot);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CONVERT EVERY PIXEL IN A BUFFER INTO THE INDEX OF ITS CLOSEST PALETTE ENTRY.
+// BYTE INDEXES ONLY SEARCH THE FIRST 256 ENTRIES, SO LARGER PALETTES NEED THE
+// 16-BIT INDEX VERSION
+////////////////////////////////////////////////////////////////////////////////
+inline void color_nearest_quantize(const color_t *pixels, size_t count, uint16_t *indexes, const color_t *palette, uint16_t size, const COLOR_METRIC metric=COLOR_METRIC_RGB) {
+	color_nearest_cache_t cache;
+
+	for (size_t i=0; i<count; i++) {
+		indexes[i] = cache.lookup(pixels[i], [palette, size, metric](const color_t color) {
+			return color_nearest(palette, size, color, metric);
+		});
+	}
+}
+
+
+
+inline void color_nearest_quantize(const color_t *pixels, size_t count, uint8_t *indexes, const color_t *palette, uint16_t size, const COLOR_METRIC metric=COLOR_METRIC_RGB) {
+	color_nearest_cache_t cache;
+	size = _min(size, (uint16_t)256);
+
+	for (size_t i=0; i<count; i++) {
+		indexes[i] = cache.lookup(pixels[i], [palette, size, metric](const color_t color) {
+			return color_nearest(palette, size, color, metric);
+		});
+	}
+}
+
+
+
+
+#endif //__color_nearest_h__
@@ -0,0 +1,547 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| NETWORK PIXEL RECEIVER FOR E1.31 (SACN), ART-NET (ARTDMX), AND DDP. PACKETS  |
+| ARE DECODED STRAIGHT INTO A COLOR_T FRAME BUFFER, WITH THE RGB CHANNELS FROM |
+| THE WIRE SWIZZLED INTO COLOR_T'S G-R-B ORDER BY THE SAME VECTORIZED COPY AS  |
+| COLOR_ORDER_CONVERT. DMX UNIVERSES ARE MAPPED ONE AFTER ANOTHER ONTO THE     |
+| BUFFER, STALE OR REPEATED SEQUENCE NUMBERS ARE DROPPED, AND A FRAME IS READY |
+| ONCE EVERY UNIVERSE HAS ARRIVED (OR A DDP PUSH FLAG IS SEEN).                |
+|                                                                              |
+| PACKET DECODING WORKS ON MEMORY AND RUNS ANYWHERE. THE RECVMMSG SOCKET IS    |
+| LINUX ONLY.                                                                  |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_net_h__
+#define __color_net_h__
+
+
+
+
+#include <stddef.h>
+#include <string.h>
+#include "color.h"
+#include "color_order.h"
+
+
+
+
+#define COLOR_NET_E131_PORT		5568
+#define COLOR_NET_ARTNET_PORT	6454
+#define COLOR_NET_DDP_PORT		4048
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MOST UNIVERSES ONE RECEIVER TRACKS. 170 RGB PIXELS FIT IN A UNIVERSE, SO THE
+// HOST DEFAULT COVERS ABOUT 350K PIXELS
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_NET_UNIVERSES
+#if defined(ARDUINO)
+#define COLOR_NET_UNIVERSES		16
+#else
+#define COLOR_NET_UNIVERSES		2048
+#endif
+#endif
+
+
+
+
+enum COLOR_NET_PROTOCOL {
+	COLOR_NET_NONE,
+	COLOR_NET_E131,
+	COLOR_NET_ARTNET,
+	COLOR_NET_DDP,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RECEIVER COUNTERS, ALL SINCE THE LAST RESET
+////////////////////////////////////////////////////////////////////////////////
+struct color_net_stats_t {
+	uint32_t	packets;	// PACKETS DECODED INTO THE BUFFER
+	uint32_t	frames;		// COMPLETE FRAMES
+	uint32_t	stale;		// DROPPED FOR AN OLD OR REPEATED SEQUENCE NUMBER
+	uint32_t	ignored;	// VALID PACKETS NOT FOR THIS BUFFER (OTHER UNIVERSES,
+							// OTHER ART-NET OPCODES, PREVIEW DATA)
+	uint32_t	malformed;	// NOT A PACKET OF ANY KNOWN PROTOCOL
+	uint32_t	incomplete;	// FRAMES ABANDONED BEFORE EVERY UNIVERSE ARRIVED
+	uint64_t	channels;	// CHANNEL BYTES COPIED INTO THE BUFFER
+};
+
+
+
+
+class color_net_receiver_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// RECEIVE INTO A FRAME BUFFER. DMX UNIVERSE FIRST LANDS AT PIXEL 0,
+		// AND EACH UNIVERSE CARRIES CHANNELS BYTES (510 = 170 PIXELS IS THE
+		// USUAL SETUP, 512 SPLITS PIXELS ACROSS UNIVERSES, WHICH ALSO WORKS).
+		// FIRST USES E1.31 NUMBERING. ART-NET PORT ADDRESS 0 IS UNIVERSE 1,
+		// SO THE DEFAULT TAKES BOTH PROTOCOLS' FIRST UNIVERSE
+		////////////////////////////////////////////////////////////////////////
+		color_net_receiver_t(color_t *pixels, size_t count, uint16_t first=1, uint16_t channels=510) {
+			this->pixels	= pixels;
+			this->count		= count;
+			this->first		= first;
+			this->channels	= _max(1, _min(channels, 512));
+			this->expected	= (uint16_t)_min(
+				(count * 3 + this->channels - 1) / this->channels,
+				(size_t)COLOR_NET_UNIVERSES
+			);
+			this->reset();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FORGET ALL SEQUENCE NUMBERS, PARTIAL FRAMES, AND COUNTERS
+		////////////////////////////////////////////////////////////////////////
+		void reset() {
+			memset(this->sequences, 0, sizeof(this->sequences));
+			memset(this->tracked, 0, sizeof(this->tracked));
+			memset(this->seen, 0, sizeof(this->seen));
+			memset(&this->counters, 0, sizeof(this->counters));
+			this->arrived	= 0;
+			this->complete	= false;
+			this->ddp		= 0;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DECODE ONE UDP PAYLOAD OF ANY SUPPORTED PROTOCOL. RETURNS WHICH
+		// PROTOCOL IT WAS, OR COLOR_NET_NONE IF IT WAS NOT RECOGNIZED
+		////////////////////////////////////////////////////////////////////////
+		COLOR_NET_PROTOCOL ingest(const uint8_t *packet, size_t length) {
+			if (length >= 18  &&  !memcmp(packet, "Art-Net", 8)) {
+				this->artnet(packet, length);
+				return COLOR_NET_ARTNET;
+			}
+
+			if (length >= 126  &&  packet[0] == 0x00  &&  packet[1] == 0x10
+			&&  !memcmp(packet + 4, "ASC-E1.17\0\0\0", 12)) {
+				this->e131(packet, length);
+				return COLOR_NET_E131;
+			}
+
+			if (length >= 10  &&  (packet[0] & 0xc0) == 0x40) {
+				this->ddp_packet(packet, length);
+				return COLOR_NET_DDP;
+			}
+
+			this->counters.malformed++;
+			return COLOR_NET_NONE;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// TRUE ONCE FOR EACH COMPLETED FRAME, WHICH CAN THEN BE SENT OUT
+		////////////////////////////////////////////////////////////////////////
+		INLINE bool ready() {
+			const bool result = this->complete;
+			this->complete = false;
+			return result;
+		}
+
+		INLINE const color_net_stats_t &stats() const {
+			return this->counters;
+		}
+
+		INLINE uint16_t universes() const {
+			return this->expected;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COPY RGB CHANNEL BYTES FROM THE WIRE INTO THE BUFFER, STARTING AT A
+		// CHANNEL OFFSET (3 PER PIXEL). WHOLE PIXELS GO THROUGH THE VECTOR
+		// SWIZZLE, AND ANY PARTIAL PIXEL AT EITHER END IS DONE BYTE BY BYTE.
+		// ANYTHING PAST THE END OF THE BUFFER IS CLIPPED
+		////////////////////////////////////////////////////////////////////////
+		void copy(size_t offset, const uint8_t *data, size_t length) {
+			const size_t total = this->count * 3;
+			if (offset >= total) return;
+			length = _min(length, total - offset);
+			this->counters.channels += length;
+
+			while (length  &&  offset % 3) {
+				this->channel(offset++, *data++);
+				length--;
+			}
+
+			const size_t whole = length / 3;
+			color_order_convert((const color_rgb_t*)data, this->pixels + offset / 3, whole);
+			data	+= whole * 3;
+			offset	+= whole * 3;
+			length	-= whole * 3;
+
+			while (length--) this->channel(offset++, *data++);
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// E1.31 DATA PACKET. THE FRAMING LAYER STARTS AT BYTE 38 AND THE DMP
+		// LAYER AT 115, WITH THE DMX START CODE AT 125 AND CHANNELS AFTER IT
+		////////////////////////////////////////////////////////////////////////
+		void e131(const uint8_t *packet, size_t length) {
+			if (read32(packet + 18) != 0x00000004  ||  read32(packet + 40) != 0x00000002
+			||  packet[117] != 0x02  ||  packet[118] != 0xa1) {
+				this->counters.malformed++;
+				return;
+			}
+
+			// PREVIEW DATA, STREAM TERMINATION, OR A NON-DMX START CODE.
+			// FORCE SYNCHRONIZATION (0X20) STILL CARRIES PIXELS
+			if ((packet[112] & 0xc0)  ||  packet[125] != 0) {
+				this->counters.ignored++;
+				return;
+			}
+
+			const size_t values = read16(packet + 123);
+			if (!values  ||  values - 1 > length - 126) {
+				this->counters.malformed++;
+				return;
+			}
+
+			this->universe(read16(packet + 113), packet[111], true, packet + 126, values - 1);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ART-NET ARTDMX (OPCODE 0X5000). THE 15 BIT PORT ADDRESS IS THE
+		// UNIVERSE, LENGTH IS BIG ENDIAN, AND CHANNELS START AT BYTE 18.
+		// PORT ADDRESSES COUNT FROM 0 WHERE E1.31 UNIVERSES COUNT FROM 1, SO
+		// THE PORT IS SHIFTED UP BY ONE TO SHARE THE SAME FIRST UNIVERSE
+		////////////////////////////////////////////////////////////////////////
+		void artnet(const uint8_t *packet, size_t length) {
+			if (packet[8] != 0x00  ||  packet[9] != 0x50) {
+				this->counters.ignored++;
+				return;
+			}
+
+			const size_t values = read16(packet + 16);
+			if (values > length - 18) {
+				this->counters.malformed++;
+				return;
+			}
+
+			const uint16_t port = ((packet[15] & 0x7f) << 8) | packet[14];
+			this->universe(port + 1, packet[12], packet[12] != 0, packet + 18, values);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DDP. A 10 BYTE HEADER (14 WITH A TIMECODE), A 32 BIT BYTE OFFSET
+		// INTO THE FRAME, AND A PUSH FLAG ON THE LAST PACKET OF A FRAME
+		////////////////////////////////////////////////////////////////////////
+		void ddp_packet(const uint8_t *packet, size_t length) {
+			const uint8_t	flags	= packet[0];
+			const size_t	header	= (flags & 0x10) ? 14 : 10;
+			const size_t	values	= read16(packet + 8);
+
+			if (length < header  ||  values > length - header) {
+				this->counters.malformed++;
+				return;
+			}
+
+			// QUERIES AND REPLIES CARRY NO PIXELS, AND ONLY RGB 8 BIT DATA
+			// (TYPE 0X0B) FOR THE DISPLAY (ID 1) IS PIXELS. OTHER IDS ARE
+			// CONFIG, STATUS, AND SO ON
+			if ((flags & 0x06)  ||  packet[2] != 0x0b  ||  packet[3] != 0x01) {
+				this->counters.ignored++;
+				return;
+			}
+
+			// 4 BIT SEQUENCE, 0 MEANS NOT USED. DROP REPEATS AND ANY PACKET
+			// FROM THE BACK HALF OF THE SEQUENCE SPACE
+			const uint8_t sequence = packet[1] & 0x0f;
+			if (sequence  &&  this->ddp) {
+				const uint8_t ahead = (sequence - this->ddp) & 0x0f;
+				if (!ahead  ||  ahead >= 8) {
+					this->counters.stale++;
+					return;
+				}
+			}
+			if (sequence) this->ddp = sequence;
+
+			this->copy(read32(packet + 4), packet + header, values);
+			this->counters.packets++;
+
+			if (flags & 0x01) {
+				this->complete = true;
+				this->counters.frames++;
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// A DMX UNIVERSE FROM E1.31 OR ART-NET. SEQUENCE NUMBERS FOLLOW THE
+		// E1.31 RULE: A PACKET UP TO 20 BEHIND THE LAST ONE IS STALE. E1.31
+		// ALWAYS NUMBERS ITS PACKETS, AND 0 IS JUST ANOTHER VALUE AFTER A WRAP.
+		// ART-NET SENDS 0 WHEN IT DOES NOT USE SEQUENCE NUMBERS, SO NUMBERED
+		// IS FALSE THERE AND THE UNIVERSE IS NOT CHECKED AGAINST THE NEXT ONE
+		////////////////////////////////////////////////////////////////////////
+		void universe(uint16_t number, uint8_t sequence, bool numbered, const uint8_t *data, size_t length) {
+			const uint16_t index = number - this->first;
+			if (number < this->first  ||  index >= this->expected) {
+				this->counters.ignored++;
+				return;
+			}
+
+			uint8_t			&known	= this->tracked[index >> 3];
+			const uint8_t	mask	= 1 << (index & 7);
+
+			if (numbered  &&  (known & mask)) {
+				const int8_t ahead = (int8_t)(sequence - this->sequences[index]);
+				if (ahead <= 0  &&  ahead > -20) {
+					this->counters.stale++;
+					return;
+				}
+			}
+
+			this->sequences[index] = sequence;
+			if (numbered) {
+				known |= mask;
+			} else {
+				known &= ~mask;
+			}
+
+			this->copy((size_t)index * this->channels, data, _min(length, (size_t)this->channels));
+			this->counters.packets++;
+
+			// THE SAME UNIVERSE AGAIN BEFORE THE FRAME FILLED UP MEANS A
+			// NEW FRAME HAS STARTED, AND THE LAST ONE NEVER COMPLETED
+			uint8_t &bits = this->seen[index >> 3];
+			const uint8_t bit = 1 << (index & 7);
+			if (bits & bit) {
+				this->counters.incomplete++;
+				memset(this->seen, 0, sizeof(this->seen));
+				this->arrived = 0;
+			}
+
+			bits |= bit;
+			if (++this->arrived == this->expected) {
+				memset(this->seen, 0, (this->expected + 7) >> 3);
+				this->arrived	= 0;
+				this->complete	= true;
+				this->counters.frames++;
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// HELPERS: BIG ENDIAN READS, AND ONE WIRE CHANNEL (R-G-B) INTO ITS
+		// COLOR_T BYTE (G-R-B)
+		////////////////////////////////////////////////////////////////////////
+		static INLINE uint16_t read16(const uint8_t *data) {
+			return (data[0] << 8) | data[1];
+		}
+
+		static INLINE uint32_t read32(const uint8_t *data) {
+			return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+		}
+
+		INLINE void channel(size_t offset, uint8_t value) {
+			static const uint8_t order[3] = {1, 0, 2};
+			((uint8_t*)this->pixels)[offset - offset % 3 + order[offset % 3]] = value;
+		}
+
+
+
+		color_t				*pixels;
+		size_t				count;
+		uint16_t			first;
+		uint16_t			channels;
+		uint16_t			expected;
+		uint16_t			arrived;
+		uint8_t				ddp;
+		bool				complete;
+		uint8_t				sequences[COLOR_NET_UNIVERSES];
+		uint8_t				tracked[(COLOR_NET_UNIVERSES + 7) / 8];	// SEQUENCES[] HOLDS A REAL NUMBER
+		uint8_t				seen[(COLOR_NET_UNIVERSES + 7) / 8];
+		color_net_stats_t	counters;
+};
+
+
+
+
+#if defined(__linux__)
+////////////////////////////////////////////////////////////////////////////////
+// LINUX UDP SOCKET THAT PULLS UP TO COLOR_NET_BATCH PACKETS FROM THE KERNEL
+// PER RECVMMSG CALL, AND FEEDS THEM ALL TO A RECEIVER
+////////////////////////////////////////////////////////////////////////////////
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+
+#ifndef COLOR_NET_BATCH
+#define COLOR_NET_BATCH		64
+#endif
+
+#ifndef COLOR_NET_MTU
+#define COLOR_NET_MTU		1536
+#endif
+
+
+
+class color_net_socket_t {
+	public:
+		color_net_socket_t() {
+			this->fd = -1;
+
+			for (int i=0; i<COLOR_NET_BATCH; i++) {
+				this->vectors[i].iov_base	= this->buffers[i];
+				this->vectors[i].iov_len	= COLOR_NET_MTU;
+				memset(&this->messages[i], 0, sizeof(this->messages[i]));
+				this->messages[i].msg_hdr.msg_iov		= &this->vectors[i];
+				this->messages[i].msg_hdr.msg_iovlen	= 1;
+			}
+		}
+
+		~color_net_socket_t() {
+			this->close();
+		}
+
+		color_net_socket_t(const color_net_socket_t&) = delete;
+		color_net_socket_t &operator=(const color_net_socket_t&) = delete;
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BIND TO A UDP PORT ON EVERY INTERFACE (OR ONLY LOOPBACK), WITH A
+		// LARGE KERNEL BUFFER SO BURSTS OF UNIVERSES ARE NOT DROPPED
+		////////////////////////////////////////////////////////////////////////
+		bool open(uint16_t port, bool loopback=false) {
+			this->close();
+
+			this->fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+			if (this->fd < 0) return false;
+
+			const int on = 1, size = 4 << 20;
+			setsockopt(this->fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+			setsockopt(this->fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+
+			struct sockaddr_in address;
+			memset(&address, 0, sizeof(address));
+			address.sin_family		= AF_INET;
+			address.sin_port		= htons(port);
+			address.sin_addr.s_addr	= htonl(loopback ? INADDR_LOOPBACK : INADDR_ANY);
+
+			if (bind(this->fd, (struct sockaddr*)&address, sizeof(address))) {
+				this->close();
+				return false;
+			}
+
+			return true;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// JOIN THE E1.31 MULTICAST GROUP FOR A UNIVERSE, 239.255.HI.LO
+		////////////////////////////////////////////////////////////////////////
+		bool join(uint16_t universe) {
+			struct ip_mreq request;
+			request.imr_multiaddr.s_addr	= htonl(0xefff0000ul | universe);
+			request.imr_interface.s_addr	= htonl(INADDR_ANY);
+			return !setsockopt(this->fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &request, sizeof(request));
+		}
+
+
+
+		void close() {
+			if (this->fd >= 0) ::close(this->fd);
+			this->fd = -1;
+		}
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PORT ACTUALLY BOUND, FOR WHEN OPEN() WAS GIVEN PORT 0
+		////////////////////////////////////////////////////////////////////////
+		uint16_t port() const {
+			struct sockaddr_in address;
+			socklen_t length = sizeof(address);
+			if (this->fd < 0  ||  getsockname(this->fd, (struct sockaddr*)&address, &length)) return 0;
+			return ntohs(address.sin_port);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// WAIT UP TO TIMEOUT MILLISECONDS FOR PACKETS, THEN DRAIN THE SOCKET
+		// A BATCH AT A TIME INTO THE RECEIVER. RETURNS THE PACKETS READ
+		////////////////////////////////////////////////////////////////////////
+		size_t receive(color_net_receiver_t &receiver, int timeout=0) {
+			if (this->fd < 0) return 0;
+
+			struct pollfd waiting = {this->fd, POLLIN, 0};
+			if (timeout  &&  poll(&waiting, 1, timeout) <= 0) return 0;
+
+			size_t total = 0;
+			while (true) {
+				const int got = recvmmsg(this->fd, this->messages, COLOR_NET_BATCH, 0, nullptr);
+				if (got <= 0) break;
+
+				for (int i=0; i<got; i++) {
+					receiver.ingest(this->buffers[i], this->messages[i].msg_len);
+				}
+
+				total += got;
+				if (got < COLOR_NET_BATCH) break;
+			}
+
+			return total;
+		}
+
+
+
+
+	private:
+		int				fd;
+		struct mmsghdr	messages[COLOR_NET_BATCH];
+		struct iovec	vectors[COLOR_NET_BATCH];
+		uint8_t			buffers[COLOR_NET_BATCH][COLOR_NET_MTU];
+};
+#endif
+
+
+
+
+#endif //__color_net_h__
@@ -0,0 +1,509 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| PIXEL TYPES FOR LED STRIPS THAT DON'T USE THE WS2812B G-R-B ORDER, SUCH AS   |
+| THE APA106 (R-G-B), B-R-G CLONES, AND THE SK6812 RGBW (G-R-B-W). THE BYTE    |
+| ORDER IS A TEMPLATE PARAMETER, SO THE R, G, B (AND W) MEMBERS LAND IN THE    |
+| RIGHT PLACE AT COMPILE TIME AND NOTHING IS SWIZZLED AT RUN TIME. BULK        |
+| CONVERSION BETWEEN ORDERS, INCLUDING WHITE EXTRACTION FOR RGBW STRIPS, IS A  |
+| SINGLE PSHUFB PER FOUR PIXELS ON HOSTS WITH SSSE3.                           |
+|                                                                              |
+| PIXELS HAVE COLOR_T'S CONSTRUCTORS, BLENDS, HEX, HUE, HSV, PALETTE, AND NAME |
+| LOOKUPS. THE 562 NAMED COLOR FUNCTIONS STAY ON COLOR_T ONLY, AND CONVERT     |
+| IMPLICITLY: COLOR_RGBW_T PIXEL = COLOR_T::TOMATO(). INTEGER GETTERS ARE      |
+| EXPLICIT CASTS, AND 32-BIT VALUES ARE 0XWWRRGGBB.                            |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_order_h__
+#define __color_order_h__
+
+
+
+
+#include <stddef.h>
+#include "color.h"
+
+
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ORDER THAT THE COLOR CHANNELS ARE SENT DOWN THE WIRE
+////////////////////////////////////////////////////////////////////////////////
+enum COLOR_ORDER {
+	COLOR_ORDER_RGB,	// APA106
+	COLOR_ORDER_RBG,
+	COLOR_ORDER_GRB,	// WS2812B, SK6812
+	COLOR_ORDER_GBR,
+	COLOR_ORDER_BRG,
+	COLOR_ORDER_BGR,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MEMORY LAYOUT FOR EACH ORDER. THE WHITE CHANNEL ALWAYS COMES LAST
+////////////////////////////////////////////////////////////////////////////////
+template <COLOR_ORDER ORDER, bool WHITE>
+struct color_layout_t;
+
+#define COLOR_LAYOUT(ORDER, A, B, C)										\
+	template <> struct PACKED color_layout_t<ORDER, false> {				\
+		uint8_t A;	uint8_t B;	uint8_t C;									\
+	};																		\
+	template <> struct PACKED color_layout_t<ORDER, true> {					\
+		uint8_t A;	uint8_t B;	uint8_t C;	uint8_t w;						\
+	};
+
+COLOR_LAYOUT(COLOR_ORDER_RGB, r, g, b)
+COLOR_LAYOUT(COLOR_ORDER_RBG, r, b, g)
+COLOR_LAYOUT(COLOR_ORDER_GRB, g, r, b)
+COLOR_LAYOUT(COLOR_ORDER_GBR, g, b, r)
+COLOR_LAYOUT(COLOR_ORDER_BRG, b, r, g)
+COLOR_LAYOUT(COLOR_ORDER_BGR, b, g, r)
+
+#undef COLOR_LAYOUT
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// A PIXEL IN ANY CHANNEL ORDER, WITH OR WITHOUT A WHITE CHANNEL
+////////////////////////////////////////////////////////////////////////////////
+template <COLOR_ORDER ORDER, bool WHITE=false>
+struct PACKED color_basic_t : public color_layout_t<ORDER, WHITE> {
+	typedef color_layout_t<ORDER, WHITE> layout_t;
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// BYTE OFFSET OF EACH CHANNEL, AND THE SIZE OF THE PIXEL
+	////////////////////////////////////////////////////////////////////////////
+	static const uint8_t	R			= offsetof(layout_t, r);
+	static const uint8_t	G			= offsetof(layout_t, g);
+	static const uint8_t	B			= offsetof(layout_t, b);
+	static const uint8_t	W			= 3;
+	static const uint8_t	CHANNELS	= WHITE ? 4 : 3;
+	static const bool		HAS_WHITE	= WHITE;
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// DEFAULT CONSTRUCTOR - ALL ZEROS (BLACK)
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color_basic_t() {
+		for (uint8_t i=0; i<CHANNELS; i++) this->channel(i) = 0;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// COLOR FROM R-G-B VALUES, AND R-G-B-W FOR PIXELS WITH A WHITE CHANNEL
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color_basic_t(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t w=0) {
+		this->channel(R)	= r;
+		this->channel(G)	= g;
+		this->channel(B)	= b;
+		if (WHITE) this->channel(W) = w;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// COLOR FROM A 32-BIT INTEGER IN TRADITIONAL 0XWWRRGGBB ORDER. WITHOUT A
+	// WHITE CHANNEL THE TOP BYTE IS IGNORED, THE SAME AS COLOR_T'S 0X00RRGGBB
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color_basic_t(const uint32_t color)
+		: color_basic_t(color >> 16, color >> 8, color >> 0, color >> 24) {}
+
+	INLINE color_basic_t(const int32_t color)
+		: color_basic_t((uint32_t)color) {}
+
+	#if defined(__ets__)  ||  !defined(ARDUINO)
+	INLINE color_basic_t(long int color)
+		: color_basic_t((uint32_t)color) {}
+	#endif
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// COLOR FROM A 15-BIT INTEGER, OR A HEX COLOR CODE STRING, DECODED THE
+	// SAME WAY AS COLOR_T
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color_basic_t(const int16_t color)		: color_basic_t(color_t(color)) {}
+	INLINE color_basic_t(const uint16_t color)		: color_basic_t(color_t(color)) {}
+	INLINE color_basic_t(const char *string)		: color_basic_t(color_t(string)) {}
+	INLINE color_basic_t(const String string)		: color_basic_t(color_t(string)) {}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERT FROM A COLOR_T, OR FROM ANY OTHER ORDER. GOING FROM RGB TO RGBW
+	// MOVES THE PART SHARED BY ALL THREE CHANNELS INTO WHITE, AND GOING FROM
+	// RGBW TO RGB ADDS WHITE BACK INTO ALL THREE CHANNELS
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color_basic_t(const color_t color) {
+		this->assign(color.r, color.g, color.b, 0, false);
+	}
+
+	template <COLOR_ORDER FROM, bool FROM_WHITE>
+	INLINE color_basic_t(const color_basic_t<FROM, FROM_WHITE> &color) {
+		this->assign(
+			color.channel(color.R),
+			color.channel(color.G),
+			color.channel(color.B),
+			FROM_WHITE ? color.channel(color.W) : 0,
+			FROM_WHITE
+		);
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERT BACK TO A COLOR_T, FOLDING WHITE INTO THE OTHER CHANNELS
+	////////////////////////////////////////////////////////////////////////////
+	INLINE operator color_t() const {
+		const uint8_t w = WHITE ? this->channel(W) : 0;
+		return color_t(
+			_min(255, this->channel(R) + w),
+			_min(255, this->channel(G) + w),
+			_min(255, this->channel(B) + w)
+		);
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// GETTERS AS INTEGERS. 15-BIT VALUES GO THROUGH COLOR_T, SO WHITE IS
+	// FOLDED IN. 32-BIT VALUES ARE 0XWWRRGGBB, MATCHING THE CONSTRUCTOR. THESE
+	// ARE EXPLICIT, SO COLOR_T(PIXEL) STILL PICKS THE COLOR_T CONVERSION
+	////////////////////////////////////////////////////////////////////////////
+	INLINE explicit operator int16_t() const {
+		return (int16_t)color_t(*this);
+	}
+
+	INLINE explicit operator uint16_t() const {
+		return (uint16_t)color_t(*this);
+	}
+
+	INLINE explicit operator int32_t() const {
+		return (int32_t)(uint32_t)*this;
+	}
+
+	INLINE explicit operator uint32_t() const {
+		return	((uint32_t)(WHITE ? this->channel(W) : 0) << 24)
+			|	((uint32_t)this->channel(R) << 16)
+			|	((uint32_t)this->channel(G) << 8)
+			|	((uint32_t)this->channel(B) << 0);
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// RAW ACCESS TO A CHANNEL BY ITS BYTE OFFSET
+	////////////////////////////////////////////////////////////////////////////
+	INLINE uint8_t &channel(uint8_t offset) {
+		return ((uint8_t*)this)[offset];
+	}
+
+	INLINE uint8_t channel(uint8_t offset) const {
+		return ((const uint8_t*)this)[offset];
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// GET DATA IN LED STRIP ORDER, FIRST BYTE ON THE WIRE IS THE HIGHEST
+	////////////////////////////////////////////////////////////////////////////
+	INLINE uint32_t wire() const {
+		uint32_t value = 0;
+		for (uint8_t i=0; i<CHANNELS; i++) value = (value << 8) | this->channel(i);
+		return value;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// THE SAME BLENDS AS COLOR_T. A PIXEL OR SINGLE VALUE APPLIES TO EVERY
+	// CHANNEL INCLUDING WHITE, AND SEPARATE R-G-B VALUES LEAVE WHITE ALONE
+	////////////////////////////////////////////////////////////////////////////
+	#define COLOR_BASIC_OP(NAME)																\
+		INLINE color_basic_t NAME(const color_basic_t color) {								\
+			return this->template apply<&color_basic_t::NAME##_channel>(color, CHANNELS);	\
+		}																					\
+		INLINE color_basic_t NAME(const uint8_t value) {									\
+			return this->NAME(color_basic_t(value, value, value, value));					\
+		}																					\
+		INLINE color_basic_t NAME(const uint8_t r, const uint8_t g, const uint8_t b) {		\
+			return this->template apply<&color_basic_t::NAME##_channel>(color_basic_t(r, g, b), 3);	\
+		}
+
+	COLOR_BASIC_OP(min)
+	COLOR_BASIC_OP(max)
+	COLOR_BASIC_OP(add)
+	COLOR_BASIC_OP(sub)
+	COLOR_BASIC_OP(screen)
+	COLOR_BASIC_OP(multiply)
+	COLOR_BASIC_OP(left)
+	COLOR_BASIC_OP(right)
+
+	#undef COLOR_BASIC_OP
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// BLEND TOWARDS ANOTHER PIXEL, ROUNDED THE SAME WAY AS COLOR_T::BLEND
+	////////////////////////////////////////////////////////////////////////////
+	INLINE color_basic_t blend(const color_basic_t color, const uint8_t alpha) {
+		for (uint8_t i=0; i<CHANNELS; i++) {
+			this->channel(i) = color_t::blend(this->channel(i), color.channel(i), alpha);
+		}
+		return *this;
+	}
+
+	static INLINE color_basic_t lerp(color_basic_t a, const color_basic_t b, const uint8_t alpha) {
+		return a.blend(b, alpha);
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// HEX COLOR CODES, FROM THE PIXEL WITH WHITE FOLDED IN
+	////////////////////////////////////////////////////////////////////////////
+	INLINE String hex(COLOR_HEX_TYPE type) const {
+		color_t color = *this;
+		return color.hex(type);
+	}
+
+	INLINE const char *hex(char *buffer, COLOR_HEX_TYPE type=COLOR_HEX_NORMAL) const {
+		color_t color = *this;
+		return color.hex(buffer, type);
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// COLOR_T'S STATIC CONSTRUCTORS. THE NAMED COLOR FUNCTIONS ARE NOT
+	// REPEATED HERE. USE COLOR_T::TOMATO() AND SO ON, WHICH CONVERT IMPLICITLY
+	////////////////////////////////////////////////////////////////////////////
+	static INLINE color_basic_t hue(const uint16_t hue)			{ return color_t::hue(hue); }
+	static INLINE color_basic_t palette(const uint8_t index)	{ return color_t::palette(index); }
+	static INLINE color_basic_t from_name(const char *name)		{ return color_t::from_name(name); }
+
+	static INLINE color_basic_t from_hsv(uint16_t hue, uint8_t sat, uint8_t val) {
+		return color_t::from_hsv(hue, sat, val);
+	}
+
+	static INLINE color_basic_t from_hsl(uint16_t hue, uint8_t sat, uint8_t light) {
+		return color_t::from_hsl(hue, sat, light);
+	}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// PER CHANNEL BLENDS, AND A LOOP OVER THE FIRST CHANNELS BYTES. WHITE
+		// IS ALWAYS THE LAST BYTE, SO 3 COVERS JUST R, G, AND B
+		////////////////////////////////////////////////////////////////////////
+		static INLINE uint8_t min_channel(uint8_t a, uint8_t b)		{ return _min(a, b); }
+		static INLINE uint8_t max_channel(uint8_t a, uint8_t b)		{ return _max(a, b); }
+		static INLINE uint8_t add_channel(uint8_t a, uint8_t b)		{ return _min(255, a + b); }
+		static INLINE uint8_t sub_channel(uint8_t a, uint8_t b)		{ return _max(0, a - b); }
+		static INLINE uint8_t screen_channel(uint8_t a, uint8_t b)	{ return 255 - (((uint16_t)(255 - b) * (uint8_t)(255 - a)) >> 8); }
+		static INLINE uint8_t multiply_channel(uint8_t a, uint8_t b)	{ return ((uint16_t)b * a) >> 8; }
+		static INLINE uint8_t left_channel(uint8_t a, uint8_t b)		{ return a << b; }
+		static INLINE uint8_t right_channel(uint8_t a, uint8_t b)	{ return a >> b; }
+
+		template <uint8_t (*OP)(uint8_t, uint8_t)>
+		INLINE color_basic_t apply(const color_basic_t color, const uint8_t channels) {
+			for (uint8_t i=0; i<channels; i++) {
+				this->channel(i) = OP(this->channel(i), color.channel(i));
+			}
+			return *this;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// STORE R-G-B(-W) FROM ANOTHER PIXEL, EXTRACTING OR FOLDING WHITE
+		////////////////////////////////////////////////////////////////////////
+		INLINE void assign(uint8_t r, uint8_t g, uint8_t b, uint8_t w, bool has_white) {
+			if (WHITE  &&  !has_white) {
+				w  = _min(_min(r, g), b);
+				r -= w;
+				g -= w;
+				b -= w;
+			} else if (!WHITE  &&  has_white) {
+				r = _min(255, r + w);
+				g = _min(255, g + w);
+				b = _min(255, b + w);
+			}
+
+			this->channel(R)	= r;
+			this->channel(G)	= g;
+			this->channel(B)	= b;
+			if (WHITE) this->channel(W) = w;
+		}
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// COMMON STRIP TYPES. COLOR_GRB_T HAS THE SAME LAYOUT AS COLOR_T
+////////////////////////////////////////////////////////////////////////////////
+typedef color_basic_t<COLOR_ORDER_RGB>			color_rgb_t;
+typedef color_basic_t<COLOR_ORDER_GRB>			color_grb_t;
+typedef color_basic_t<COLOR_ORDER_BRG>			color_brg_t;
+typedef color_basic_t<COLOR_ORDER_RGB, true>	color_rgbw_t;
+typedef color_basic_t<COLOR_ORDER_GRB, true>	color_grbw_t;
+
+static_assert(sizeof(color_grb_t) == sizeof(color_t),	"color_grb_t must match color_t");
+static_assert(sizeof(color_grbw_t) == 4,				"rgbw pixels must be 4 bytes");
+
+
+
+
+#if defined(__SSSE3__)
+////////////////////////////////////////////////////////////////////////////////
+// SSSE3 CONVERSION, FOUR PIXELS PER LOOP. RETURNS HOW MANY PIXELS WERE DONE,
+// AND THE CALLER FINISHES THE REST ONE AT A TIME. THE 16 BYTE LOADS AND STORES
+// RUN PAST THE FOUR PIXELS, SO THE LOOP STOPS EARLY ENOUGH TO STAY INSIDE
+// BOTH BUFFERS. 3 BYTE TO 3 BYTE COPIES THE EXTRA BYTES THROUGH UNCHANGED, SO
+// CONVERTING A BUFFER IN PLACE IS SAFE
+////////////////////////////////////////////////////////////////////////////////
+template <class FROM, class TO>
+inline size_t color_order_convert_ssse3(const uint8_t *src, uint8_t *dst, size_t count) {
+	const uint8_t	in		= FROM::CHANNELS;
+	const uint8_t	out		= TO::CHANNELS;
+	const uint8_t	from[3]	= {FROM::R, FROM::G, FROM::B};
+	const uint8_t	to[3]	= {TO::R, TO::G, TO::B};
+
+	// ORDER MOVES EACH CHANNEL, SPREAD COPIES ONE CHANNEL OVER ALL OF A PIXEL
+	uint8_t order[16], white[16], spread[3][16];
+	for (uint8_t i=0; i<16; i++) {
+		order[i] = white[i] = spread[0][i] = spread[1][i] = spread[2][i] = 0x80;
+	}
+
+	for (uint8_t p=0; p<4; p++) {
+		for (uint8_t c=0; c<3; c++) {
+			order[p * out + to[c]] = p * in + from[c];
+			for (uint8_t i=0; i<out; i++) spread[c][p * out + i] = p * in + from[c];
+		}
+
+		if (in == 4  &&  out == 4) {
+			order[p * 4 + TO::W] = p * 4 + FROM::W;
+		} else if (in == 4) {
+			for (uint8_t c=0; c<3; c++) white[p * 3 + to[c]] = p * 4 + FROM::W;
+		}
+	}
+
+	// GOING TO RGBW, WHITE IS A BYTE MASK OVER THE WHITE CHANNEL INSTEAD
+	if (in == 3  &&  out == 4) {
+		for (uint8_t i=0; i<16; i++) white[i] = (i % 4 == TO::W) ? 0xff : 0x00;
+	}
+
+	if (in == 3  &&  out == 3) {
+		for (uint8_t i=12; i<16; i++) order[i] = i;
+	}
+
+	const __m128i	shuffle	= _mm_loadu_si128((const __m128i*)order);
+	const __m128i	extra	= _mm_loadu_si128((const __m128i*)white);
+	const __m128i	red		= _mm_loadu_si128((const __m128i*)spread[0]);
+	const __m128i	green	= _mm_loadu_si128((const __m128i*)spread[1]);
+	const __m128i	blue	= _mm_loadu_si128((const __m128i*)spread[2]);
+
+	// BOTH BUFFERS NEED 16 BYTES FROM THE START OF EVERY GROUP OF FOUR
+	size_t i = 0;
+	for (; i * in + 16 <= count * in  &&  i * out + 16 <= count * out; i += 4) {
+		const __m128i pixels = _mm_loadu_si128((const __m128i*)(src + i * in));
+		__m128i result = _mm_shuffle_epi8(pixels, shuffle);
+
+		if (in == 4  &&  out == 3) {
+			// FOLD WHITE BACK INTO R, G, AND B
+			result = _mm_adds_epu8(result, _mm_shuffle_epi8(pixels, extra));
+		} else if (in == 3  &&  out == 4) {
+			// THE SMALLEST CHANNEL BECOMES WHITE, AND COMES OFF R, G, AND B
+			const __m128i least = _mm_min_epu8(_mm_min_epu8(
+				_mm_shuffle_epi8(pixels, red),
+				_mm_shuffle_epi8(pixels, green)),
+				_mm_shuffle_epi8(pixels, blue)
+			);
+			result = _mm_or_si128(
+				_mm_subs_epu8(result, _mm_andnot_si128(extra, least)),
+				_mm_and_si128(extra, least)
+			);
+		}
+
+		_mm_storeu_si128((__m128i*)(dst + i * out), result);
+	}
+
+	return i;
+}
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CONVERT A WHOLE BUFFER FROM ONE PIXEL TYPE TO ANOTHER. THE SOURCE AND
+// DESTINATION MAY BE THE SAME BUFFER WHEN THE PIXELS ARE THE SAME SIZE, OR
+// WHEN GOING FROM RGBW DOWN TO RGB. OTHERWISE THEY MUST NOT OVERLAP
+////////////////////////////////////////////////////////////////////////////////
+template <class FROM, class TO>
+inline void color_order_convert(const FROM *src, TO *dst, size_t count) {
+	size_t i = 0;
+
+	#if defined(__SSSE3__)
+	i = color_order_convert_ssse3<FROM, TO>((const uint8_t*)src, (uint8_t*)dst, count);
+	#endif
+
+	for (; i<count; i++) {
+		dst[i] = TO(src[i]);
+	}
+}
+
+
+
+template <class TO>
+INLINE void color_order_convert(const color_t *src, TO *dst, size_t count) {
+	color_order_convert((const color_grb_t*)src, dst, count);
+}
+
+
+
+template <class FROM>
+INLINE void color_order_convert(const FROM *src, color_t *dst, size_t count) {
+	color_order_convert(src, (color_grb_t*)dst, count);
+}
+
+
+
+
+#endif //__color_order_h__
@@ -0,0 +1,448 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| FIXED RATE FRAME PACER. EACH FRAME RUNS RENDER, ENCODE, AND OUTPUT STAGES    |
+| ON A FIXED SCHEDULE, AND EVERY STAGE IS TIMED INTO A LOG2 HISTOGRAM, ALONG   |
+| WITH HOW LATE EACH FRAME STARTED AND HOW MUCH THE FRAME INTERVAL WOBBLED.    |
+| WHEN A FRAME MISSES ITS DEADLINE, THE SLOWEST STAGE OF THAT FRAME IS BLAMED, |
+| SO EFFECT MATH AND TRANSMISSION CAN BE TOLD APART AS THE CAUSE. A SIMULATED  |
+| OUTPUT BUS IS INCLUDED FOR TESTING WITHOUT HARDWARE.                         |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_pacer_h__
+#define __color_pacer_h__
+
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include "inline.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HISTOGRAM BUCKETS. BUCKET N HOLDS TIMES FROM 2^(N-1) UP TO 2^N MICROSECONDS,
+// SO 21 BUCKETS REACH JUST OVER A SECOND, AND ANYTHING LONGER LANDS IN THE LAST
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_PACER_BUCKETS
+#define COLOR_PACER_BUCKETS		21
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// WAITING FOR THE NEXT FRAME SLEEPS UNTIL THIS CLOSE TO IT, THEN SPINS ON THE
+// CLOCK. HOST SLEEPS CAN OVERSHOOT, MICROCONTROLLER DELAYS DO NOT
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_PACER_SPIN_US
+#if defined(ARDUINO)
+#define COLOR_PACER_SPIN_US		0
+#else
+#define COLOR_PACER_SPIN_US		200
+#endif
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// THE TIMED STAGES OF A FRAME. FRAME IS THE WHOLE OF RENDER TO OUTPUT, LATENESS
+// IS HOW LONG AFTER ITS SLOT A FRAME STARTED, AND JITTER IS HOW FAR THE TIME
+// BETWEEN TWO FRAME STARTS WAS FROM THE TARGET PERIOD
+////////////////////////////////////////////////////////////////////////////////
+enum COLOR_PACER_STAGE {
+	COLOR_PACER_RENDER,
+	COLOR_PACER_ENCODE,
+	COLOR_PACER_OUTPUT,
+	COLOR_PACER_FRAME,
+	COLOR_PACER_LATENESS,
+	COLOR_PACER_JITTER,
+	COLOR_PACER_STAGES,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// LOG2 HISTOGRAM OF TIMES IN MICROSECONDS. RECORDING IS A COUNT LEADING ZEROS
+// AND A FEW ADDS, SO IT IS CHEAP ENOUGH TO RUN ON EVERY FRAME
+////////////////////////////////////////////////////////////////////////////////
+struct color_histogram_t {
+	uint32_t	buckets[COLOR_PACER_BUCKETS];
+	uint32_t	count;
+	uint32_t	least;
+	uint32_t	most;
+	uint64_t	total;
+
+
+
+	INLINE color_histogram_t() {
+		this->reset();
+	}
+
+
+
+	INLINE void reset() {
+		memset(this->buckets, 0, sizeof(this->buckets));
+		this->count	= 0;
+		this->least	= 0xffffffff;
+		this->most	= 0;
+		this->total	= 0;
+	}
+
+
+
+	INLINE void record(uint32_t us) {
+		this->buckets[bucket(us)]++;
+		this->count++;
+		this->total += us;
+		if (us < this->least)	this->least	= us;
+		if (us > this->most)	this->most	= us;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// SUMMARY VALUES, ALL ZERO WHEN NOTHING HAS BEEN RECORDED
+	////////////////////////////////////////////////////////////////////////////
+	INLINE uint32_t min() const {
+		return this->count ? this->least : 0;
+	}
+
+	INLINE uint32_t max() const {
+		return this->most;
+	}
+
+	INLINE uint32_t mean() const {
+		return this->count ? (uint32_t)(this->total / this->count) : 0;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ESTIMATE A PERCENTILE (0 TO 100), ASSUMING TIMES ARE SPREAD EVENLY
+	// ACROSS EACH BUCKET. THE RESULT IS ALWAYS BETWEEN MIN() AND MAX()
+	////////////////////////////////////////////////////////////////////////////
+	uint32_t percentile(uint8_t pct) const {
+		if (!this->count) return 0;
+
+		// RANK 1 IS THE SMALLEST TIME, SO THE 0TH PERCENTILE IS RANK 1 AS WELL
+		const uint32_t rank = _max((uint32_t)1, (uint32_t)(((uint64_t)this->count * _min(pct, 100) + 99) / 100));
+		uint32_t seen = 0;
+
+		for (uint8_t i=0; i<COLOR_PACER_BUCKETS; i++) {
+			if (seen + this->buckets[i] < rank) {
+				seen += this->buckets[i];
+				continue;
+			}
+
+			const uint32_t low	= i ? (1ul << (i - 1)) : 0;
+			const uint32_t high	= (i < COLOR_PACER_BUCKETS - 1) ? (i ? (1ul << i) : 0) : this->most;
+			const uint32_t est	= low + (uint32_t)((uint64_t)(high - low) * (rank - seen) / this->buckets[i]);
+			return _max(this->min(), _min(est, this->most));
+		}
+
+		return this->most;
+	}
+
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// BUCKET FOR A TIME: ITS BIT LENGTH, SO 0 IS BUCKET 0 AND 1 IS BUCKET 1
+	////////////////////////////////////////////////////////////////////////////
+	static INLINE uint8_t bucket(uint32_t us) {
+		const uint8_t bits = us ? (uint8_t)(sizeof(long) * 8 - __builtin_clzl(us)) : 0;
+		return _min(bits, (uint8_t)(COLOR_PACER_BUCKETS - 1));
+	}
+};
+
+
+
+
+class color_pacer_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// PACE FRAMES AT A TARGET RATE. THE FIRST FRAME IS DUE IMMEDIATELY
+		////////////////////////////////////////////////////////////////////////
+		color_pacer_t(uint16_t fps) {
+			this->interval	= 1000000ul / _max(fps, 1);
+			this->next		= (uint32_t)micros();
+			this->previous	= this->next;
+			this->reset();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RUN A COMPLETE FRAME: WAIT FOR ITS SLOT, THEN RUN AND TIME EACH
+		// STAGE. ANY CALLABLE WORKS FOR THE STAGES, INCLUDING LAMBDAS
+		////////////////////////////////////////////////////////////////////////
+		template <class RENDER, class ENCODE, class OUTPUT>
+		INLINE void frame(RENDER render, ENCODE encode, OUTPUT output) {
+			this->wait();
+			this->begin();
+			render();
+			this->lap(COLOR_PACER_RENDER);
+			encode();
+			this->lap(COLOR_PACER_ENCODE);
+			output();
+			this->lap(COLOR_PACER_OUTPUT);
+			this->end();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FOR A MAIN LOOP THAT DOES OTHER WORK: DUE() SAYS WHETHER THE NEXT
+		// FRAME SHOULD START, AND WAIT() BLOCKS UNTIL IT SHOULD
+		////////////////////////////////////////////////////////////////////////
+		INLINE bool due() const {
+			return (int32_t)((uint32_t)micros() - this->next) >= 0;
+		}
+
+		void wait() const {
+			int32_t remaining = (int32_t)(this->next - (uint32_t)micros());
+
+			while (remaining > COLOR_PACER_SPIN_US) {
+				// ARDUINO DELAYMICROSECONDS() ONLY HANDLES UP TO 16MS AT ONCE
+				delayMicroseconds(_min(remaining - COLOR_PACER_SPIN_US, (int32_t)10000));
+				remaining = (int32_t)(this->next - (uint32_t)micros());
+			}
+
+			while (!this->due()) {}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// TIME THE STAGES BY HAND: BEGIN() AT THE START OF THE FRAME, LAP()
+		// AFTER EACH STAGE, END() ONCE THE FRAME IS OUT. A FRAME THAT STARTS
+		// ONE OR MORE WHOLE PERIODS LATE GIVES UP THOSE SLOTS AS DROPPED,
+		// RATHER THAN RUSHING THROUGH FRAMES TO CATCH UP
+		////////////////////////////////////////////////////////////////////////
+		void begin() {
+			const uint32_t now	= (uint32_t)micros();
+			uint32_t late		= (int32_t)(now - this->next) > 0 ? now - this->next : 0;
+
+			if (late >= this->interval) {
+				const uint32_t slots = late / this->interval;
+				this->skipped	+= slots;
+				this->next		+= slots * this->interval;
+				late			-= slots * this->interval;
+			}
+
+			if (this->count) {
+				const int32_t wobble = (int32_t)(now - this->previous - this->interval);
+				this->stats[COLOR_PACER_JITTER].record(wobble < 0 ? -wobble : wobble);
+			}
+
+			this->stats[COLOR_PACER_LATENESS].record(late);
+			this->previous	= now;
+			this->started	= now;
+			this->lapped	= now;
+			memset(this->times, 0, sizeof(this->times));
+		}
+
+
+
+		INLINE void lap(COLOR_PACER_STAGE stage) {
+			const uint32_t now = (uint32_t)micros();
+			this->times[stage] += now - this->lapped;
+			this->stats[stage].record(now - this->lapped);
+			this->lapped = now;
+		}
+
+
+
+		void end() {
+			const uint32_t now = (uint32_t)micros();
+			this->stats[COLOR_PACER_FRAME].record(now - this->started);
+
+			// THE DEADLINE IS THE START OF THE NEXT SLOT
+			this->next += this->interval;
+			if ((int32_t)(now - this->next) > 0) {
+				this->missed++;
+
+				uint8_t worst = COLOR_PACER_RENDER;
+				for (uint8_t i=COLOR_PACER_ENCODE; i<=COLOR_PACER_OUTPUT; i++) {
+					if (this->times[i] > this->times[worst]) worst = i;
+				}
+				this->blamed[worst]++;
+			}
+
+			this->count++;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COUNTERS AND HISTOGRAMS. BLAME() IS HOW MANY MISSED DEADLINES HAD
+		// THE GIVEN STAGE AS THE SLOWEST PART OF THE FRAME
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint32_t frames() const			{ return this->count; }
+		INLINE uint32_t misses() const			{ return this->missed; }
+		INLINE uint32_t dropped() const			{ return this->skipped; }
+		INLINE uint32_t period() const			{ return this->interval; }
+
+		INLINE uint32_t blame(COLOR_PACER_STAGE stage) const {
+			return stage <= COLOR_PACER_OUTPUT ? this->blamed[stage] : 0;
+		}
+
+		INLINE const color_histogram_t &histogram(COLOR_PACER_STAGE stage) const {
+			return this->stats[stage];
+		}
+
+
+
+		void reset() {
+			for (uint8_t i=0; i<COLOR_PACER_STAGES; i++) this->stats[i].reset();
+			memset(this->blamed, 0, sizeof(this->blamed));
+			memset(this->times, 0, sizeof(this->times));
+			this->count		= 0;
+			this->missed	= 0;
+			this->skipped	= 0;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// WRITE A PLAIN TEXT REPORT, ONE LINE PER STAGE, FOR A PERIODIC DUMP TO
+		// A SERIAL PORT OR LOG. RETURNS THE LENGTH, AS SNPRINTF DOES
+		////////////////////////////////////////////////////////////////////////
+		size_t summary(char *buffer, size_t size) const {
+			static const char *const names[COLOR_PACER_STAGES] = {
+				"render", "encode", "output", "frame", "late", "jitter",
+			};
+
+			size_t length = snprintf(buffer, size,
+				"frames %lu missed %lu dropped %lu blame %lu/%lu/%lu\n",
+				(unsigned long) this->count,
+				(unsigned long) this->missed,
+				(unsigned long) this->skipped,
+				(unsigned long) this->blamed[COLOR_PACER_RENDER],
+				(unsigned long) this->blamed[COLOR_PACER_ENCODE],
+				(unsigned long) this->blamed[COLOR_PACER_OUTPUT]
+			);
+
+			for (uint8_t i=0; i<COLOR_PACER_STAGES; i++) {
+				const color_histogram_t &stat = this->stats[i];
+				length += snprintf(
+					buffer + _min(length, size), size - _min(length, size),
+					"%-6s mean %lu p50 %lu p99 %lu max %lu us\n",
+					names[i],
+					(unsigned long) stat.mean(),
+					(unsigned long) stat.percentile(50),
+					(unsigned long) stat.percentile(99),
+					(unsigned long) stat.max()
+				);
+			}
+
+			return length;
+		}
+
+
+
+
+	private:
+		color_histogram_t	stats[COLOR_PACER_STAGES];
+		uint32_t			times[COLOR_PACER_OUTPUT + 1];
+		uint32_t			blamed[COLOR_PACER_OUTPUT + 1];
+		uint32_t			interval;
+		uint32_t			next;
+		uint32_t			previous;
+		uint32_t			started;
+		uint32_t			lapped;
+		uint32_t			count;
+		uint32_t			missed;
+		uint32_t			skipped;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SIMULATED OUTPUT BUS FOR TESTING THE PACER WITHOUT LEDS ATTACHED. A WRITE
+// OCCUPIES THE BUS FOR AS LONG AS THE BYTES (PLUS THE LATCH/RESET GAP) WOULD
+// TAKE AT THE GIVEN BIT RATE. A BLOCKING SINK WAITS FOR EACH WRITE TO FINISH,
+// LIKE BIT-BANGED OUTPUT. OTHERWISE IT RETURNS AT ONCE, LIKE DMA, AND ONLY THE
+// NEXT WRITE WAITS FOR THE BUS TO COME FREE
+////////////////////////////////////////////////////////////////////////////////
+class color_pacer_sink_t {
+	public:
+		color_pacer_sink_t(uint32_t bits_per_second, uint16_t reset_us=300, bool blocking=true) {
+			this->rate		= bits_per_second;
+			this->reset		= reset_us;
+			this->blocking	= blocking;
+			this->idle		= (uint32_t)micros();
+			this->sent		= 0;
+			this->writes	= 0;
+			this->stalled	= 0;
+		}
+
+
+
+		void write(const uint8_t *data, size_t length) {
+			(void) data;
+
+			const uint32_t start = (uint32_t)micros();
+			this->settle();
+			this->stalled += (uint32_t)micros() - start;
+
+			this->idle = (uint32_t)micros() + this->duration(length);
+			if (this->blocking) this->settle();
+
+			this->sent += length;
+			this->writes++;
+		}
+
+
+
+		INLINE uint32_t duration(size_t length) const {
+			return (uint32_t)((uint64_t)length * 8000000ul / this->rate) + this->reset;
+		}
+
+		INLINE bool busy() const {
+			return (int32_t)(this->idle - (uint32_t)micros()) > 0;
+		}
+
+		INLINE uint64_t bytes() const		{ return this->sent; }
+		INLINE uint32_t frames() const		{ return this->writes; }
+		INLINE uint32_t waited() const		{ return this->stalled; }
+
+
+
+	private:
+		INLINE void settle() const {
+			while (this->busy()) {}
+		}
+
+		uint32_t	rate;
+		uint32_t	idle;
+		uint32_t	stalled;
+		uint32_t	writes;
+		uint64_t	sent;
+		uint16_t	reset;
+		bool		blocking;
+};
+
+
+
+
+#endif //__color_pacer_h__
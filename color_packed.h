@@ -0,0 +1,280 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| TWO BYTES PER PIXEL FRAME STORAGE, IN RGB555 (0B0RRRRRGGGGGBBBBB, THE SAME   |
+| AS COLOR_T'S 15-BIT CONVERSIONS) OR RGB565 (0BRRRRRGGGGGGBBBBB). A FRAME     |
+| TAKES TWO THIRDS OF THE MEMORY OF COLOR_T, AND IS EXPANDED BACK TO G-R-B     |
+| COLOR_T A CHUNK AT A TIME WHEN IT IS SENT. EXPANSION REPEATS EACH CHANNEL'S  |
+| TOP BITS INTO ITS LOW BITS, SO FULL BRIGHTNESS STAYS AT 255, AND PACKING AN  |
+| EXPANDED PIXEL AGAIN ALWAYS GIVES BACK THE SAME VALUE.                       |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_packed_h__
+#define __color_packed_h__
+
+
+
+
+#include <stddef.h>
+#include "color.h"
+
+
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+
+
+
+enum COLOR_PACKED {
+	COLOR_PACKED_555,
+	COLOR_PACKED_565,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SINGLE PIXEL CONVERSIONS. PACKING KEEPS THE TOP BITS OF EACH CHANNEL
+////////////////////////////////////////////////////////////////////////////////
+template <COLOR_PACKED FORMAT>
+INLINE uint16_t color_pack(const color_t color) {
+	if (FORMAT == COLOR_PACKED_565) {
+		return ((color.r & 0xf8) << 8) | ((color.g & 0xfc) << 3) | (color.b >> 3);
+	}
+	return (uint16_t)color;
+}
+
+
+
+template <COLOR_PACKED FORMAT>
+INLINE color_t color_unpack(const uint16_t value) {
+	if (FORMAT == COLOR_PACKED_565) {
+		const uint8_t r = (value >> 8) & 0xf8;
+		const uint8_t g = (value >> 3) & 0xfc;
+		const uint8_t b = (value << 3) & 0xf8;
+		return color_t(r | (r >> 5), g | (g >> 6), b | (b >> 5));
+	}
+	return color_t(value);
+}
+
+
+
+
+#if defined(__SSSE3__)
+////////////////////////////////////////////////////////////////////////////////
+// PSHUFB MASKS FOR THE SSSE3 EXPANSION. OUTPUT BYTES 0-15 COME FROM THE LOW
+// G-R PAIRS AND B, 16-31 FROM ALL THREE, AND 32-47 FROM THE HIGH PAIRS AND B
+////////////////////////////////////////////////////////////////////////////////
+static const uint8_t color_packed_shuffle[7][16] = {
+	{0, 1, 0x80, 2, 3, 0x80, 4, 5, 0x80, 6, 7, 0x80, 8, 9, 0x80, 10},
+	{0x80, 0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80},
+	{11, 0x80, 12, 13, 0x80, 14, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 1, 0x80, 2, 3, 0x80, 4, 5},
+	{0x80, 5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80},
+	{0x80, 6, 7, 0x80, 8, 9, 0x80, 10, 11, 0x80, 12, 13, 0x80, 14, 15, 0x80},
+	{10, 0x80, 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15},
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SSSE3 EXPANSION, 16 PIXELS (32 BYTES IN, 48 BYTES OUT) PER LOOP. EACH
+// CHANNEL IS WIDENED IN 16-BIT LANES, G AND R ARE PAIRED UP INTO ONE REGISTER
+// PER 8 PIXELS, B IS PACKED DOWN TO BYTES, AND PSHUFB INTERLEAVES THEM INTO
+// G-R-B ORDER. COUNT MUST BE A MULTIPLE OF 16
+////////////////////////////////////////////////////////////////////////////////
+template <COLOR_PACKED FORMAT>
+inline void color_expand_ssse3(const uint16_t *src, color_t *dst, size_t count) {
+	const __m128i *shuffle	= (const __m128i*)color_packed_shuffle;
+	const bool		wide	= FORMAT == COLOR_PACKED_565;
+	const __m128i	five	= _mm_set1_epi16(0x1f);
+	const __m128i	mid		= _mm_set1_epi16(wide ? 0x3f : 0x1f);
+
+	for (size_t i=0; i<count; i+=16) {
+		__m128i pairs[2], blues[2];
+
+		for (uint8_t h=0; h<2; h++) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)(src + i + h * 8));
+
+			const __m128i r = _mm_and_si128(_mm_srli_epi16(v, wide ? 11 : 10), five);
+			const __m128i g = _mm_and_si128(_mm_srli_epi16(v, 5), mid);
+			const __m128i b = _mm_and_si128(v, five);
+
+			const __m128i r8 = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+			const __m128i g8 = wide
+				? _mm_or_si128(_mm_slli_epi16(g, 2), _mm_srli_epi16(g, 4))
+				: _mm_or_si128(_mm_slli_epi16(g, 3), _mm_srli_epi16(g, 2));
+
+			pairs[h] = _mm_or_si128(g8, _mm_slli_epi16(r8, 8));
+			blues[h] = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+		}
+
+		const __m128i	blue	= _mm_packus_epi16(blues[0], blues[1]);
+		__m128i			*out	= (__m128i*)(dst + i);
+
+		_mm_storeu_si128(out + 0, _mm_or_si128(
+			_mm_shuffle_epi8(pairs[0], _mm_loadu_si128(shuffle + 0)),
+			_mm_shuffle_epi8(blue, _mm_loadu_si128(shuffle + 1))
+		));
+
+		_mm_storeu_si128(out + 1, _mm_or_si128(_mm_or_si128(
+			_mm_shuffle_epi8(pairs[0], _mm_loadu_si128(shuffle + 2)),
+			_mm_shuffle_epi8(pairs[1], _mm_loadu_si128(shuffle + 3))),
+			_mm_shuffle_epi8(blue, _mm_loadu_si128(shuffle + 4))
+		));
+
+		_mm_storeu_si128(out + 2, _mm_or_si128(
+			_mm_shuffle_epi8(pairs[1], _mm_loadu_si128(shuffle + 5)),
+			_mm_shuffle_epi8(blue, _mm_loadu_si128(shuffle + 6))
+		));
+	}
+}
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BULK CONVERSION BETWEEN PACKED PIXELS AND COLOR_T
+////////////////////////////////////////////////////////////////////////////////
+template <COLOR_PACKED FORMAT>
+inline void color_expand(const uint16_t *src, color_t *dst, size_t count) {
+	size_t i = 0;
+
+	#if defined(__SSSE3__)
+	i = count - count % 16;
+	color_expand_ssse3<FORMAT>(src, dst, i);
+	#endif
+
+	for (; i<count; i++) {
+		dst[i] = color_unpack<FORMAT>(src[i]);
+	}
+}
+
+
+
+template <COLOR_PACKED FORMAT>
+inline void color_pack(const color_t *src, uint16_t *dst, size_t count) {
+	for (size_t i=0; i<count; i++) {
+		dst[i] = color_pack<FORMAT>(src[i]);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// STRIP OF PACKED PIXELS. THE SAME SET/GET/FILL INTERFACE AS COLOR_STRIP_T,
+// BUT WITHOUT DIRTY TRACKING, AND EXPAND() TO GET COLOR_T FOR THE OUTPUT. A
+// SMALL COLOR_T BUFFER REUSED FOR EACH CHUNK KEEPS THE WHOLE FRAME PACKED
+////////////////////////////////////////////////////////////////////////////////
+template <COLOR_PACKED FORMAT=COLOR_PACKED_565>
+class color_packed_strip_t {
+	public:
+		color_packed_strip_t(uint16_t *pixels, size_t count) {
+			this->pixels	= pixels;
+			this->count		= count;
+		}
+
+
+
+
+		INLINE size_t size() const {
+			return this->count;
+		}
+
+		INLINE uint16_t *data() {
+			return this->pixels;
+		}
+
+		INLINE const uint16_t *data() const {
+			return this->pixels;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PIXEL ACCESS. OUT OF RANGE WRITES ARE IGNORED, READS GIVE BLACK
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_t get(size_t index) const {
+			return index < this->count ? color_unpack<FORMAT>(this->pixels[index]) : color_t();
+		}
+
+		INLINE void set(size_t index, const color_t color) {
+			if (index < this->count) this->pixels[index] = color_pack<FORMAT>(color);
+		}
+
+		INLINE void fill(const color_t color) {
+			this->fill(0, this->count, color);
+		}
+
+		void fill(size_t first, size_t length, const color_t color) {
+			if (first >= this->count) return;
+			length = _min(length, this->count - first);
+
+			const uint16_t value = color_pack<FORMAT>(color);
+			for (size_t i=first; i<first+length; i++) {
+				this->pixels[i] = value;
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERT BETWEEN A SPAN OF THE STRIP AND COLOR_T. RETURNS HOW MANY
+		// PIXELS WERE CONVERTED, WHICH IS LESS THAN LENGTH AT THE END
+		////////////////////////////////////////////////////////////////////////
+		size_t expand(color_t *dst, size_t first, size_t length) const {
+			if (first >= this->count) return 0;
+			length = _min(length, this->count - first);
+			color_expand<FORMAT>(this->pixels + first, dst, length);
+			return length;
+		}
+
+		size_t write(const color_t *src, size_t first, size_t length) {
+			if (first >= this->count) return 0;
+			length = _min(length, this->count - first);
+			color_pack<FORMAT>(src, this->pixels + first, length);
+			return length;
+		}
+
+
+
+
+	private:
+		uint16_t	*pixels;
+		size_t		count;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PACKED STRIP THAT OWNS ITS OWN PIXEL STORAGE
+////////////////////////////////////////////////////////////////////////////////
+template <size_t COUNT, COLOR_PACKED FORMAT=COLOR_PACKED_565>
+class color_packed_framebuffer_t : public color_packed_strip_t<FORMAT> {
+	public:
+		color_packed_framebuffer_t() : color_packed_strip_t<FORMAT>(storage, COUNT) {}
+
+		// THE BASE CLASS POINTS INTO THIS OBJECT, SO IT CANNOT BE COPIED
+		color_packed_framebuffer_t(const color_packed_framebuffer_t &) = delete;
+		color_packed_framebuffer_t &operator =(const color_packed_framebuffer_t &) = delete;
+
+	private:
+		uint16_t storage[COUNT];
+};
+
+
+
+
+#endif //__color_packed_h__
@@ -0,0 +1,279 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| TABLE-DRIVEN COLOR PALETTES WITH 16 OR 256 ENTRIES. A PALETTE CAN LIVE IN    |
+| PROGMEM (AS G-R-B BYTE TRIPLETS) OR IN RAM (AS COLOR_T). LOOKUPS ARE A       |
+| SINGLE TABLE READ, AND A BLENDED LOOKUP INTERPOLATES BETWEEN NEIGHBORING     |
+| ENTRIES SO A 16 ENTRY PALETTE CAN BE USED AS A SMOOTH GRADIENT.              |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_palette_h__
+#define __color_palette_h__
+
+
+
+
+#include "color.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// THE 16 VGA COLORS RETURNED BY COLOR_T::PALETTE(), IN G-R-B ORDER
+////////////////////////////////////////////////////////////////////////////////
+static CONST uint8_t color_palette_vga[16][3] = {
+	{0xff, 0xff, 0xff},		// WHITE
+	{0x00, 0xff, 0x00},		// RED
+	{0xff, 0xff, 0x00},		// YELLOW
+	{0xff, 0x00, 0x00},		// LIME
+	{0xff, 0x00, 0xff},		// AQUA
+	{0x00, 0x00, 0xff},		// BLUE
+	{0x00, 0xff, 0xff},		// FUCHSIA
+	{0x80, 0xff, 0x00},		// ORANGE
+	{0x80, 0x80, 0x80},		// GRAY
+	{0xc0, 0xc0, 0xc0},		// SILVER
+	{0x00, 0x80, 0x00},		// MAROON
+	{0x80, 0x80, 0x00},		// OLIVE
+	{0x80, 0x00, 0x00},		// GREEN
+	{0x80, 0x00, 0x80},		// TEAL
+	{0x00, 0x00, 0x80},		// NAVY
+	{0x00, 0x80, 0x80},		// PURPLE
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// THE COLOR_T::HUE() WHEEL SAMPLED AT 16 EVEN STEPS, IN G-R-B ORDER
+////////////////////////////////////////////////////////////////////////////////
+static CONST uint8_t color_palette_rainbow[16][3] = {
+	{0x00, 0xff, 0x00},
+	{0x30, 0xcf, 0x00},
+	{0x60, 0x9f, 0x00},
+	{0x90, 0x6f, 0x00},
+	{0xc0, 0x3f, 0x00},
+	{0xf0, 0x0f, 0x00},
+	{0xdf, 0x00, 0x20},
+	{0xaf, 0x00, 0x50},
+	{0x7f, 0x00, 0x80},
+	{0x4f, 0x00, 0xb0},
+	{0x1f, 0x00, 0xe0},
+	{0x00, 0x10, 0xef},
+	{0x00, 0x40, 0xbf},
+	{0x00, 0x70, 0x8f},
+	{0x00, 0xa0, 0x5f},
+	{0x00, 0xd0, 0x2f},
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// GET A COLOR FROM A PALETTE INDEX. ANYTHING ABOVE 15 IS BLACK
+////////////////////////////////////////////////////////////////////////////////
+inline color_t color_t::palette(uint8_t index) {
+	return (index < 16)
+		? color_t::progmem(color_palette_vga[index])
+		: color_t();
+}
+
+
+
+
+class color_palette_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// PALETTE IN PROGMEM, SUCH AS COLOR_PALETTE_VGA. SIZE IS 16 OR 256
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_palette_t(const uint8_t (*entries)[3], uint16_t size=16) {
+			this->init(entries[0], size, true);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PALETTE IN RAM. SIZE IS 16 OR 256
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_palette_t(const color_t *entries, uint16_t size=16) {
+			this->init(&entries->g, size, false);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// NUMBER OF ENTRIES, EITHER 16 OR 256
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint16_t size() const {
+			return (uint16_t)this->mask + 1;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// GET A SINGLE ENTRY. INDEXES WRAP AROUND THE END OF THE PALETTE
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_t get(uint8_t index) const {
+			index &= this->mask;
+
+			if (this->flash) {
+				return color_t::progmem(this->entries + index * sizeof(color_t));
+			}
+
+			return ((const color_t*)this->entries)[index];
+		}
+
+		INLINE color_t operator[](uint8_t index) const {
+			return this->get(index);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BLENDED LOOKUP. POSITION 0 TO 65535 COVERS THE WHOLE PALETTE, AND
+		// THE LAST ENTRY BLENDS BACK INTO THE FIRST. THE HIGH BITS PICK THE
+		// ENTRY, THE NEXT 8 BITS ARE HOW FAR TOWARDS THE FOLLOWING ENTRY
+		////////////////////////////////////////////////////////////////////////
+		color_t blend(uint16_t position) const {
+			const uint8_t	index	= position >> (16 - this->bits);
+			const uint8_t	amount	= position >> (8 - this->bits);
+			const color_t	from	= this->get(index);
+
+			if (!amount) return from;
+
+			const color_t	to		= this->get(index + 1);
+			const uint16_t	keep	= 256 - amount;
+
+			return color_t(
+				(from.r * keep + to.r * amount) >> 8,
+				(from.g * keep + to.g * amount) >> 8,
+				(from.b * keep + to.b * amount) >> 8
+			);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERT A WHOLE BUFFER OF PALETTE INDEXES INTO COLORS
+		////////////////////////////////////////////////////////////////////////
+		void map_palette(const uint8_t *indices, color_t *out, size_t count) const {
+			const uint8_t mask = this->mask;
+
+			if (this->flash) {
+				for (size_t i=0; i<count; i++) {
+					out[i] = color_t::progmem(this->entries + (indices[i] & mask) * sizeof(color_t));
+				}
+				return;
+			}
+
+			const color_t *table = (const color_t*)this->entries;
+			for (size_t i=0; i<count; i++) {
+				out[i] = table[indices[i] & mask];
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERT A WHOLE BUFFER OF BLEND POSITIONS INTO COLORS
+		////////////////////////////////////////////////////////////////////////
+		void blend_palette(const uint16_t *positions, color_t *out, size_t count) const {
+			for (size_t i=0; i<count; i++) {
+				out[i] = this->blend(positions[i]);
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FILL A BUFFER WITH A GRADIENT ACROSS THE PALETTE, STARTING AT ONE
+		// BLEND POSITION AND MOVING A FIXED STEP PER PIXEL (WRAPPING AROUND)
+		////////////////////////////////////////////////////////////////////////
+		void fill(color_t *out, size_t count, uint16_t start, uint16_t step) const {
+			for (size_t i=0; i<count; i++, start+=step) {
+				out[i] = this->blend(start);
+			}
+		}
+
+
+
+
+	protected:
+		INLINE void init(const uint8_t *entries, uint16_t size, bool flash) {
+			this->entries	= entries;
+			this->mask		= (size > 16) ? 0xff : 0x0f;
+			this->bits		= (size > 16) ? 8 : 4;
+			this->flash		= flash;
+		}
+
+
+
+
+	private:
+		const uint8_t	*entries;
+		uint8_t			mask;
+		uint8_t			bits;
+		bool			flash;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PALETTE THAT OWNS ITS ENTRIES IN RAM. BUILDING ONE FROM A 16 ENTRY PROGMEM
+// PALETTE PRE-BLENDS A 256 ENTRY GRADIENT, SO MAPPING IS THEN A PLAIN LOOKUP
+////////////////////////////////////////////////////////////////////////////////
+template <uint16_t SIZE>
+class color_palette_buffer_t : public color_palette_t {
+	static_assert(SIZE == 16  ||  SIZE == 256, "palettes have 16 or 256 entries");
+
+	public:
+		color_palette_buffer_t() : color_palette_t(storage, SIZE) {
+			memset(this->storage, 0, sizeof(this->storage));
+		}
+
+		color_palette_buffer_t(const color_palette_t &source) : color_palette_t(storage, SIZE) {
+			this->resample(source);
+		}
+
+		// THE BASE CLASS POINTS INTO THIS OBJECT, SO IT CANNOT BE COPIED
+		color_palette_buffer_t(const color_palette_buffer_t &) = delete;
+		color_palette_buffer_t &operator =(const color_palette_buffer_t &) = delete;
+
+		using color_palette_t::operator[];
+
+		INLINE color_t &operator[](uint8_t index) {
+			return this->storage[index & (SIZE - 1)];
+		}
+
+		INLINE color_t *data() {
+			return this->storage;
+		}
+
+		// REFILL EVERY ENTRY BY BLENDING ACROSS ANOTHER PALETTE
+		void resample(const color_palette_t &source) {
+			for (uint16_t i=0; i<SIZE; i++) {
+				this->storage[i] = source.blend(i * (65536ul / SIZE));
+			}
+		}
+
+	private:
+		color_t storage[SIZE];
+};
+
+
+
+
+#endif //__color_palette_h__
@@ -0,0 +1,424 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| POWER BUDGETING FOR LED STRIPS. A WS2812B DRAWS ROUGHLY A FIXED CURRENT PER  |
+| CHANNEL AT FULL INTENSITY, SCALED LINEARLY BY THE CHANNEL VALUE, PLUS A      |
+| SMALL IDLE CURRENT FOR ITS CONTROLLER. THE ESTIMATE FOR A FRAME ONLY NEEDS   |
+| THE SUM OF EACH CHANNEL ACROSS THE FRAME, WHICH IS ONE FAST PASS, AND A      |
+| FRAME OVER BUDGET IS DIMMED EVENLY IN ONE MORE PASS THAT ALSO RECOUNTS IT.   |
+|                                                                              |
+| COLOR_POWER_STRIP_T KEEPS THE CHANNEL SUMS UP TO DATE AS PIXELS ARE WRITTEN, |
+| SO A LARGE STRIP NEVER NEEDS TO BE RESCANNED JUST TO CHECK ITS BUDGET.       |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_power_h__
+#define __color_power_h__
+
+
+
+
+#include "color.h"
+#include "color_strip.h"
+
+
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define COLOR_POWER_SSE2	1
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFAULT WS2812B DRAW: 20MA PER CHANNEL AT FULL INTENSITY, 1MA IDLE
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_POWER_CHANNEL_MA
+#define COLOR_POWER_CHANNEL_MA		20
+#endif
+
+#ifndef COLOR_POWER_IDLE_UA
+#define COLOR_POWER_IDLE_UA			1000
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SUM OF EACH CHANNEL OVER A SPAN OF PIXELS
+////////////////////////////////////////////////////////////////////////////////
+struct color_power_sum_t {
+	uint32_t g;
+	uint32_t r;
+	uint32_t b;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ONE PASS OVER A SPAN THAT SUMS EACH CHANNEL. WITH SCALE, EVERY BYTE IS FIRST
+// MULTIPLIED BY SCALE / 256 AND WRITTEN BACK, AND THE NEW VALUES ARE SUMMED.
+// ON SSE2, 16 PIXELS (48 BYTES) ARE ADDED UP AT A TIME IN 16 BIT LANES, AND
+// THE LANES ARE SORTED BACK INTO CHANNELS ONCE EVERY 256 BLOCKS
+////////////////////////////////////////////////////////////////////////////////
+template <bool SCALE>
+inline color_power_sum_t color_power_pass(uint8_t *data, size_t count, uint8_t scale) {
+	const size_t		bytes	= count * sizeof(color_t);
+	color_power_sum_t	sum		= {0, 0, 0};
+	size_t				i		= 0;
+
+	#if defined(COLOR_POWER_SSE2)
+	const __m128i	zero	= _mm_setzero_si128();
+	const __m128i	factor	= _mm_set1_epi16(scale);
+	const size_t	whole	= bytes - bytes % 48;
+	uint32_t		total[3]= {0, 0, 0};
+
+	while (i < whole) {
+		// 16 BIT LANES CAN HOLD 256 BYTES OF 255 BEFORE THEY OVERFLOW
+		const size_t	end		= _min(whole, i + 48 * 256);
+		__m128i			acc[6]	= {zero, zero, zero, zero, zero, zero};
+
+		for (; i < end; i += 48) {
+			for (uint8_t v=0; v<3; v++) {
+				const __m128i value = _mm_loadu_si128((const __m128i*)(data + i + v * 16));
+				__m128i lo = _mm_unpacklo_epi8(value, zero);
+				__m128i hi = _mm_unpackhi_epi8(value, zero);
+
+				if (SCALE) {
+					lo = _mm_srli_epi16(_mm_mullo_epi16(lo, factor), 8);
+					hi = _mm_srli_epi16(_mm_mullo_epi16(hi, factor), 8);
+					_mm_storeu_si128((__m128i*)(data + i + v * 16), _mm_packus_epi16(lo, hi));
+				}
+
+				acc[v * 2 + 0] = _mm_add_epi16(acc[v * 2 + 0], lo);
+				acc[v * 2 + 1] = _mm_add_epi16(acc[v * 2 + 1], hi);
+			}
+		}
+
+		// LANE J OF THE 48 HOLDS BYTE J OF EVERY BLOCK, WHICH IS CHANNEL J % 3
+		uint16_t lanes[48];
+		for (uint8_t v=0; v<6; v++) {
+			_mm_storeu_si128((__m128i*)(lanes + v * 8), acc[v]);
+		}
+		for (uint8_t j=0; j<48; j++) {
+			total[j % 3] += lanes[j];
+		}
+	}
+
+	sum.g = total[0];
+	sum.r = total[1];
+	sum.b = total[2];
+	#endif
+
+	// EVERY FULL VECTOR BLOCK IS 48 BYTES, SO I IS STILL ON A GREEN CHANNEL
+	for (; i < bytes; i += sizeof(color_t)) {
+		if (SCALE) {
+			data[i + 0] = ((uint16_t)data[i + 0] * scale) >> 8;
+			data[i + 1] = ((uint16_t)data[i + 1] * scale) >> 8;
+			data[i + 2] = ((uint16_t)data[i + 2] * scale) >> 8;
+		}
+		sum.g += data[i + 0];
+		sum.r += data[i + 1];
+		sum.b += data[i + 2];
+	}
+
+	return sum;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SUM EACH CHANNEL OVER A SPAN OF PIXELS
+////////////////////////////////////////////////////////////////////////////////
+INLINE color_power_sum_t color_power_sum(const color_t *pixels, size_t count) {
+	return color_power_pass<false>((uint8_t*)pixels, count, 0);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DIM A SPAN OF PIXELS BY SCALE / 256, RETURNING THE NEW CHANNEL SUMS
+////////////////////////////////////////////////////////////////////////////////
+INLINE color_power_sum_t color_power_scale(color_t *pixels, size_t count, uint8_t scale) {
+	return color_power_pass<true>((uint8_t*)pixels, count, scale);
+}
+
+
+
+
+class color_power_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// CURRENT PER CHANNEL AT FULL INTENSITY IN MILLIAMPS, AND THE IDLE
+		// CURRENT PER PIXEL IN MICROAMPS
+		////////////////////////////////////////////////////////////////////////
+		color_power_t(
+			uint16_t red_ma		= COLOR_POWER_CHANNEL_MA,
+			uint16_t green_ma	= COLOR_POWER_CHANNEL_MA,
+			uint16_t blue_ma	= COLOR_POWER_CHANNEL_MA,
+			uint16_t idle_ua	= COLOR_POWER_IDLE_UA
+		) {
+			this->red_ma	= red_ma;
+			this->green_ma	= green_ma;
+			this->blue_ma	= blue_ma;
+			this->idle_ua	= idle_ua;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ESTIMATED CURRENT IN MILLIAMPS, ROUNDED UP
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint32_t milliamps(const color_power_sum_t &sum, size_t count) const {
+			return (uint32_t)((this->dynamic(sum) + 254) / 255) + this->idle(count);
+		}
+
+		INLINE uint32_t milliamps(const color_t *pixels, size_t count) const {
+			return this->milliamps(color_power_sum(pixels, count), count);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SCALE (OUT OF 256) THAT BRINGS A FRAME WITHIN LIMIT_MA. 256 MEANS THE
+		// FRAME IS ALREADY WITHIN BUDGET, 0 MEANS EVEN THE IDLE DRAW IS OVER
+		////////////////////////////////////////////////////////////////////////
+		uint16_t scale(const color_power_sum_t &sum, size_t count, uint32_t limit_ma) const {
+			const uint32_t idle = this->idle(count);
+			if (limit_ma <= idle) return 0;
+
+			const uint64_t budget	= (uint64_t)(limit_ma - idle) * 255;
+			const uint64_t dynamic	= this->dynamic(sum);
+			if (dynamic <= budget) return 256;
+
+			return (uint16_t)((budget * 256) / dynamic);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DIM A FRAME EVENLY SO IT FITS WITHIN LIMIT_MA. ONE PASS TO MEASURE IT,
+		// AND ONLY IF IT IS OVER BUDGET, ONE MORE TO SCALE IT. RETURNS THE NEW
+		// ESTIMATED CURRENT IN MILLIAMPS
+		////////////////////////////////////////////////////////////////////////
+		uint32_t limit(color_t *pixels, size_t count, uint32_t limit_ma) const {
+			color_power_sum_t sum = color_power_sum(pixels, count);
+
+			const uint16_t factor = this->scale(sum, count, limit_ma);
+			if (factor < 256) sum = color_power_scale(pixels, count, factor);
+
+			return this->milliamps(sum, count);
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// CHANNEL CURRENT TIMES 255, SO IT STAYS EXACT UNTIL THE END
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint64_t dynamic(const color_power_sum_t &sum) const {
+			return	(uint64_t)sum.r * this->red_ma
+				+	(uint64_t)sum.g * this->green_ma
+				+	(uint64_t)sum.b * this->blue_ma;
+		}
+
+		INLINE uint32_t idle(size_t count) const {
+			return ((uint64_t)count * this->idle_ua + 999) / 1000;
+		}
+
+
+
+
+		uint16_t	red_ma;
+		uint16_t	green_ma;
+		uint16_t	blue_ma;
+		uint16_t	idle_ua;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// STRIP THAT TRACKS ITS OWN POWER DRAW. EVERY WRITE THROUGH THIS CLASS
+// ADJUSTS THE RUNNING CHANNEL SUMS BY THE DIFFERENCE BETWEEN THE OLD AND NEW
+// PIXELS. SPANS HANDED OUT BY MODIFY() ARE RECOUNTED ON THE NEXT CALL, SINCE
+// THEIR NEW VALUES AREN'T KNOWN UNTIL THEN.
+// NOTE:	WRITES MADE THROUGH A COLOR_STRIP_T POINTER OR REFERENCE BYPASS THE
+//			TRACKING, SO CALL RECOUNT() AFTER THOSE
+////////////////////////////////////////////////////////////////////////////////
+class color_power_strip_t : public color_strip_t {
+	public:
+		color_power_strip_t(color_t *pixels, size_t count, const color_power_t &model=color_power_t())
+			: color_strip_t(pixels, count), model(model) {
+			this->recount();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// TRACKED VERSIONS OF THE COLOR_STRIP_T WRITE FUNCTIONS
+		////////////////////////////////////////////////////////////////////////
+		INLINE void set(size_t index, const color_t color) {
+			if (index >= this->size()) return;
+
+			this->settle();
+			this->remove(this->get(index));
+			this->add(color);
+			color_strip_t::set(index, color);
+		}
+
+		void write(size_t first, const color_t *source, size_t length) {
+			if (!this->clip(first, length)) return;
+
+			this->settle();
+			this->remove(color_power_sum(this->data() + first, length));
+			this->add(color_power_sum(source, length));
+			color_strip_t::write(first, source, length);
+		}
+
+		INLINE void fill(const color_t color) {
+			this->fill(0, this->size(), color);
+		}
+
+		void fill(size_t first, size_t length, const color_t color) {
+			if (!this->clip(first, length)) return;
+
+			this->settle();
+			this->remove(color_power_sum(this->data() + first, length));
+			this->sums.g += (uint32_t)color.g * length;
+			this->sums.r += (uint32_t)color.r * length;
+			this->sums.b += (uint32_t)color.b * length;
+			color_strip_t::fill(first, length, color);
+		}
+
+		INLINE color_t *modify(size_t first, size_t length) {
+			if (!this->clip(first, length)) return nullptr;
+
+			this->settle();
+			this->remove(color_power_sum(this->data() + first, length));
+			this->pending.first	= first;
+			this->pending.last	= first + length;
+			return color_strip_t::modify(first, length);
+		}
+
+		INLINE color_t *modify() {
+			return this->modify(0, this->size());
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CURRENT CHANNEL SUMS AND ESTIMATED DRAW IN MILLIAMPS
+		////////////////////////////////////////////////////////////////////////
+		INLINE const color_power_sum_t &sum() {
+			this->settle();
+			return this->sums;
+		}
+
+		INLINE uint32_t milliamps() {
+			return this->model.milliamps(this->sum(), this->size());
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DIM THE WHOLE STRIP IF IT IS OVER LIMIT_MA. THE RUNNING SUMS MEAN
+		// THIS IS FREE WHEN THE STRIP IS WITHIN BUDGET. RETURNS THE NEW
+		// ESTIMATED CURRENT IN MILLIAMPS
+		////////////////////////////////////////////////////////////////////////
+		uint32_t limit(uint32_t limit_ma) {
+			const uint16_t factor = this->model.scale(this->sum(), this->size(), limit_ma);
+
+			if (factor < 256) {
+				this->sums = color_power_scale(color_strip_t::modify(), this->size(), factor);
+			}
+
+			return this->model.milliamps(this->sums, this->size());
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// REBUILD THE RUNNING SUMS FROM SCRATCH
+		////////////////////////////////////////////////////////////////////////
+		INLINE void recount() {
+			this->sums				= color_power_sum(this->data(), this->size());
+			this->pending.first		= 0;
+			this->pending.last		= 0;
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// COUNT THE SPAN LAST HANDED OUT BY MODIFY() BACK INTO THE SUMS
+		////////////////////////////////////////////////////////////////////////
+		INLINE void settle() {
+			if (!this->pending.size()) return;
+			this->add(color_power_sum(this->data() + this->pending.first, this->pending.size()));
+			this->pending.first	= 0;
+			this->pending.last	= 0;
+		}
+
+		INLINE bool clip(size_t first, size_t &length) const {
+			if (first >= this->size()) return false;
+			if (length > this->size() - first) length = this->size() - first;
+			return length > 0;
+		}
+
+		INLINE void add(const color_power_sum_t &sum) {
+			this->sums.g += sum.g;
+			this->sums.r += sum.r;
+			this->sums.b += sum.b;
+		}
+
+		INLINE void remove(const color_power_sum_t &sum) {
+			this->sums.g -= sum.g;
+			this->sums.r -= sum.r;
+			this->sums.b -= sum.b;
+		}
+
+		INLINE void add(const color_t color) {
+			this->sums.g += color.g;
+			this->sums.r += color.r;
+			this->sums.b += color.b;
+		}
+
+		INLINE void remove(const color_t color) {
+			this->sums.g -= color.g;
+			this->sums.r -= color.r;
+			this->sums.b -= color.b;
+		}
+
+
+
+
+		color_power_t		model;
+		color_power_sum_t	sums;
+		color_range_t		pending;
+};
+
+
+
+
+#endif //__color_power_h__
@@ -0,0 +1,430 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| BUILDS AN N-COLOR PALETTE FOR AN IMAGE, AND MAPS THE IMAGE ONTO IT. PIXELS   |
+| ARE FIRST COUNTED INTO A HISTOGRAM OF 5 BITS PER CHANNEL, SO THE PALETTE IS  |
+| BUILT FROM AT MOST 32768 OCCUPIED BINS NO MATTER HOW LARGE THE IMAGE IS.     |
+| MEDIAN CUT SPLITS THE BINS INTO BOXES, AND A FEW K-MEANS PASSES OVER THE     |
+| BINS REFINE THE BOX AVERAGES. REMAPPING IS A SINGLE TABLE READ PER PIXEL.    |
+| THE TABLES TAKE ABOUT 700KB, SO THIS IS FOR HOSTS AND LARGER MCUS ONLY.      |
+| THE RESULT FITS COLOR_INDEXED_STRIP_T<8> DIRECTLY:                           |
+|   quantize.add(image, count);                                                |
+|   strip.load(quantize.palette(), quantize.build(256));                       |
+|   quantize.remap(image, count, strip.data());                                |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_quantize_h__
+#define __color_quantize_h__
+
+
+
+
+#include <stddef.h>
+#include <string.h>
+#include "color.h"
+#include "color_nearest.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HISTOGRAM BITS PER CHANNEL. EACH BIT LESS DIVIDES THE TABLE SIZE BY EIGHT,
+// AT THE COST OF COARSER SPLITS AND REMAPPING
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_QUANTIZE_BITS
+#define COLOR_QUANTIZE_BITS		5
+#endif
+
+
+
+
+template <uint8_t BITS=COLOR_QUANTIZE_BITS>
+class color_quantize_t {
+	static_assert(BITS >= 1  &&  BITS <= 5, "BIN INDEXES MUST FIT IN 16 BITS");
+
+	public:
+		enum : uint32_t {
+			BINS	= 1ul << (BITS * 3),
+			COLORS	= 256,
+		};
+
+
+
+
+		color_quantize_t(const COLOR_METRIC metric=COLOR_METRIC_REDMEAN) {
+			this->metric = metric;
+			this->reset();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FORGET EVERY PIXEL ADDED SO FAR AND THE PALETTE BUILT FROM THEM
+		////////////////////////////////////////////////////////////////////////
+		void reset() {
+			memset(this->bins, 0, sizeof(this->bins));
+			memset(this->map, 0xff, sizeof(this->map));
+			this->count = 0;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COUNT PIXELS INTO THE HISTOGRAM. A STEP ABOVE 1 ONLY SAMPLES EVERY
+		// STEP'TH PIXEL, WHICH IS USUALLY PLENTY FOR A LARGE IMAGE. EACH BIN
+		// ALSO SUMS THE CHANNEL BITS BELOW ITS OWN, SO THE PALETTE IS BUILT
+		// FROM TRUE AVERAGES RATHER THAN BIN CENTERS
+		////////////////////////////////////////////////////////////////////////
+		void add(const color_t *pixels, size_t count, size_t step=1) {
+			if (!step) step = 1;
+
+			for (size_t i=0; i<count; i+=step) {
+				const color_t	color	= pixels[i];
+				bin_t			&bin	= this->bins[this->bin(color)];
+
+				bin.count++;
+				bin.r += color.r & LOW;
+				bin.g += color.g & LOW;
+				bin.b += color.b & LOW;
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BUILD A PALETTE OF UP TO SIZE COLORS FROM THE HISTOGRAM. RETURNS HOW
+		// MANY WERE MADE, WHICH IS FEWER WHEN THE IMAGE HAS FEWER DISTINCT
+		// BINS. REFINE IS THE NUMBER OF K-MEANS PASSES AFTER THE MEDIAN CUT
+		////////////////////////////////////////////////////////////////////////
+		uint16_t build(uint16_t size, uint8_t refine=2) {
+			uint32_t used = 0;
+			for (uint32_t i=0; i<BINS; i++) {
+				if (this->bins[i].count) this->order[used++] = i;
+			}
+
+			this->count = 0;
+			memset(this->map, 0xff, sizeof(this->map));
+
+			size = _min(size, (uint16_t)COLORS);
+			if (!used  ||  !size) return 0;
+
+			uint16_t made = 1;
+			this->measure(this->boxes[0], 0, used);
+
+			while (made < size) {
+				uint16_t best = made;
+				uint8_t	 axis = 0;
+				uint64_t most = 0;
+
+				for (uint16_t i=0; i<made; i++) {
+					const box_t &box = this->boxes[i];
+					if (box.last - box.first < 2) continue;
+
+					for (uint8_t a=0; a<3; a++) {
+						const uint32_t side		= box.hi[a] - box.lo[a];
+						const uint64_t weight	= (uint64_t)box.count * color_metric_weight(this->metric, a) * side * side;
+						if (weight > most) {
+							most	= weight;
+							best	= i;
+							axis	= a;
+						}
+					}
+				}
+
+				if (best == made) break;
+				this->split(this->boxes[best], this->boxes[made++], axis);
+			}
+
+			for (uint16_t i=0; i<made; i++) {
+				const box_t &box	= this->boxes[i];
+				uint64_t	sum[3]	= {0, 0, 0};
+
+				for (uint32_t j=box.first; j<box.last; j++) {
+					this->accumulate(sum, this->order[j]);
+				}
+
+				this->colors[i] = this->average(sum, box.count);
+			}
+
+			this->count = made;
+
+			for (uint8_t pass=0; pass<refine; pass++) {
+				this->relocate(used);
+			}
+
+			return this->count;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// THE PALETTE MADE BY THE LAST BUILD()
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint16_t size() const {
+			return this->count;
+		}
+
+		INLINE const color_t *palette() const {
+			return this->colors;
+		}
+
+		INLINE color_t palette(uint8_t slot) const {
+			return slot < this->count ? this->colors[slot] : color_t();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PALETTE INDEX FOR ANY COLOR. EACH BIN IS MATCHED TO THE PALETTE THE
+		// FIRST TIME IT IS SEEN, BY THE AVERAGE OF ITS PIXELS, OR ITS CENTER IF
+		// THE IMAGE HAD NONE. COLORS THAT WERE NEVER ADDED, SUCH AS THE NEXT
+		// FRAME OF A VIDEO, CAN BE REMAPPED TOO
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint8_t index(const color_t color) {
+			const uint16_t slot = this->bin(color);
+			if (this->map[slot] == 0xffff) this->map[slot] = this->nearest(slot);
+			return (uint8_t)this->map[slot];
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// REMAP A BUFFER ONTO THE PALETTE, AS INDEXES OR IN PLACE
+		////////////////////////////////////////////////////////////////////////
+		void remap(const color_t *pixels, size_t count, uint8_t *indexes) {
+			if (!this->count) return;
+			for (size_t i=0; i<count; i++) {
+				indexes[i] = this->index(pixels[i]);
+			}
+		}
+
+		void remap(color_t *pixels, size_t count) {
+			if (!this->count) return;
+			for (size_t i=0; i<count; i++) {
+				pixels[i] = this->colors[this->index(pixels[i])];
+			}
+		}
+
+
+
+
+	private:
+		enum : uint8_t {
+			SHIFT	= 8 - BITS,
+			MASK	= (1 << BITS) - 1,
+			LOW		= (1 << SHIFT) - 1,
+		};
+
+
+
+		struct bin_t {
+			uint32_t	count;
+			uint32_t	r, g, b;	// SUMS OF THE BITS BELOW THE BIN
+		};
+
+
+
+		struct box_t {
+			uint32_t	first;
+			uint32_t	last;
+			uint32_t	count;
+			uint8_t		lo[3];
+			uint8_t		hi[3];
+		};
+
+
+
+
+		INLINE static uint16_t bin(const color_t color) {
+			return	((color.r >> SHIFT) << (BITS * 2))
+				|	((color.g >> SHIFT) << BITS)
+				|	(color.b >> SHIFT);
+		}
+
+		INLINE static uint8_t channel(const uint16_t slot, const uint8_t axis) {
+			// AXIS 0 = RED, 1 = GREEN, 2 = BLUE
+			return (slot >> (BITS * (2 - axis))) & MASK;
+		}
+
+		INLINE static uint8_t center(const uint16_t slot, const uint8_t axis) {
+			return (channel(slot, axis) << SHIFT) | (LOW >> 1);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ADD A BIN'S PIXELS TO RUNNING R/G/B SUMS, AND TURN SUMS INTO A COLOR
+		////////////////////////////////////////////////////////////////////////
+		INLINE void accumulate(uint64_t *sum, const uint16_t slot) const {
+			const bin_t &bin = this->bins[slot];
+			sum[0] += (uint64_t)(channel(slot, 0) << SHIFT) * bin.count + bin.r;
+			sum[1] += (uint64_t)(channel(slot, 1) << SHIFT) * bin.count + bin.g;
+			sum[2] += (uint64_t)(channel(slot, 2) << SHIFT) * bin.count + bin.b;
+		}
+
+		INLINE static color_t average(const uint64_t *sum, const uint64_t count) {
+			return color_t(
+				(uint8_t)((sum[0] + count / 2) / count),
+				(uint8_t)((sum[1] + count / 2) / count),
+				(uint8_t)((sum[2] + count / 2) / count)
+			);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// POPULATION AND BOUNDS OF A RANGE OF OCCUPIED BINS
+		////////////////////////////////////////////////////////////////////////
+		void measure(box_t &box, uint32_t first, uint32_t last) const {
+			box.first	= first;
+			box.last	= last;
+			box.count	= 0;
+
+			for (uint8_t a=0; a<3; a++) {
+				box.lo[a] = MASK;
+				box.hi[a] = 0;
+			}
+
+			for (uint32_t i=first; i<last; i++) {
+				const uint16_t slot = this->order[i];
+				box.count += this->bins[slot].count;
+
+				for (uint8_t a=0; a<3; a++) {
+					const uint8_t value = channel(slot, a);
+					if (value < box.lo[a]) box.lo[a] = value;
+					if (value > box.hi[a]) box.hi[a] = value;
+				}
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SPLIT A BOX ALONG AN AXIS AT ITS PIXEL MEDIAN. THE AXIS VALUES ARE
+		// ONLY BITS WIDE, SO THE MEDIAN COMES FROM A SMALL COUNTING HISTOGRAM
+		// INSTEAD OF A SORT, AND THE BINS ARE THEN PARTITIONED IN PLACE. THE
+		// CUT STAYS BELOW THE TOP VALUE, SO NEITHER HALF IS EVER EMPTY
+		////////////////////////////////////////////////////////////////////////
+		void split(box_t &box, box_t &other, const uint8_t axis) {
+			uint32_t population[1 << BITS];
+			memset(population, 0, sizeof(population));
+
+			for (uint32_t i=box.first; i<box.last; i++) {
+				const uint16_t slot = this->order[i];
+				population[channel(slot, axis)] += this->bins[slot].count;
+			}
+
+			uint8_t		cut	= box.lo[axis];
+			uint32_t	sum	= population[cut];
+
+			while (cut + 1 < box.hi[axis]  &&  (uint64_t)sum * 2 < box.count) {
+				sum += population[++cut];
+			}
+
+			uint32_t lo = box.first;
+			uint32_t hi = box.last;
+
+			while (lo < hi) {
+				if (channel(this->order[lo], axis) <= cut) {
+					lo++;
+				} else {
+					const uint16_t swap	= this->order[lo];
+					this->order[lo]		= this->order[--hi];
+					this->order[hi]		= swap;
+				}
+			}
+
+			const uint32_t last = box.last;
+			this->measure(other, lo, last);
+			this->measure(box, box.first, lo);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CLOSEST PALETTE ENTRY TO A BIN
+		////////////////////////////////////////////////////////////////////////
+		uint8_t nearest(const uint16_t slot) const {
+			const bin_t &bin = this->bins[slot];
+			color_t color(center(slot, 0), center(slot, 1), center(slot, 2));
+
+			if (bin.count) {
+				uint64_t sum[3] = {0, 0, 0};
+				this->accumulate(sum, slot);
+				color = this->average(sum, bin.count);
+			}
+
+			return (uint8_t)color_nearest(this->colors, this->count, color, this->metric);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ONE K-MEANS PASS: ASSIGN EVERY OCCUPIED BIN TO ITS CLOSEST PALETTE
+		// ENTRY, THEN MOVE EACH ENTRY TO THE AVERAGE OF THE PIXELS ASSIGNED TO
+		// IT. ENTRIES THAT LOSE ALL THEIR PIXELS KEEP THEIR OLD COLOR. THE
+		// ASSIGNMENTS ARE ALREADY IN THE REMAP TABLE, SO THE LAST PASS IS KEPT
+		// IF NO ENTRY MOVED
+		////////////////////////////////////////////////////////////////////////
+		void relocate(uint32_t used) {
+			uint64_t sum[COLORS][3];
+			uint64_t total[COLORS];
+			memset(sum, 0, sizeof(sum[0]) * this->count);
+			memset(total, 0, sizeof(total[0]) * this->count);
+
+			for (uint32_t i=0; i<used; i++) {
+				const uint16_t	slot	= this->order[i];
+				const uint8_t	entry	= this->nearest(slot);
+
+				this->map[slot] = entry;
+				this->accumulate(sum[entry], slot);
+				total[entry] += this->bins[slot].count;
+			}
+
+			bool moved = false;
+
+			for (uint16_t i=0; i<this->count; i++) {
+				if (!total[i]) continue;
+
+				const color_t color = this->average(sum[i], total[i]);
+				if (memcmp((const void*)&color, (const void*)&this->colors[i], sizeof(color_t))) {
+					this->colors[i]	= color;
+					moved			= true;
+				}
+			}
+
+			if (moved) memset(this->map, 0xff, sizeof(this->map));
+		}
+
+
+
+
+		bin_t			bins[BINS];
+		uint16_t		order[BINS];	// OCCUPIED BINS, GROUPED BY BOX
+		uint16_t		map[BINS];		// PALETTE INDEX, OR 0XFFFF IF NOT YET MATCHED
+		box_t			boxes[COLORS];
+		color_t			colors[COLORS];
+		uint16_t		count;
+		COLOR_METRIC	metric;
+};
+
+
+
+
+#endif //__color_quantize_h__
@@ -0,0 +1,375 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| MULTI-THREADED FRAME RENDERER FOR LARGE INSTALLATIONS DRIVEN FROM ONE HOST.  |
+| EVERY STRIP IS CUT INTO TILES, AND EACH TILE IS A TASK HANDED TO AN EFFECT   |
+| CALLBACK AS ONE CONTIGUOUS SPAN OF PIXELS. THE TASKS ARE SPREAD EVENLY OVER  |
+| A POOL OF THREADS, AND THREADS THAT RUN OUT OF WORK STEAL HALF OF WHAT IS    |
+| LEFT FROM ANOTHER THREAD. RENDER() RETURNS ONCE EVERY TILE IS DONE, SO THE   |
+| FRAME CAN BE SENT STRAIGHT AFTER IT.                                         |
+|                                                                              |
+| HOST ONLY, SINCE IT NEEDS STD::THREAD.                                       |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_render_h__
+#define __color_render_h__
+
+
+
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "color.h"
+#include "color_strip.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MAXIMUM THREADS IN THE POOL, AND DEFAULT PIXELS PER TASK. A TILE IS SMALL
+// ENOUGH TO LEAVE PLENTY OF TASKS TO STEAL, BUT LARGE ENOUGH THAT TAKING ONE
+// OFF A QUEUE COSTS NOTHING NEXT TO RENDERING IT
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_RENDER_THREADS
+#define COLOR_RENDER_THREADS	64
+#endif
+
+#ifndef COLOR_RENDER_TILE
+#define COLOR_RENDER_TILE		2048
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ONE TILE OF A STRIP, AS HANDED TO AN EFFECT
+////////////////////////////////////////////////////////////////////////////////
+struct color_render_span_t {
+	color_t		*pixels;	// FIRST PIXEL OF THE TILE
+	size_t		count;		// PIXELS IN THE TILE
+	size_t		offset;		// INDEX OF THE FIRST PIXEL WITHIN ITS STRIP
+	size_t		strip;		// WHICH STRIP, IN THE ORDER THEY WERE ADDED
+	uint32_t	frame;		// FRAME NUMBER PASSED TO RENDER()
+	uint8_t		thread;		// WHICH THREAD IS RUNNING IT, 0 IS THE CALLER
+};
+
+
+
+typedef std::function<void(const color_render_span_t &span)> color_render_effect_t;
+
+
+
+
+class color_render_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// START THE POOL. ZERO THREADS USES EVERY CORE. THE THREAD CALLING
+		// RENDER() IS ONE OF THEM, SO ONE THREAD MEANS NO POOL AT ALL
+		////////////////////////////////////////////////////////////////////////
+		color_render_t(unsigned threads=0, size_t tile=COLOR_RENDER_TILE) {
+			if (!threads) threads = std::thread::hardware_concurrency();
+
+			this->count		= (uint8_t) _max(1u, _min(threads, (unsigned)COLOR_RENDER_THREADS));
+			this->tile		= _max((size_t)1, tile);
+			this->frame		= 0;
+			this->running	= 0;
+			this->stopping	= false;
+			this->stolen	= 0;
+
+			for (uint8_t i=1; i<this->count; i++) {
+				this->pool.emplace_back(&color_render_t::worker, this, i);
+			}
+		}
+
+
+
+		~color_render_t() {
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->stopping = true;
+			}
+			this->wake.notify_all();
+
+			for (std::thread &thread : this->pool) thread.join();
+		}
+
+
+
+		color_render_t(const color_render_t&) = delete;
+		color_render_t &operator=(const color_render_t&) = delete;
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ADD A STRIP, AND THE EFFECT THAT RENDERS IT. STRIPS ARE MARKED
+		// ENTIRELY DIRTY EACH FRAME BEFORE ANY THREADS TOUCH THEM
+		////////////////////////////////////////////////////////////////////////
+		INLINE void add(color_t *pixels, size_t count, color_render_effect_t effect) {
+			strip_t strip = {pixels, nullptr, count, effect};
+			this->strips.push_back(strip);
+		}
+
+		INLINE void add(color_strip_t &strip, color_render_effect_t effect) {
+			strip_t entry = {nullptr, &strip, strip.size(), effect};
+			this->strips.push_back(entry);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// POOL INFORMATION. STEALS COUNTS TASKS TAKEN FROM ANOTHER THREAD'S
+		// QUEUE OVER EVERY FRAME SO FAR
+		////////////////////////////////////////////////////////////////////////
+		INLINE uint8_t threads() const {
+			return this->count;
+		}
+
+		INLINE size_t tasks() const {
+			return this->work.size();
+		}
+
+		INLINE uint64_t steals() const {
+			return this->stolen.load(std::memory_order_relaxed);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RENDER ONE FRAME ACROSS THE POOL, AND WAIT FOR ALL OF IT TO FINISH
+		////////////////////////////////////////////////////////////////////////
+		void render(uint32_t frame) {
+			this->split(frame);
+
+			// DEAL THE TASKS OUT IN CONTIGUOUS RUNS, SO NEIGHBOURING TILES
+			// STAY ON ONE CORE UNTIL STEALING SAYS OTHERWISE
+			const size_t total = this->work.size();
+			for (uint8_t i=0; i<this->count; i++) {
+				this->queues[i].range.store(
+					pack(total * i / this->count, total * (i + 1) / this->count),
+					std::memory_order_relaxed
+				);
+			}
+
+			if (this->count > 1) {
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->frame++;
+					this->running = this->count - 1;
+				}
+				this->wake.notify_all();
+			}
+
+			this->drain(0);
+
+			// FRAME BARRIER: EVERY THREAD HAS LEFT ITS QUEUE
+			if (this->count > 1) {
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->done.wait(lock, [this]() { return this->running == 0; });
+			}
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// A STRIP, EITHER RAW STORAGE OR A COLOR_STRIP_T, AND ONE TILE OF IT
+		////////////////////////////////////////////////////////////////////////
+		struct strip_t {
+			color_t					*pixels;
+			color_strip_t			*strip;
+			size_t					count;
+			color_render_effect_t	effect;
+		};
+
+		struct task_t {
+			color_t		*pixels;
+			size_t		count;
+			size_t		offset;
+			size_t		strip;
+		};
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// EACH QUEUE IS A RANGE OF TASK INDEXES, HEAD IN THE LOW HALF AND TAIL
+		// IN THE HIGH HALF, SO BOTH ENDS CHANGE IN A SINGLE COMPARE AND SWAP.
+		// THE OWNER TAKES FROM THE HEAD, THIEVES TAKE FROM THE TAIL. A RANGE
+		// ONLY EVER SHRINKS OR IS SPLIT, SO A STALE VALUE CAN NEVER COME BACK
+		////////////////////////////////////////////////////////////////////////
+		struct alignas(64) queue_t {
+			std::atomic<uint64_t>	range;
+		};
+
+		static INLINE uint64_t pack(uint64_t head, uint64_t tail) {
+			return head | (tail << 32);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CUT EVERY STRIP INTO TILES FOR THIS FRAME
+		////////////////////////////////////////////////////////////////////////
+		void split(uint32_t frame) {
+			this->current = frame;
+			this->work.clear();
+
+			for (size_t i=0; i<this->strips.size(); i++) {
+				strip_t &strip = this->strips[i];
+				color_t *pixels = strip.strip ? strip.strip->modify() : strip.pixels;
+
+				for (size_t offset=0; offset<strip.count; offset+=this->tile) {
+					task_t task = {
+						pixels + offset,
+						_min(this->tile, strip.count - offset),
+						offset,
+						i,
+					};
+					this->work.push_back(task);
+				}
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// TAKE THE NEXT TASK FROM A THREAD'S OWN QUEUE
+		////////////////////////////////////////////////////////////////////////
+		bool pop(uint8_t thread, size_t &index) {
+			std::atomic<uint64_t> &range = this->queues[thread].range;
+			uint64_t value = range.load(std::memory_order_acquire);
+
+			while (true) {
+				const uint32_t head = (uint32_t) value;
+				const uint32_t tail = (uint32_t) (value >> 32);
+				if (head >= tail) return false;
+
+				if (range.compare_exchange_weak(value, pack(head + 1, tail), std::memory_order_acq_rel)) {
+					index = head;
+					return true;
+				}
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// TAKE THE BACK HALF OF ANOTHER THREAD'S QUEUE. THE FIRST STOLEN TASK
+		// IS RETURNED, AND THE REST BECOME THIS THREAD'S (EMPTY) QUEUE
+		////////////////////////////////////////////////////////////////////////
+		bool steal(uint8_t thread, size_t &index) {
+			for (uint8_t i=1; i<this->count; i++) {
+				const uint8_t victim = (thread + i) % this->count;
+				std::atomic<uint64_t> &range = this->queues[victim].range;
+				uint64_t value = range.load(std::memory_order_acquire);
+
+				while (true) {
+					const uint32_t head = (uint32_t) value;
+					const uint32_t tail = (uint32_t) (value >> 32);
+					if (head >= tail) break;
+
+					const uint32_t split = tail - (tail - head + 1) / 2;
+					if (range.compare_exchange_weak(value, pack(head, split), std::memory_order_acq_rel)) {
+						this->queues[thread].range.store(pack(split + 1, tail), std::memory_order_release);
+						this->stolen.fetch_add(tail - split, std::memory_order_relaxed);
+						index = split;
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RUN TASKS UNTIL THERE ARE NONE LEFT ANYWHERE
+		////////////////////////////////////////////////////////////////////////
+		void drain(uint8_t thread) {
+			size_t index;
+
+			while (this->pop(thread, index)  ||  this->steal(thread, index)) {
+				const task_t &task = this->work[index];
+				const color_render_span_t span = {
+					task.pixels,
+					task.count,
+					task.offset,
+					task.strip,
+					this->current,
+					thread,
+				};
+				this->strips[task.strip].effect(span);
+			}
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// POOL THREAD: SLEEP UNTIL THE NEXT FRAME, HELP RENDER IT, REPEAT
+		////////////////////////////////////////////////////////////////////////
+		void worker(uint8_t thread) {
+			uint32_t seen = 0;
+
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(this->mutex);
+					this->wake.wait(lock, [&]() { return this->stopping  ||  this->frame != seen; });
+					if (this->stopping) return;
+					seen = this->frame;
+				}
+
+				this->drain(thread);
+
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					if (--this->running) continue;
+				}
+				this->done.notify_one();
+			}
+		}
+
+
+
+
+		queue_t						queues[COLOR_RENDER_THREADS];
+		std::vector<strip_t>		strips;
+		std::vector<task_t>			work;
+		std::vector<std::thread>	pool;
+		std::mutex					mutex;
+		std::condition_variable		wake;
+		std::condition_variable		done;
+		std::atomic<uint64_t>		stolen;
+		size_t						tile;
+		uint32_t					frame;		// POOL GENERATION, GUARDED BY MUTEX
+		uint32_t					current;	// FRAME NUMBER FOR THE EFFECTS
+		uint8_t						count;
+		uint8_t						running;
+		bool						stopping;
+};
+
+
+
+
+#endif //__color_render_h__
@@ -0,0 +1,568 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| BULK BLEND OPERATIONS OVER ARRAYS OF COLOR_T VALUES.                         |
+| EVERY FUNCTION HERE GIVES THE EXACT SAME RESULT AS CALLING THE MATCHING      |
+| COLOR_T MEMBER FUNCTION ONCE PER PIXEL, BUT WORKS ON WHOLE SPANS AT A TIME.  |
+| ON HOSTS WITH SSE2, AVX2, OR NEON THE PACKED G-R-B BYTES ARE PROCESSED AS A  |
+| SINGLE BYTE STREAM, SO NO UNPACKING OF THE 3-BYTE PIXELS IS NEEDED.          |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_span_h__
+#define __color_span_h__
+
+
+
+
+#include "color.h"
+
+
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define COLOR_SPAN_AVX2		1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define COLOR_SPAN_SSE2		1
+#elif defined(__ARM_NEON)  ||  defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define COLOR_SPAN_NEON		1
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PER-BYTE BLEND OPERATIONS
+// EACH STRUCT HOLDS THE SCALAR FORM OF THE BLEND (MATCHING COLOR_T EXACTLY)
+// AND THE VECTOR FORM FOR WHICHEVER SIMD BACKEND WAS SELECTED ABOVE
+////////////////////////////////////////////////////////////////////////////////
+struct color_span_op_add {
+	static INLINE uint8_t scalar(const uint8_t a, const uint8_t b) {
+		return _min(255, a + b);
+	}
+
+	#if defined(COLOR_SPAN_AVX2)
+	static INLINE __m256i vector(const __m256i a, const __m256i b) {
+		return _mm256_adds_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_SSE2)
+	static INLINE __m128i vector(const __m128i a, const __m128i b) {
+		return _mm_adds_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_NEON)
+	static INLINE uint8x16_t vector(const uint8x16_t a, const uint8x16_t b) {
+		return vqaddq_u8(a, b);
+	}
+	#endif
+};
+
+
+
+struct color_span_op_sub {
+	static INLINE uint8_t scalar(const uint8_t a, const uint8_t b) {
+		return _max(0, a - b);
+	}
+
+	#if defined(COLOR_SPAN_AVX2)
+	static INLINE __m256i vector(const __m256i a, const __m256i b) {
+		return _mm256_subs_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_SSE2)
+	static INLINE __m128i vector(const __m128i a, const __m128i b) {
+		return _mm_subs_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_NEON)
+	static INLINE uint8x16_t vector(const uint8x16_t a, const uint8x16_t b) {
+		return vqsubq_u8(a, b);
+	}
+	#endif
+};
+
+
+
+struct color_span_op_min {
+	static INLINE uint8_t scalar(const uint8_t a, const uint8_t b) {
+		return _min(a, b);
+	}
+
+	#if defined(COLOR_SPAN_AVX2)
+	static INLINE __m256i vector(const __m256i a, const __m256i b) {
+		return _mm256_min_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_SSE2)
+	static INLINE __m128i vector(const __m128i a, const __m128i b) {
+		return _mm_min_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_NEON)
+	static INLINE uint8x16_t vector(const uint8x16_t a, const uint8x16_t b) {
+		return vminq_u8(a, b);
+	}
+	#endif
+};
+
+
+
+struct color_span_op_max {
+	static INLINE uint8_t scalar(const uint8_t a, const uint8_t b) {
+		return _max(a, b);
+	}
+
+	#if defined(COLOR_SPAN_AVX2)
+	static INLINE __m256i vector(const __m256i a, const __m256i b) {
+		return _mm256_max_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_SSE2)
+	static INLINE __m128i vector(const __m128i a, const __m128i b) {
+		return _mm_max_epu8(a, b);
+	}
+	#elif defined(COLOR_SPAN_NEON)
+	static INLINE uint8x16_t vector(const uint8x16_t a, const uint8x16_t b) {
+		return vmaxq_u8(a, b);
+	}
+	#endif
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NOTE:	(A * B) >> 8 NEVER EXCEEDS 254, SO THE UNSIGNED SATURATING PACK
+//			BELOW NEVER CLAMPS AND MATCHES COLOR_T::MULTIPLY BIT FOR BIT
+////////////////////////////////////////////////////////////////////////////////
+struct color_span_op_multiply {
+	static INLINE uint8_t scalar(const uint8_t a, const uint8_t b) {
+		return ((uint16_t)a * (uint16_t)b) >> 8;
+	}
+
+	#if defined(COLOR_SPAN_AVX2)
+	static INLINE __m256i vector(const __m256i a, const __m256i b) {
+		const __m256i zero	= _mm256_setzero_si256();
+		const __m256i lo	= _mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+		const __m256i hi	= _mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+		return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+	}
+	#elif defined(COLOR_SPAN_SSE2)
+	static INLINE __m128i vector(const __m128i a, const __m128i b) {
+		const __m128i zero	= _mm_setzero_si128();
+		const __m128i lo	= _mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+		const __m128i hi	= _mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+		return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+	}
+	#elif defined(COLOR_SPAN_NEON)
+	static INLINE uint8x16_t vector(const uint8x16_t a, const uint8x16_t b) {
+		const uint16x8_t lo	= vmull_u8(vget_low_u8(a),  vget_low_u8(b));
+		const uint16x8_t hi	= vmull_u8(vget_high_u8(a), vget_high_u8(b));
+		return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+	}
+	#endif
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NOTE:	SCREEN IS 255 - MULTIPLY(255 - A, 255 - B). ON X86 THE INVERSION IS
+//			DONE AFTER WIDENING TO 16 BITS, SINCE GCC TURNS AN 8-BIT INVERT INTO
+//			AN AVX-512 VPTERNLOG THAT FALSELY CHAINS EACH LOOP ITERATION TO THE
+//			PREVIOUS ONE AND MORE THAN HALVES THE THROUGHPUT
+////////////////////////////////////////////////////////////////////////////////
+struct color_span_op_screen {
+	static INLINE uint8_t scalar(const uint8_t a, const uint8_t b) {
+		return 255 - color_span_op_multiply::scalar(255 - a, 255 - b);
+	}
+
+	#if defined(COLOR_SPAN_AVX2)
+	static INLINE __m256i half(const __m256i a, const __m256i b) {
+		const __m256i full = _mm256_set1_epi16(255);
+		const __m256i prod = _mm256_mullo_epi16(_mm256_sub_epi16(full, a), _mm256_sub_epi16(full, b));
+		return _mm256_sub_epi16(full, _mm256_srli_epi16(prod, 8));
+	}
+
+	static INLINE __m256i vector(const __m256i a, const __m256i b) {
+		const __m256i zero = _mm256_setzero_si256();
+		return _mm256_packus_epi16(
+			half(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero)),
+			half(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero))
+		);
+	}
+	#elif defined(COLOR_SPAN_SSE2)
+	static INLINE __m128i half(const __m128i a, const __m128i b) {
+		const __m128i full = _mm_set1_epi16(255);
+		const __m128i prod = _mm_mullo_epi16(_mm_sub_epi16(full, a), _mm_sub_epi16(full, b));
+		return _mm_sub_epi16(full, _mm_srli_epi16(prod, 8));
+	}
+
+	static INLINE __m128i vector(const __m128i a, const __m128i b) {
+		const __m128i zero = _mm_setzero_si128();
+		return _mm_packus_epi16(
+			half(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)),
+			half(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero))
+		);
+	}
+	#elif defined(COLOR_SPAN_NEON)
+	static INLINE uint8x16_t vector(const uint8x16_t a, const uint8x16_t b) {
+		return vmvnq_u8(color_span_op_multiply::vector(vmvnq_u8(a), vmvnq_u8(b)));
+	}
+	#endif
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// VECTOR LOAD/STORE WRAPPERS FOR THE SELECTED BACKEND
+////////////////////////////////////////////////////////////////////////////////
+#if defined(COLOR_SPAN_AVX2)
+typedef __m256i color_span_vec_t;
+#define COLOR_SPAN_VEC_BYTES		32
+#define COLOR_SPAN_LOAD(ptr)		_mm256_loadu_si256((const __m256i*)(ptr))
+#define COLOR_SPAN_STORE(ptr, vec)	_mm256_storeu_si256((__m256i*)(ptr), (vec))
+
+#elif defined(COLOR_SPAN_SSE2)
+typedef __m128i color_span_vec_t;
+#define COLOR_SPAN_VEC_BYTES		16
+#define COLOR_SPAN_LOAD(ptr)		_mm_loadu_si128((const __m128i*)(ptr))
+#define COLOR_SPAN_STORE(ptr, vec)	_mm_storeu_si128((__m128i*)(ptr), (vec))
+
+#elif defined(COLOR_SPAN_NEON)
+typedef uint8x16_t color_span_vec_t;
+#define COLOR_SPAN_VEC_BYTES		16
+#define COLOR_SPAN_LOAD(ptr)		vld1q_u8((const uint8_t*)(ptr))
+#define COLOR_SPAN_STORE(ptr, vec)	vst1q_u8((uint8_t*)(ptr), (vec))
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// APPLY A BLEND OPERATION: DST[i] = OP(DST[i], SRC[i])
+// EVERY CHANNEL OF EVERY PIXEL IS INDEPENDENT AND BOTH BUFFERS SHARE THE SAME
+// G-R-B LAYOUT, SO THE SPAN IS TREATED AS A FLAT ARRAY OF 3*N BYTES
+////////////////////////////////////////////////////////////////////////////////
+template <class OP>
+inline void color_span_apply(color_t *dst, const color_t *src, size_t count) {
+	uint8_t			*d		= (uint8_t*) dst;
+	const uint8_t	*s		= (const uint8_t*) src;
+	const size_t	bytes	= count * sizeof(color_t);
+	size_t			i		= 0;
+
+	#ifdef COLOR_SPAN_VEC_BYTES
+	for (; i + COLOR_SPAN_VEC_BYTES <= bytes; i += COLOR_SPAN_VEC_BYTES) {
+		COLOR_SPAN_STORE(d + i, OP::vector(COLOR_SPAN_LOAD(d + i), COLOR_SPAN_LOAD(s + i)));
+	}
+	#endif
+
+	for (; i < bytes; i++) {
+		d[i] = OP::scalar(d[i], s[i]);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// APPLY A BLEND OPERATION: DST[i] = OP(DST[i], VALUE)
+// A 3-BYTE PIXEL ONLY LINES UP WITH A VECTOR REGISTER EVERY THREE REGISTERS,
+// SO THE VALUE IS REPEATED ACROSS THREE VECTORS AND THE LOOP STEPS BY THREE
+////////////////////////////////////////////////////////////////////////////////
+template <class OP>
+inline void color_span_apply(color_t *dst, const color_t value, size_t count) {
+	size_t i = 0;
+
+	#ifdef COLOR_SPAN_VEC_BYTES
+	color_t pattern[COLOR_SPAN_VEC_BYTES];
+	for (auto p=0; p<COLOR_SPAN_VEC_BYTES; p++) {
+		pattern[p] = value;
+	}
+
+	const uint8_t			*p	= (const uint8_t*) pattern;
+	const color_span_vec_t	v0	= COLOR_SPAN_LOAD(p + 0 * COLOR_SPAN_VEC_BYTES);
+	const color_span_vec_t	v1	= COLOR_SPAN_LOAD(p + 1 * COLOR_SPAN_VEC_BYTES);
+	const color_span_vec_t	v2	= COLOR_SPAN_LOAD(p + 2 * COLOR_SPAN_VEC_BYTES);
+
+	for (; i < count - count % COLOR_SPAN_VEC_BYTES; i += COLOR_SPAN_VEC_BYTES) {
+		uint8_t *d = (uint8_t*) (dst + i);
+		COLOR_SPAN_STORE(d + 0 * COLOR_SPAN_VEC_BYTES, OP::vector(COLOR_SPAN_LOAD(d + 0 * COLOR_SPAN_VEC_BYTES), v0));
+		COLOR_SPAN_STORE(d + 1 * COLOR_SPAN_VEC_BYTES, OP::vector(COLOR_SPAN_LOAD(d + 1 * COLOR_SPAN_VEC_BYTES), v1));
+		COLOR_SPAN_STORE(d + 2 * COLOR_SPAN_VEC_BYTES, OP::vector(COLOR_SPAN_LOAD(d + 2 * COLOR_SPAN_VEC_BYTES), v2));
+	}
+	#endif
+
+	for (; i < count; i++) {
+		dst[i].g = OP::scalar(dst[i].g, value.g);
+		dst[i].r = OP::scalar(dst[i].r, value.r);
+		dst[i].b = OP::scalar(dst[i].b, value.b);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// INCREASE VALUE - SAME AS COLOR_T::ADD
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color_span_add(color_t *dst, const color_t *src, size_t count) {
+	color_span_apply<color_span_op_add>(dst, src, count);
+}
+
+INLINE void color_span_add(color_t *dst, const color_t value, size_t count) {
+	color_span_apply<color_span_op_add>(dst, value, count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DECREASE VALUE - SAME AS COLOR_T::SUB
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color_span_sub(color_t *dst, const color_t *src, size_t count) {
+	color_span_apply<color_span_op_sub>(dst, src, count);
+}
+
+INLINE void color_span_sub(color_t *dst, const color_t value, size_t count) {
+	color_span_apply<color_span_op_sub>(dst, value, count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// "SCREEN" BLEND - SAME AS COLOR_T::SCREEN
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color_span_screen(color_t *dst, const color_t *src, size_t count) {
+	color_span_apply<color_span_op_screen>(dst, src, count);
+}
+
+INLINE void color_span_screen(color_t *dst, const color_t value, size_t count) {
+	color_span_apply<color_span_op_screen>(dst, value, count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// "MULTIPLY" BLEND - SAME AS COLOR_T::MULTIPLY
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color_span_multiply(color_t *dst, const color_t *src, size_t count) {
+	color_span_apply<color_span_op_multiply>(dst, src, count);
+}
+
+INLINE void color_span_multiply(color_t *dst, const color_t value, size_t count) {
+	color_span_apply<color_span_op_multiply>(dst, value, count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MINIMUM OF TWO VALUES - SAME AS COLOR_T::MIN
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color_span_min(color_t *dst, const color_t *src, size_t count) {
+	color_span_apply<color_span_op_min>(dst, src, count);
+}
+
+INLINE void color_span_min(color_t *dst, const color_t value, size_t count) {
+	color_span_apply<color_span_op_min>(dst, value, count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MAXIMUM OF TWO VALUES - SAME AS COLOR_T::MAX
+////////////////////////////////////////////////////////////////////////////////
+INLINE void color_span_max(color_t *dst, const color_t *src, size_t count) {
+	color_span_apply<color_span_op_max>(dst, src, count);
+}
+
+INLINE void color_span_max(color_t *dst, const color_t value, size_t count) {
+	color_span_apply<color_span_op_max>(dst, value, count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ROUNDED BLEND, SAME AS COLOR_T::BLEND: (A * KEEP + B * TAKE) / 255, WHERE
+// KEEP IS 255 - TAKE. THE BYTES ARE WIDENED TO 16 BITS, WHERE THE SUM STILL
+// FITS WITH ROOM FOR THE ROUNDING, THEN NARROWED BACK DOWN
+////////////////////////////////////////////////////////////////////////////////
+#if defined(__SSE2__)
+static INLINE __m128i color_span_lerp_half(const __m128i a, const __m128i b, const __m128i keep, const __m128i take) {
+	const __m128i x = _mm_add_epi16(
+		_mm_add_epi16(_mm_mullo_epi16(a, keep), _mm_mullo_epi16(b, take)),
+		_mm_set1_epi16(128)
+	);
+	return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+static INLINE __m128i color_span_lerp_sse2(const __m128i a, const __m128i b,
+		const __m128i keep_lo, const __m128i take_lo, const __m128i keep_hi, const __m128i take_hi) {
+	const __m128i zero = _mm_setzero_si128();
+	return _mm_packus_epi16(
+		color_span_lerp_half(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero), keep_lo, take_lo),
+		color_span_lerp_half(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero), keep_hi, take_hi)
+	);
+}
+#endif
+
+
+
+#if defined(COLOR_SPAN_AVX2)
+static INLINE __m256i color_span_lerp(const __m256i a, const __m256i b, const uint8_t alpha) {
+	const __m256i zero	= _mm256_setzero_si256();
+	const __m256i keep	= _mm256_set1_epi16(255 - alpha);
+	const __m256i take	= _mm256_set1_epi16(alpha);
+	const __m256i round	= _mm256_set1_epi16(128);
+
+	__m256i lo = _mm256_add_epi16(_mm256_add_epi16(
+		_mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), keep),
+		_mm256_mullo_epi16(_mm256_unpacklo_epi8(b, zero), take)), round);
+	__m256i hi = _mm256_add_epi16(_mm256_add_epi16(
+		_mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), keep),
+		_mm256_mullo_epi16(_mm256_unpackhi_epi8(b, zero), take)), round);
+
+	lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+	hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+	return _mm256_packus_epi16(lo, hi);
+}
+#elif defined(COLOR_SPAN_SSE2)
+static INLINE __m128i color_span_lerp(const __m128i a, const __m128i b, const uint8_t alpha) {
+	const __m128i keep = _mm_set1_epi16(255 - alpha);
+	const __m128i take = _mm_set1_epi16(alpha);
+	return color_span_lerp_sse2(a, b, keep, take, keep, take);
+}
+#elif defined(COLOR_SPAN_NEON)
+static INLINE uint8x16_t color_span_lerp(const uint8x16_t a, const uint8x16_t b, const uint8_t alpha) {
+	const uint8x8_t keep	= vdup_n_u8(255 - alpha);
+	const uint8x8_t take	= vdup_n_u8(alpha);
+	const uint16x8_t lo		= vmlal_u8(vmull_u8(vget_low_u8(a),  keep), vget_low_u8(b),  take);
+	const uint16x8_t hi		= vmlal_u8(vmull_u8(vget_high_u8(a), keep), vget_high_u8(b), take);
+
+	// (X + 128 + ((X + 128) >> 8)) >> 8, THE USUAL NEON DIVIDE BY 255
+	return vcombine_u8(
+		vraddhn_u16(lo, vrshrq_n_u16(lo, 8)),
+		vraddhn_u16(hi, vrshrq_n_u16(hi, 8))
+	);
+}
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CROSSFADE BETWEEN TWO BUFFERS WITH ONE ALPHA FOR THE WHOLE SPAN:
+// DST[i] = COLOR_T::LERP(A[i], B[i], ALPHA). DST MAY BE THE SAME AS A OR B.
+// ALPHA 0 AND 255 ARE PLAIN COPIES, SO THE ENDS OF A FADE COST NOTHING EXTRA
+////////////////////////////////////////////////////////////////////////////////
+inline void color_span_blend(color_t *dst, const color_t *a, const color_t *b, const uint8_t alpha, size_t count) {
+	if (alpha == 0  ||  alpha == 255) {
+		const color_t *src = alpha ? b : a;
+		if (dst != src) memmove((void*)dst, (const void*)src, count * sizeof(color_t));
+		return;
+	}
+
+	uint8_t			*d		= (uint8_t*) dst;
+	const uint8_t	*x		= (const uint8_t*) a;
+	const uint8_t	*y		= (const uint8_t*) b;
+	const size_t	bytes	= count * sizeof(color_t);
+	size_t			i		= 0;
+
+	#ifdef COLOR_SPAN_VEC_BYTES
+	for (; i < bytes - bytes % COLOR_SPAN_VEC_BYTES; i += COLOR_SPAN_VEC_BYTES) {
+		COLOR_SPAN_STORE(d + i, color_span_lerp(COLOR_SPAN_LOAD(x + i), COLOR_SPAN_LOAD(y + i), alpha));
+	}
+	#endif
+
+	for (; i < bytes; i++) {
+		d[i] = color_t::blend(x[i], y[i], alpha);
+	}
+}
+
+
+
+INLINE void color_span_blend(color_t *dst, const color_t *src, const uint8_t alpha, size_t count) {
+	color_span_blend(dst, dst, src, alpha, count);
+}
+
+
+
+
+#if defined(__SSSE3__)
+////////////////////////////////////////////////////////////////////////////////
+// PSHUFB MASKS FOR COLOR_SPAN_BLEND_MASK. BYTE J OF VECTOR V TAKES ALPHA
+// (V * 16 + J) / 3, THE PIXEL THAT CHANNEL BELONGS TO
+////////////////////////////////////////////////////////////////////////////////
+static const uint8_t color_span_spread[3][16] = {
+	{0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5},
+	{5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10},
+	{10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15},
+};
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CROSSFADE BETWEEN TWO BUFFERS WITH AN ALPHA PER PIXEL:
+// DST[i] = COLOR_T::LERP(A[i], B[i], MASK[i]). DST MAY BE THE SAME AS A OR B.
+// WITH SSSE3, SIXTEEN MASK BYTES ARE SPREAD OVER THE 48 BYTES OF SIXTEEN
+// PIXELS WITH THREE PSHUFB, SO EACH CHANNEL GETS ITS PIXEL'S ALPHA
+////////////////////////////////////////////////////////////////////////////////
+inline void color_span_blend_mask(color_t *dst, const color_t *a, const color_t *b, const uint8_t *mask, size_t count) {
+	size_t i = 0;
+
+	#if defined(__SSSE3__)
+	const __m128i	zero	= _mm_setzero_si128();
+	const __m128i	full	= _mm_set1_epi16(255);
+	const __m128i	s0		= _mm_loadu_si128((const __m128i*)color_span_spread[0]);
+	const __m128i	s1		= _mm_loadu_si128((const __m128i*)color_span_spread[1]);
+	const __m128i	s2		= _mm_loadu_si128((const __m128i*)color_span_spread[2]);
+
+	for (; i < count - count % 16; i += 16) {
+		const __m128i	alpha	= _mm_loadu_si128((const __m128i*)(mask + i));
+		const __m128i	take[3]	= {
+			_mm_shuffle_epi8(alpha, s0),
+			_mm_shuffle_epi8(alpha, s1),
+			_mm_shuffle_epi8(alpha, s2),
+		};
+
+		for (uint8_t v=0; v<3; v++) {
+			const __m128i take_lo = _mm_unpacklo_epi8(take[v], zero);
+			const __m128i take_hi = _mm_unpackhi_epi8(take[v], zero);
+			const uint8_t *x = (const uint8_t*) (a + i) + v * 16;
+			const uint8_t *y = (const uint8_t*) (b + i) + v * 16;
+
+			_mm_storeu_si128((__m128i*)((uint8_t*)(dst + i) + v * 16), color_span_lerp_sse2(
+				_mm_loadu_si128((const __m128i*)x),
+				_mm_loadu_si128((const __m128i*)y),
+				_mm_sub_epi16(full, take_lo), take_lo,
+				_mm_sub_epi16(full, take_hi), take_hi
+			));
+		}
+	}
+	#endif
+
+	for (; i < count; i++) {
+		dst[i] = color_t::lerp(a[i], b[i], mask[i]);
+	}
+}
+
+
+
+INLINE void color_span_blend_mask(color_t *dst, const color_t *src, const uint8_t *mask, size_t count) {
+	color_span_blend_mask(dst, dst, src, mask, count);
+}
+
+
+
+
+#endif //__color_span_h__
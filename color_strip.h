@@ -0,0 +1,351 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| CONTAINER FOR A STRIP OF COLOR_T PIXELS THAT REMEMBERS WHICH PIXELS CHANGED. |
+| EVERY WRITE THROUGH THE STRIP UPDATES A SMALL LIST OF DIRTY INDEX RANGES, SO |
+| THE OUTPUT LAYER CAN RESEND ONLY THE CHANGED SPANS, OR SKIP A FRAME ENTIRELY |
+| WHEN NOTHING CHANGED AT ALL.                                                 |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_strip_h__
+#define __color_strip_h__
+
+
+
+
+#include "color.h"
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MAXIMUM NUMBER OF SEPARATE DIRTY RANGES TRACKED PER STRIP. WHEN A WRITE
+// WOULD CREATE ONE MORE RANGE THAN THIS, THE TWO CLOSEST RANGES ARE MERGED.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COLOR_STRIP_RANGES
+#define COLOR_STRIP_RANGES		4
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HALF-OPEN RANGE OF PIXEL INDEXES [FIRST, LAST)
+////////////////////////////////////////////////////////////////////////////////
+struct color_range_t {
+	size_t first;
+	size_t last;
+
+	INLINE size_t size() const {
+		return this->last - this->first;
+	}
+};
+
+
+
+
+class color_strip_t {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// WRAP EXISTING PIXEL STORAGE. THE WHOLE STRIP STARTS OUT DIRTY, SINCE
+		// NOTHING HAS BEEN SENT TO THE LEDS YET
+		////////////////////////////////////////////////////////////////////////
+		color_strip_t(color_t *pixels, size_t count) {
+			this->pixels	= pixels;
+			this->count		= count;
+			this->invalidate();
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// PIXEL STORAGE ACCESS
+		////////////////////////////////////////////////////////////////////////
+		INLINE size_t size() const {
+			return this->count;
+		}
+
+		INLINE const color_t *data() const {
+			return this->pixels;
+		}
+
+		INLINE const color_t &operator[](size_t index) const {
+			return this->pixels[index];
+		}
+
+		INLINE color_t get(size_t index) const {
+			return this->pixels[index];
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SET A SINGLE PIXEL. WRITING THE VALUE A PIXEL ALREADY HAS DOES NOT
+		// MARK IT AS DIRTY
+		////////////////////////////////////////////////////////////////////////
+		INLINE void set(size_t index, const color_t color) {
+			if (index >= this->count) return;
+
+			color_t &pixel = this->pixels[index];
+			if (pixel.g == color.g  &&  pixel.r == color.r  &&  pixel.b == color.b) return;
+
+			pixel = color;
+			this->mark(index, 1);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COPY A SPAN OF PIXELS INTO THE STRIP. ONLY THE PORTION BETWEEN THE
+		// FIRST AND LAST PIXELS THAT ACTUALLY CHANGED IS MARKED AS DIRTY
+		////////////////////////////////////////////////////////////////////////
+		void write(size_t first, const color_t *source, size_t length) {
+			if (!this->clip(first, length)) return;
+
+			const uint8_t	*src	= (const uint8_t*) source;
+			uint8_t			*dst	= (uint8_t*) (this->pixels + first);
+			size_t			head	= 0;
+			size_t			tail	= length;
+
+			while (head < tail  &&  !memcmp(dst + head * sizeof(color_t), src + head * sizeof(color_t), sizeof(color_t))) head++;
+			while (tail > head  &&  !memcmp(dst + (tail-1) * sizeof(color_t), src + (tail-1) * sizeof(color_t), sizeof(color_t))) tail--;
+
+			if (head == tail) return;
+
+			memcpy(dst + head * sizeof(color_t), src + head * sizeof(color_t), (tail - head) * sizeof(color_t));
+			this->mark(first + head, tail - head);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// FILL A SPAN OF PIXELS (OR THE WHOLE STRIP) WITH A SINGLE COLOR
+		////////////////////////////////////////////////////////////////////////
+		INLINE void fill(const color_t color) {
+			this->fill(0, this->count, color);
+		}
+
+		void fill(size_t first, size_t length, const color_t color) {
+			if (!this->clip(first, length)) return;
+
+			for (size_t i=first; i<first+length; i++) {
+				this->pixels[i] = color;
+			}
+
+			this->mark(first, length);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// GET WRITABLE ACCESS TO A SPAN OF PIXELS, SUCH AS FOR THE COLOR_SPAN_*
+		// BULK FUNCTIONS. THE WHOLE SPAN IS MARKED AS DIRTY
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_t *modify(size_t first, size_t length) {
+			if (!this->clip(first, length)) return nullptr;
+			this->mark(first, length);
+			return this->pixels + first;
+		}
+
+		INLINE color_t *modify() {
+			return this->modify(0, this->count);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DIRTY RANGE QUERIES
+		// RANGES ARE SORTED BY INDEX AND NEVER OVERLAP OR TOUCH EACH OTHER
+		////////////////////////////////////////////////////////////////////////
+		INLINE bool dirty() const {
+			return this->used > 0;
+		}
+
+		INLINE uint8_t ranges() const {
+			return this->used;
+		}
+
+		INLINE const color_range_t &range(uint8_t index) const {
+			return this->dirties[index];
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SINGLE RANGE COVERING EVERY DIRTY PIXEL, FOR OUTPUTS THAT CAN ONLY
+		// SEND ONE CONTIGUOUS SPAN PER FRAME. EMPTY WHEN NOTHING IS DIRTY
+		////////////////////////////////////////////////////////////////////////
+		INLINE color_range_t bounds() const {
+			color_range_t bounds = {0, 0};
+			if (this->used) {
+				bounds.first	= this->dirties[0].first;
+				bounds.last		= this->dirties[this->used - 1].last;
+			}
+			return bounds;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CALL AFTER THE DIRTY PIXELS HAVE BEEN SENT TO THE LEDS
+		////////////////////////////////////////////////////////////////////////
+		INLINE void clean() {
+			this->used = 0;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// MARK THE ENTIRE STRIP AS DIRTY, FORCING A FULL RESEND
+		////////////////////////////////////////////////////////////////////////
+		INLINE void invalidate() {
+			this->used = 0;
+			if (this->count) this->mark(0, this->count);
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// MARK A SPAN OF PIXELS AS DIRTY, MERGING IT WITH ANY EXISTING RANGES
+		// IT OVERLAPS OR TOUCHES
+		////////////////////////////////////////////////////////////////////////
+		void mark(size_t first, size_t length) {
+			if (!this->clip(first, length)) return;
+
+			size_t last = first + length;
+
+			// FIND WHERE THE NEW RANGE STARTS TOUCHING THE EXISTING RANGES
+			uint8_t lo = 0;
+			while (lo < this->used  &&  this->dirties[lo].last < first) lo++;
+
+			uint8_t hi = lo;
+			while (hi < this->used  &&  this->dirties[hi].first <= last) hi++;
+
+			if (lo < hi) {
+				// MERGE WITH RANGES [LO, HI) AND CLOSE UP THE GAP
+				first	= _min(first, this->dirties[lo].first);
+				last	= _max(last, this->dirties[hi-1].last);
+
+				this->dirties[lo].first	= first;
+				this->dirties[lo].last	= last;
+
+				for (uint8_t i=hi; i<this->used; i++) {
+					this->dirties[lo + 1 + i - hi] = this->dirties[i];
+				}
+				this->used -= hi - lo - 1;
+				return;
+			}
+
+			this->insert(lo, first, last);
+
+			// OUT OF SLOTS, SO MERGE THE TWO CLOSEST NEIGHBOURS TO MAKE ROOM
+			if (this->used > COLOR_STRIP_RANGES) this->collapse();
+		}
+
+
+
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////
+		// CLAMP A SPAN TO THE STRIP, RETURNS FALSE IF NOTHING IS LEFT
+		////////////////////////////////////////////////////////////////////////
+		INLINE bool clip(size_t first, size_t &length) const {
+			if (first >= this->count) return false;
+			if (length > this->count - first) length = this->count - first;
+			return length > 0;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INSERT A NEW RANGE AT POSITION INDEX. THE RANGE TABLE HAS ONE SPARE
+		// SLOT SO THIS CAN BRIEFLY HOLD COLOR_STRIP_RANGES + 1 ENTRIES
+		////////////////////////////////////////////////////////////////////////
+		void insert(uint8_t index, size_t first, size_t last) {
+			for (uint8_t i=this->used; i>index; i--) {
+				this->dirties[i] = this->dirties[i-1];
+			}
+
+			this->dirties[index].first	= first;
+			this->dirties[index].last	= last;
+			this->used++;
+		}
+
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// MERGE THE TWO NEIGHBOURING RANGES WITH THE SMALLEST GAP BETWEEN THEM,
+		// WHICH ADDS THE FEWEST CLEAN PIXELS TO THE NEXT TRANSMISSION
+		////////////////////////////////////////////////////////////////////////
+		void collapse() {
+			uint8_t	best	= 0;
+			size_t	gap		= (size_t) -1;
+
+			for (uint8_t i=0; i+1<this->used; i++) {
+				size_t between = this->dirties[i+1].first - this->dirties[i].last;
+				if (between < gap) {
+					gap		= between;
+					best	= i;
+				}
+			}
+
+			this->dirties[best].last = this->dirties[best+1].last;
+
+			for (uint8_t i=best+1; i+1<this->used; i++) {
+				this->dirties[i] = this->dirties[i+1];
+			}
+
+			this->used--;
+		}
+
+
+
+
+		color_t			*pixels;
+		size_t			count;
+		uint8_t			used;
+		color_range_t	dirties[COLOR_STRIP_RANGES + 1];
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// STRIP THAT OWNS ITS OWN PIXEL STORAGE
+////////////////////////////////////////////////////////////////////////////////
+template <size_t COUNT>
+class color_framebuffer_t : public color_strip_t {
+	public:
+		color_framebuffer_t() : color_strip_t(storage, COUNT) {}
+
+		// THE BASE CLASS POINTS INTO THIS OBJECT, SO IT CANNOT BE COPIED
+		color_framebuffer_t(const color_framebuffer_t &) = delete;
+		color_framebuffer_t &operator =(const color_framebuffer_t &) = delete;
+
+	private:
+		color_t storage[COUNT];
+};
+
+
+
+
+#endif //__color_strip_h__
@@ -0,0 +1,242 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| ENCODES COLOR_T PIXELS INTO AN SPI (OR I2S) BIT STREAM THAT REPRODUCES THE   |
+| WS2812B WAVEFORM. EACH DATA BIT BECOMES 3 OR 4 SPI BITS:                     |
+|   3-BIT: 0 = 100, 1 = 110   AT 2.4MHZ (417NS PER SPI BIT)                    |
+|   4-BIT: 0 = 1000, 1 = 1110 AT 3.2MHZ (312NS PER SPI BIT)                    |
+| COLOR_T IS ALREADY IN G-R-B WIRE ORDER, SO THE FRAME IS ENCODED AS ONE FLAT  |
+| BYTE STREAM. THE OUTPUT BUFFER IS ALWAYS PROVIDED BY THE CALLER.             |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __color_ws2812_h__
+#define __color_ws2812_h__
+
+
+
+
+#include "color.h"
+
+
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SPI CLOCK RATES FOR EACH ENCODING, AND THE LOW TIME NEEDED TO LATCH A FRAME.
+// OLDER WS2812B PARTS LATCH AFTER 50US, NEWER ONES NEED 280US.
+////////////////////////////////////////////////////////////////////////////////
+#define COLOR_WS2812_3BIT_HZ		2400000ul
+#define COLOR_WS2812_4BIT_HZ		3200000ul
+
+#ifndef COLOR_WS2812_RESET_US
+#define COLOR_WS2812_RESET_US		300
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EXPANSION TABLES
+// 3-BIT: A DATA BYTE B7..B0 BECOMES THE 24 SPI BITS 1B70 1B60 1B50 ... 1B00,
+// WHICH SPLITS INTO THREE OUTPUT BYTES DEPENDING ON B7-B5, B4-B3, AND B2-B0.
+// 4-BIT: EACH PAIR OF DATA BITS BECOMES ONE OUTPUT BYTE.
+////////////////////////////////////////////////////////////////////////////////
+static CONST uint8_t color_ws2812_3bit_hi[8] = {
+	0x92, 0x93, 0x9A, 0x9B, 0xD2, 0xD3, 0xDA, 0xDB,
+};
+
+static CONST uint8_t color_ws2812_3bit_mid[4] = {
+	0x49, 0x4D, 0x69, 0x6D,
+};
+
+static CONST uint8_t color_ws2812_3bit_lo[8] = {
+	0x24, 0x26, 0x34, 0x36, 0xA4, 0xA6, 0xB4, 0xB6,
+};
+
+static CONST uint8_t color_ws2812_4bit[4] = {
+	0x88, 0x8E, 0xE8, 0xEE,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NUMBER OF ZERO BYTES NEEDED TO HOLD THE LINE LOW FOR THE RESET LATCH
+////////////////////////////////////////////////////////////////////////////////
+INLINE size_t color_ws2812_reset_bytes(uint32_t spi_hz, uint32_t reset_us=COLOR_WS2812_RESET_US) {
+	return ((spi_hz / 1000) * reset_us + 7999) / 8000;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// OUTPUT BUFFER SIZE NEEDED FOR A FRAME, INCLUDING THE RESET PADDING
+////////////////////////////////////////////////////////////////////////////////
+INLINE size_t color_ws2812_size3(size_t count, size_t reset=0) {
+	return count * sizeof(color_t) * 3 + reset;
+}
+
+INLINE size_t color_ws2812_size4(size_t count, size_t reset=0) {
+	return count * sizeof(color_t) * 4 + reset;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PORTABLE BYTE-AT-A-TIME ENCODERS, USED ON TARGETS WITHOUT SSSE3 AND FOR
+// THE LAST FEW BYTES OF A FRAME ON HOSTS THAT HAVE IT
+////////////////////////////////////////////////////////////////////////////////
+inline uint8_t *color_ws2812_encode3_scalar(const uint8_t *in, size_t bytes, uint8_t *out) {
+	for (size_t i=0; i<bytes; i++) {
+		const uint8_t byte = in[i];
+		*out++ = pgm_read_byte(&color_ws2812_3bit_hi[byte >> 5]);
+		*out++ = pgm_read_byte(&color_ws2812_3bit_mid[(byte >> 3) & 0x03]);
+		*out++ = pgm_read_byte(&color_ws2812_3bit_lo[byte & 0x07]);
+	}
+	return out;
+}
+
+inline uint8_t *color_ws2812_encode4_scalar(const uint8_t *in, size_t bytes, uint8_t *out) {
+	for (size_t i=0; i<bytes; i++) {
+		const uint8_t byte = in[i];
+		*out++ = pgm_read_byte(&color_ws2812_4bit[(byte >> 6)       ]);
+		*out++ = pgm_read_byte(&color_ws2812_4bit[(byte >> 4) & 0x03]);
+		*out++ = pgm_read_byte(&color_ws2812_4bit[(byte >> 2) & 0x03]);
+		*out++ = pgm_read_byte(&color_ws2812_4bit[(byte >> 0) & 0x03]);
+	}
+	return out;
+}
+
+
+
+
+#if defined(__SSSE3__)
+////////////////////////////////////////////////////////////////////////////////
+// SSSE3 ENCODERS - 16 INPUT BYTES PER LOOP. THE EXPANSION TABLES ARE SMALL
+// ENOUGH TO LIVE IN A REGISTER, SO EACH GROUP OF BITS IS ONE PSHUFB LOOKUP.
+////////////////////////////////////////////////////////////////////////////////
+inline uint8_t *color_ws2812_encode3_ssse3(const uint8_t *in, size_t bytes, uint8_t *out) {
+	const __m128i hi_table	= _mm_setr_epi8((char)0x92, (char)0x93, (char)0x9A, (char)0x9B, (char)0xD2, (char)0xD3, (char)0xDA, (char)0xDB, 0,0,0,0,0,0,0,0);
+	const __m128i mid_table	= _mm_setr_epi8(0x49, 0x4D, 0x69, 0x6D, 0,0,0,0,0,0,0,0,0,0,0,0);
+	const __m128i lo_table	= _mm_setr_epi8(0x24, 0x26, 0x34, 0x36, (char)0xA4, (char)0xA6, (char)0xB4, (char)0xB6, 0,0,0,0,0,0,0,0);
+	const __m128i three		= _mm_set1_epi8(0x03);
+	const __m128i seven		= _mm_set1_epi8(0x07);
+
+	// INTERLEAVE THREE 16-BYTE VECTORS A, B, C INTO A0 B0 C0 A1 B1 C1 ...
+	// NEGATIVE ENTRIES ZERO THE OUTPUT BYTE, SO THE THREE SHUFFLES CAN BE OR'D
+	const __m128i a0 = _mm_setr_epi8( 0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1,  5);
+	const __m128i b0 = _mm_setr_epi8(-1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1);
+	const __m128i c0 = _mm_setr_epi8(-1, -1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1);
+	const __m128i a1 = _mm_setr_epi8(-1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10, -1);
+	const __m128i b1 = _mm_setr_epi8( 5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10);
+	const __m128i c1 = _mm_setr_epi8(-1,  5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1);
+	const __m128i a2 = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+	const __m128i b2 = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+	const __m128i c2 = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+
+	for (; bytes >= 16; bytes -= 16, in += 16, out += 48) {
+		const __m128i data	= _mm_loadu_si128((const __m128i*)in);
+		const __m128i hi	= _mm_shuffle_epi8(hi_table,  _mm_and_si128(_mm_srli_epi16(data, 5), seven));
+		const __m128i mid	= _mm_shuffle_epi8(mid_table, _mm_and_si128(_mm_srli_epi16(data, 3), three));
+		const __m128i lo	= _mm_shuffle_epi8(lo_table,  _mm_and_si128(data, seven));
+
+		_mm_storeu_si128((__m128i*)(out +  0), _mm_or_si128(_mm_or_si128(
+			_mm_shuffle_epi8(hi, a0), _mm_shuffle_epi8(mid, b0)), _mm_shuffle_epi8(lo, c0)));
+		_mm_storeu_si128((__m128i*)(out + 16), _mm_or_si128(_mm_or_si128(
+			_mm_shuffle_epi8(hi, a1), _mm_shuffle_epi8(mid, b1)), _mm_shuffle_epi8(lo, c1)));
+		_mm_storeu_si128((__m128i*)(out + 32), _mm_or_si128(_mm_or_si128(
+			_mm_shuffle_epi8(hi, a2), _mm_shuffle_epi8(mid, b2)), _mm_shuffle_epi8(lo, c2)));
+	}
+
+	return color_ws2812_encode3_scalar(in, bytes, out);
+}
+
+
+
+inline uint8_t *color_ws2812_encode4_ssse3(const uint8_t *in, size_t bytes, uint8_t *out) {
+	const __m128i table	= _mm_setr_epi8((char)0x88, (char)0x8E, (char)0xE8, (char)0xEE, 0,0,0,0,0,0,0,0,0,0,0,0);
+	const __m128i three	= _mm_set1_epi8(0x03);
+
+	for (; bytes >= 16; bytes -= 16, in += 16, out += 64) {
+		const __m128i data	= _mm_loadu_si128((const __m128i*)in);
+		const __m128i b76	= _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(data, 6), three));
+		const __m128i b54	= _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(data, 4), three));
+		const __m128i b32	= _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(data, 2), three));
+		const __m128i b10	= _mm_shuffle_epi8(table, _mm_and_si128(data, three));
+
+		const __m128i lo	= _mm_unpacklo_epi8(b76, b54);
+		const __m128i hi	= _mm_unpackhi_epi8(b76, b54);
+		const __m128i lo2	= _mm_unpacklo_epi8(b32, b10);
+		const __m128i hi2	= _mm_unpackhi_epi8(b32, b10);
+
+		_mm_storeu_si128((__m128i*)(out +  0), _mm_unpacklo_epi16(lo, lo2));
+		_mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi16(lo, lo2));
+		_mm_storeu_si128((__m128i*)(out + 32), _mm_unpacklo_epi16(hi, hi2));
+		_mm_storeu_si128((__m128i*)(out + 48), _mm_unpackhi_epi16(hi, hi2));
+	}
+
+	return color_ws2812_encode4_scalar(in, bytes, out);
+}
+#endif
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ENCODE A FLAT BYTE STREAM WITH THE FASTEST ENCODER FOR THIS TARGET.
+// RETURNS A POINTER JUST PAST THE LAST OUTPUT BYTE
+////////////////////////////////////////////////////////////////////////////////
+INLINE uint8_t *color_ws2812_encode3_bytes(const uint8_t *in, size_t bytes, uint8_t *out) {
+	#if defined(__SSSE3__)
+	return color_ws2812_encode3_ssse3(in, bytes, out);
+	#else
+	return color_ws2812_encode3_scalar(in, bytes, out);
+	#endif
+}
+
+INLINE uint8_t *color_ws2812_encode4_bytes(const uint8_t *in, size_t bytes, uint8_t *out) {
+	#if defined(__SSSE3__)
+	return color_ws2812_encode4_ssse3(in, bytes, out);
+	#else
+	return color_ws2812_encode4_scalar(in, bytes, out);
+	#endif
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ENCODE A FRAME OF PIXELS, FOLLOWED BY RESET BYTES OF ZERO PADDING.
+// OUT MUST HOLD COLOR_WS2812_SIZE3/4(COUNT, RESET) BYTES.
+// RETURNS THE NUMBER OF BYTES WRITTEN.
+////////////////////////////////////////////////////////////////////////////////
+inline size_t color_ws2812_encode3(const color_t *pixels, size_t count, uint8_t *out, size_t reset=0) {
+	uint8_t *end = color_ws2812_encode3_bytes((const uint8_t*)pixels, count * sizeof(color_t), out);
+	memset(end, 0, reset);
+	return (end - out) + reset;
+}
+
+
+
+inline size_t color_ws2812_encode4(const color_t *pixels, size_t count, uint8_t *out, size_t reset=0) {
+	uint8_t *end = color_ws2812_encode4_bytes((const uint8_t*)pixels, count * sizeof(color_t), out);
+	memset(end, 0, reset);
+	return (end - out) + reset;
+}
+
+
+
+
+#endif //__color_ws2812_h__
@@ -0,0 +1,128 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| MINIMAL STAND-IN FOR THE ARDUINO CORE HEADER, SO THE LIBRARY CAN BE BUILT    |
+| AND BENCHMARKED ON A LINUX HOST. ONLY THE PIECES THIS LIBRARY USES ARE HERE: |
+| THE STRING CLASS, THE PROGMEM ACCESSORS, THE CLOCKS, AND THE DELAYS.         |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#ifndef __host_arduino_h__
+#define __host_arduino_h__
+
+
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// THERE IS NO SEPARATE FLASH ADDRESS SPACE ON THE HOST, SO PROGMEM DATA IS
+// JUST REGULAR READ-ONLY DATA AND THE _P ACCESSORS ARE PLAIN MEMORY READS
+////////////////////////////////////////////////////////////////////////////////
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define memcpy_P(dst, src, len)		memcpy((dst), (src), (len))
+#define strcmp_P(a, b)				strcmp((a), (b))
+#define strlen_P(a)					strlen((a))
+#define pgm_read_byte(addr)			(*(const uint8_t*)(addr))
+#define pgm_read_word(addr)			(*(const uint16_t*)(addr))
+#define pgm_read_dword(addr)		(*(const uint32_t*)(addr))
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MICROSECONDS AND MILLISECONDS SINCE AN ARBITRARY FIXED POINT IN TIME
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long micros() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)ts.tv_sec * 1000000ul + (unsigned long)(ts.tv_nsec / 1000);
+}
+
+inline unsigned long millis() {
+	return micros() / 1000ul;
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SLEEP FOR AT LEAST THE GIVEN TIME. THE HOST MAY OVERSLEEP BY THE SCHEDULER'S
+// TIMER SLACK, WHERE THE REAL CORE SPINS AND IS ACCURATE TO A FEW MICROSECONDS
+////////////////////////////////////////////////////////////////////////////////
+inline void delayMicroseconds(unsigned int us) {
+	struct timespec ts;
+	ts.tv_sec	= us / 1000000u;
+	ts.tv_nsec	= (long)(us % 1000000u) * 1000l;
+	nanosleep(&ts, nullptr);
+}
+
+inline void delay(unsigned long ms) {
+	while (ms--) delayMicroseconds(1000);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ARDUINO STRING CLASS - ONLY CONSTRUCTION, COPYING, AND C_STR ARE SUPPORTED
+////////////////////////////////////////////////////////////////////////////////
+class String {
+	public:
+		String(const char *string="") {
+			this->assign(string, strlen(string));
+		}
+
+		String(const String &string) {
+			this->assign(string.buffer, string.len);
+		}
+
+		~String() {
+			delete[] this->buffer;
+		}
+
+		String &operator =(const String &string) {
+			if (this != &string) {
+				delete[] this->buffer;
+				this->assign(string.buffer, string.len);
+			}
+			return *this;
+		}
+
+		const char *c_str() const {
+			return this->buffer;
+		}
+
+		unsigned int length() const {
+			return this->len;
+		}
+
+
+	private:
+		void assign(const char *string, size_t len) {
+			this->len		= len;
+			this->buffer	= new char[len + 1];
+			memcpy(this->buffer, string, len + 1);
+		}
+
+		char		*buffer;
+		size_t		len;
+};
+
+
+
+
+#endif //__host_arduino_h__
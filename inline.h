@@ -13,6 +13,17 @@
 #endif
 
 
+// C++11 CONSTEXPR FUNCTIONS CAN ONLY BE A SINGLE RETURN, SO ANYTHING THAT
+// CHANGES AN OBJECT IS ONLY CONSTEXPR FROM C++14 ON
+#ifndef CONSTEXPR14
+#if __cplusplus >= 201402L
+#define CONSTEXPR14	constexpr
+#else
+#define CONSTEXPR14
+#endif
+#endif
+
+
 #ifndef nullbyte
 #define nullbyte	(0x00)
 #endif
@@ -0,0 +1,1568 @@
+/*----------------------------------------------------------------------------*\
+| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |
+| SOURCE:  https://github.com/circuitrewind/color                              |
+| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |
++------------------------------------------------------------------------------+
+| HOST CORRECTNESS TESTS, RUN BY CTEST. EVERY BULK FUNCTION WITH A SIMD PATH   |
+| IS CHECKED AGAINST THE SINGLE PIXEL OR SCALAR CODE IT MUST MATCH, OVER       |
+| LENGTHS THAT COVER BOTH THE VECTOR LOOP AND THE TAIL. THE TEXT, FILE, AND    |
+| NETWORK FORMATS ARE CHECKED BY ROUND TRIPS. BUILD WITH -MARCH=NATIVE (THE    |
+| DEFAULT) TO TEST THE SIMD PATHS AGAINST THE SCALAR ONES.                     |
+\*----------------------------------------------------------------------------*/
+
+
+
+
+#include <Arduino.h>
+#include <math.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <vector>
+#include "color.h"
+#include "color_span.h"
+#include "color_ws2812.h"
+#include "color_dither.h"
+#include "color_power.h"
+#include "color_order.h"
+#include "color_packed.h"
+#include "color_indexed.h"
+#include "color_hex.h"
+#include "color_anim.h"
+#include "color_net.h"
+#include "color_compositor.h"
+#include "color16.h"
+#include "color_render.h"
+#include "color_gamma.h"
+#include "color_nearest.h"
+#include "color_pacer.h"
+#include "color_matrix.h"
+#include "color_quantize.h"
+
+
+
+
+#define MAX_PIXELS	1000
+#define MAX_PLANE	((MAX_PIXELS * 3 + 1) / 2)
+
+
+
+
+static unsigned	failures	= 0;
+static unsigned	checks		= 0;
+static uint32_t	seed		= 1;
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// REPORT A FAILED CHECK, WITH THE CASE AND THE LENGTH IT FAILED AT
+////////////////////////////////////////////////////////////////////////////////
+static void check(bool ok, const char *name, size_t count) {
+	checks++;
+	if (ok) return;
+	if (failures++ < 20) printf("FAIL %s (count %zu)\n", name, count);
+}
+
+
+
+static bool same(const void *a, const void *b, size_t bytes) {
+	return !memcmp(a, b, bytes);
+}
+
+
+
+static uint8_t random8() {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return (uint8_t)(seed >> 8);
+}
+
+
+
+static void randomize(void *data, size_t bytes) {
+	for (size_t i=0; i<bytes; i++) ((uint8_t*)data)[i] = random8();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EVERY LENGTH UP TO 100 PIXELS, THEN A FEW LONGER ONES
+////////////////////////////////////////////////////////////////////////////////
+static const size_t lengths[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+	21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+	40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+	59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+	78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 255, 256, 257, 511, 768, 999, MAX_PIXELS,
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SPANS: EACH BULK BLEND AGAINST THE COLOR_T MEMBER IT MIRRORS
+////////////////////////////////////////////////////////////////////////////////
+template <class BULK_SPAN, class BULK_VALUE, class SINGLE>
+static void test_span_op(const char *name, BULK_SPAN bulk_span, BULK_VALUE bulk_value, SINGLE single) {
+	static color_t a[MAX_PIXELS], b[MAX_PIXELS], got[MAX_PIXELS], want[MAX_PIXELS];
+
+	for (const size_t count : lengths) {
+		randomize(a, sizeof(a));
+		randomize(b, sizeof(b));
+
+		memcpy((void*)got, (const void*)a, sizeof(a));
+		bulk_span(got, b, count);
+		for (size_t i=0; i<count; i++) {
+			want[i] = a[i];
+			single(want[i], b[i]);
+		}
+		check(same(got, want, count * sizeof(color_t)), name, count);
+
+		memcpy((void*)got, (const void*)a, sizeof(a));
+		bulk_value(got, b[0], count);
+		for (size_t i=0; i<count; i++) {
+			want[i] = a[i];
+			single(want[i], b[0]);
+		}
+		check(same(got, want, count * sizeof(color_t)), name, count);
+	}
+}
+
+
+
+static void test_span() {
+	#define SPAN_CASE(NAME)																\
+		test_span_op("span/" #NAME,														\
+			[](color_t *d, const color_t *s, size_t n) { color_span_##NAME(d, s, n); },	\
+			[](color_t *d, const color_t v, size_t n) { color_span_##NAME(d, v, n); },	\
+			[](color_t &d, const color_t s) { d.NAME(s); })
+
+	SPAN_CASE(add);
+	SPAN_CASE(sub);
+	SPAN_CASE(min);
+	SPAN_CASE(max);
+	SPAN_CASE(screen);
+	SPAN_CASE(multiply);
+
+	#undef SPAN_CASE
+
+	static color_t a[MAX_PIXELS], b[MAX_PIXELS], got[MAX_PIXELS], want[MAX_PIXELS];
+	static uint8_t mask[MAX_PIXELS];
+
+	for (const size_t count : lengths) {
+		randomize(a, sizeof(a));
+		randomize(b, sizeof(b));
+		randomize(mask, sizeof(mask));
+
+		const uint8_t alpha = random8();
+		color_span_blend(got, a, b, alpha, count);
+		for (size_t i=0; i<count; i++) want[i] = color_t::lerp(a[i], b[i], alpha);
+		check(same(got, want, count * sizeof(color_t)), "span/blend", count);
+
+		color_span_blend_mask(got, a, b, mask, count);
+		for (size_t i=0; i<count; i++) want[i] = color_t::lerp(a[i], b[i], mask[i]);
+		check(same(got, want, count * sizeof(color_t)), "span/blend_mask", count);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// WS2812: THE SELECTED ENCODERS AGAINST THE PORTABLE ONES
+////////////////////////////////////////////////////////////////////////////////
+static void test_ws2812() {
+	static color_t pixels[MAX_PIXELS];
+	static uint8_t got[MAX_PIXELS * 12 + 64], want[MAX_PIXELS * 12 + 64];
+
+	for (const size_t count : lengths) {
+		randomize(pixels, sizeof(pixels));
+		const size_t bytes = count * sizeof(color_t);
+
+		const size_t size3 = color_ws2812_encode3(pixels, count, got, 7);
+		uint8_t *end = color_ws2812_encode3_scalar((const uint8_t*)pixels, bytes, want);
+		memset(end, 0, 7);
+		check(size3 == color_ws2812_size3(count, 7)  &&  same(got, want, size3), "ws2812/encode3", count);
+
+		const size_t size4 = color_ws2812_encode4(pixels, count, got, 7);
+		end = color_ws2812_encode4_scalar((const uint8_t*)pixels, bytes, want);
+		memset(end, 0, 7);
+		check(size4 == color_ws2812_size4(count, 7)  &&  same(got, want, size4), "ws2812/encode4", count);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DITHER: SEVERAL FRAMES AGAINST THE 8.8 FIXED POINT RULE, CARRYING THE
+// RESIDUAL NIBBLES ALONG, AND THE STREAMING ENCODER AGAINST APPLY + ENCODE
+////////////////////////////////////////////////////////////////////////////////
+static void test_dither() {
+	static color_t	source[MAX_PIXELS], got[MAX_PIXELS];
+	static uint8_t	plane[MAX_PLANE * 2], carry[MAX_PIXELS * 3];
+	static uint8_t	stream[MAX_PIXELS * 12 + 64], want[MAX_PIXELS * 12 + 64];
+
+	for (const size_t count : lengths) {
+		color_dither_t	dither(plane, count);
+		const color_t	white(random8(), random8(), random8());
+		const uint8_t	level = random8();
+
+		dither.brightness(level);
+		dither.balance(white);
+
+		const uint16_t scale[3] = {
+			(uint16_t)(((level + 1) * (white.g + 1)) >> 8),
+			(uint16_t)(((level + 1) * (white.r + 1)) >> 8),
+			(uint16_t)(((level + 1) * (white.b + 1)) >> 8),
+		};
+
+		memset(carry, 0, sizeof(carry));
+		randomize(source, sizeof(source));
+
+		bool ok = true;
+		for (uint8_t frame=0; frame<4; frame++) {
+			dither.apply(source, got);
+
+			const uint8_t *in = (const uint8_t*)source;
+			const uint8_t *out = (const uint8_t*)got;
+			for (size_t i=0; i<count*3; i++) {
+				const uint16_t sum = in[i] * scale[i % 3] + (carry[i] << 4);
+				ok = ok  &&  out[i] == (sum >> 8);
+				carry[i] = (sum >> 4) & 0x0f;
+			}
+		}
+		check(ok, "dither/apply", count);
+
+		// SAME RESIDUALS ON BOTH SIDES, SO THE OUTPUT MUST MATCH EXACTLY
+		color_dither_t copy(plane + MAX_PLANE, count);
+		memcpy(plane + MAX_PLANE, plane, color_dither_plane_size(count));
+		copy.brightness(level);
+		copy.balance(white);
+
+		const size_t size = dither.encode3(source, stream, 3);
+		copy.apply(source, got);
+		color_ws2812_encode3(got, count, want, 3);
+		check(size == color_ws2812_size3(count, 3)  &&  same(stream, want, size), "dither/encode3", count);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// POWER: CHANNEL SUMS AND SCALING AGAINST A PLAIN LOOP
+////////////////////////////////////////////////////////////////////////////////
+static void test_power() {
+	static color_t pixels[MAX_PIXELS], want[MAX_PIXELS];
+
+	for (const size_t count : lengths) {
+		randomize(pixels, sizeof(pixels));
+
+		uint32_t g = 0, r = 0, b = 0;
+		for (size_t i=0; i<count; i++) {
+			g += pixels[i].g;
+			r += pixels[i].r;
+			b += pixels[i].b;
+		}
+
+		color_power_sum_t sum = color_power_sum(pixels, count);
+		check(sum.g == g  &&  sum.r == r  &&  sum.b == b, "power/sum", count);
+
+		const uint8_t scale = random8();
+		g = r = b = 0;
+		for (size_t i=0; i<count; i++) {
+			want[i] = color_t(
+				(pixels[i].r * scale) >> 8,
+				(pixels[i].g * scale) >> 8,
+				(pixels[i].b * scale) >> 8
+			);
+			g += want[i].g;
+			r += want[i].r;
+			b += want[i].b;
+		}
+
+		sum = color_power_scale(pixels, count, scale);
+		check(sum.g == g  &&  sum.r == r  &&  sum.b == b, "power/scale_sum", count);
+		check(same(pixels, want, count * sizeof(color_t)), "power/scale", count);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ORDER: BULK CONVERSION AGAINST THE PER PIXEL CONSTRUCTORS, BOTH WAYS
+////////////////////////////////////////////////////////////////////////////////
+template <class FROM, class TO>
+static void test_order_pair(const char *name) {
+	static FROM	src[MAX_PIXELS];
+	static TO	got[MAX_PIXELS], want[MAX_PIXELS];
+
+	for (const size_t count : lengths) {
+		randomize(src, sizeof(src));
+		randomize(got, sizeof(got));
+		memcpy((void*)want, (const void*)got, sizeof(got));
+
+		color_order_convert(src, got, count);
+		for (size_t i=0; i<count; i++) want[i] = TO(src[i]);
+		check(same(got, want, sizeof(got)), name, count);
+	}
+}
+
+
+
+static void test_order() {
+	test_order_pair<color_t, color_rgb_t>("order/grb_to_rgb");
+	test_order_pair<color_rgb_t, color_t>("order/rgb_to_grb");
+	test_order_pair<color_t, color_brg_t>("order/grb_to_brg");
+	test_order_pair<color_t, color_rgbw_t>("order/grb_to_rgbw");
+	test_order_pair<color_rgbw_t, color_t>("order/rgbw_to_grb");
+	test_order_pair<color_grbw_t, color_rgb_t>("order/grbw_to_rgb");
+	test_order_pair<color_rgbw_t, color_grbw_t>("order/rgbw_to_grbw");
+
+	// THE TEMPLATE BLENDS MUST MATCH COLOR_T, INCLUDING AT 255 * 255
+	for (size_t i=0; i<MAX_PIXELS; i++) {
+		color_t a, b;
+		randomize(&a, sizeof(a));
+		randomize(&b, sizeof(b));
+		if (i == 0) a = b = color_t(255, 255, 255);
+
+		color_t want_screen = a, want_multiply = a;
+		want_screen.screen(b);
+		want_multiply.multiply(b);
+
+		color_rgb_t got_screen(a), got_multiply(a);
+		got_screen.screen(color_rgb_t(b));
+		got_multiply.multiply(color_rgb_t(b));
+
+		const color_t screen(got_screen), multiply(got_multiply);
+		check(same(&screen, &want_screen, sizeof(color_t)), "order/screen", i);
+		check(same(&multiply, &want_multiply, sizeof(color_t)), "order/multiply", i);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PACKED: BULK EXPANSION AGAINST COLOR_UNPACK, AND PACK / EXPAND ROUND TRIPS
+////////////////////////////////////////////////////////////////////////////////
+template <COLOR_PACKED FORMAT>
+static void test_packed_format(const char *name) {
+	static uint16_t	packed[MAX_PIXELS], again[MAX_PIXELS];
+	static color_t	got[MAX_PIXELS], want[MAX_PIXELS];
+
+	for (const size_t count : lengths) {
+		randomize(packed, sizeof(packed));
+		if (FORMAT == COLOR_PACKED_555) {
+			for (size_t i=0; i<count; i++) packed[i] &= 0x7fff;
+		}
+
+		color_expand<FORMAT>(packed, got, count);
+		for (size_t i=0; i<count; i++) want[i] = color_unpack<FORMAT>(packed[i]);
+		check(same(got, want, count * sizeof(color_t)), name, count);
+
+		color_pack<FORMAT>(got, again, count);
+		check(same(packed, again, count * sizeof(uint16_t)), name, count);
+	}
+}
+
+
+
+static void test_packed() {
+	test_packed_format<COLOR_PACKED_555>("packed/555");
+	test_packed_format<COLOR_PACKED_565>("packed/565");
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// INDEXED: EXPANSION AT EVERY OFFSET AGAINST THE PER PIXEL LOOKUP, AND THE
+// BLOCKWISE ENCODER AGAINST EXPAND + ENCODE
+////////////////////////////////////////////////////////////////////////////////
+template <uint8_t BITS>
+static void test_indexed_bits(const char *name) {
+	static uint8_t	indexes[MAX_PIXELS];
+	static color_t	got[MAX_PIXELS], want[MAX_PIXELS], colors[256];
+	static uint8_t	stream[MAX_PIXELS * 12 + 64], expect[MAX_PIXELS * 12 + 64];
+
+	for (const size_t count : lengths) {
+		randomize(indexes, sizeof(indexes));
+		randomize(colors, sizeof(colors));
+
+		color_indexed_strip_t<BITS> strip(indexes, count);
+		strip.load(colors, 1 << BITS);
+
+		for (size_t first=0; first<_min(count, (size_t)3); first++) {
+			const size_t length = strip.expand(got, first, count);
+			for (size_t i=0; i<length; i++) want[i] = strip.color(first + i);
+			check(length == count - first  &&  same(got, want, length * sizeof(color_t)), name, count);
+		}
+
+		strip.expand(got, 0, count);
+		const size_t size = strip.encode3(stream, 5);
+		color_ws2812_encode3(got, count, expect, 5);
+		check(size == color_ws2812_size3(count, 5)  &&  same(stream, expect, size), name, count);
+	}
+}
+
+
+
+static void test_indexed() {
+	test_indexed_bits<4>("indexed/4");
+	test_indexed_bits<8>("indexed/8");
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HEX: FORMAT A FRAME IN EACH STYLE AND PARSE IT BACK
+////////////////////////////////////////////////////////////////////////////////
+static void test_hex() {
+	static color_t	pixels[MAX_PIXELS], back[MAX_PIXELS];
+	static uint8_t	status[MAX_PIXELS];
+	static char		text[MAX_PIXELS * 10 + 1];
+
+	const COLOR_HEX_TYPE types[] = {COLOR_HEX_NORMAL, COLOR_HEX_HTML, COLOR_HEX_LITERAL};
+
+	for (const size_t count : lengths) {
+		for (const COLOR_HEX_TYPE type : types) {
+			randomize(pixels, sizeof(pixels));
+
+			const size_t length = color_t::format_hex_frame(pixels, count, text, type, ',');
+			check(length + 1 <= color_hex_frame_size(count, type), "hex/size", count);
+
+			memset(status, 0xff, sizeof(status));
+			const size_t parsed = color_t::parse_hex_frame(text, length, back, MAX_PIXELS, status);
+
+			bool ok = parsed == count  &&  same(pixels, back, count * sizeof(color_t));
+			for (size_t i=0; i<count; i++) ok = ok  &&  status[i] == COLOR_HEX_OK;
+			check(ok, "hex/round_trip", count);
+		}
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ANIM: A SHORT SHOW WITH STATIC, FADING, AND NOISY PIXELS, ENCODED AND
+// DECODED IN MEMORY, THEN WRITTEN TO A FILE AND READ BACK OUT OF ORDER
+////////////////////////////////////////////////////////////////////////////////
+static void make_frame(color_t *pixels, size_t count, uint32_t frame) {
+	for (size_t i=0; i<count; i++) {
+		if (i < count / 3) {
+			pixels[i] = color_t(10, 20, 30);
+		} else if (i < count * 2 / 3) {
+			pixels[i] = color_t(frame * 3, i, 255 - frame);
+		} else {
+			pixels[i] = color_t(random8(), random8(), random8());
+		}
+	}
+}
+
+
+
+static void test_anim() {
+	const size_t	count	= 300;
+	const uint32_t	frames	= 24;
+
+	std::vector<color_t>	show(count * frames), decoded(count);
+	std::vector<uint8_t>	payload(COLOR_ANIM_BOUND(count, 3));
+
+	for (uint32_t f=0; f<frames; f++) make_frame(&show[f * count], count, f);
+
+	// IN MEMORY, EVERY FRAME AS A DIFF OF THE ONE BEFORE
+	for (uint32_t f=0; f<frames; f++) {
+		const uint8_t *cur	= (const uint8_t*)&show[f * count];
+		const uint8_t *prev	= f ? (const uint8_t*)&show[(f - 1) * count] : nullptr;
+
+		const size_t length = color_anim_encode<3>(cur, prev, count, payload.data());
+		const bool ok = color_anim_decode(payload.data(), length, !f, decoded.data(), count);
+		check(ok  &&  same(decoded.data(), cur, count * sizeof(color_t)), "anim/memory", f);
+	}
+
+	// THROUGH A FILE, WITH A SEEK BACKWARDS AND A PLAY FORWARDS
+	char path[] = "/tmp/color_test_XXXXXX";
+	const int fd = mkstemp(path);
+	check(fd >= 0, "anim/tempfile", 0);
+	if (fd < 0) return;
+	close(fd);
+
+	color_anim_writer_t writer;
+	bool ok = writer.open(path, count, 30, 8);
+	for (uint32_t f=0; f<frames; f++) ok = ok  &&  writer.write(&show[f * count]);
+	ok = writer.close()  &&  ok;
+	check(ok, "anim/write", frames);
+
+	color_anim_reader_t reader;
+	check(reader.open(path)  &&  reader.frames() == frames  &&  reader.pixels() == count, "anim/open", frames);
+
+	const uint32_t order[] = {17, 3, 0, 23, 9, 10, 11, 12};
+	for (const uint32_t f : order) {
+		ok = reader.decode(f, decoded.data());
+		check(ok  &&  same(decoded.data(), &show[f * count], count * sizeof(color_t)), "anim/file", f);
+	}
+
+	reader.close();
+	unlink(path);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NET: A FRAME SENT AS E1.31, ART-NET, AND DDP PACKETS, AND RECEIVED BACK
+////////////////////////////////////////////////////////////////////////////////
+static std::vector<uint8_t> net_e131(uint16_t universe, const uint8_t *data, size_t length) {
+	std::vector<uint8_t> packet(126 + length, 0);
+	uint8_t *p = packet.data();
+	p[1]	= 0x10;
+	memcpy(p + 4, "ASC-E1.17\0\0\0", 12);
+	p[21]	= 0x04;
+	p[43]	= 0x02;
+	p[113]	= universe >> 8;
+	p[114]	= universe;
+	p[117]	= 0x02;
+	p[118]	= 0xa1;
+	p[123]	= (length + 1) >> 8;
+	p[124]	= (length + 1);
+	memcpy(p + 126, data, length);
+	return packet;
+}
+
+
+
+static std::vector<uint8_t> net_artnet(uint16_t port, const uint8_t *data, size_t length) {
+	std::vector<uint8_t> packet(18 + length, 0);
+	uint8_t *p = packet.data();
+	memcpy(p, "Art-Net", 8);
+	p[9]	= 0x50;
+	p[11]	= 14;
+	p[14]	= port;
+	p[15]	= port >> 8;
+	p[16]	= length >> 8;
+	p[17]	= length;
+	memcpy(p + 18, data, length);
+	return packet;
+}
+
+
+
+static std::vector<uint8_t> net_ddp(uint32_t offset, bool push, const uint8_t *data, size_t length) {
+	std::vector<uint8_t> packet(10 + length, 0);
+	uint8_t *p = packet.data();
+	p[0]	= 0x40 | (push ? 0x01 : 0x00);
+	p[2]	= 0x0b;
+	p[3]	= 0x01;
+	p[4]	= offset >> 24;
+	p[5]	= offset >> 16;
+	p[6]	= offset >> 8;
+	p[7]	= offset;
+	p[8]	= length >> 8;
+	p[9]	= length;
+	memcpy(p + 10, data, length);
+	return packet;
+}
+
+
+
+static void test_net() {
+	const size_t	count		= 500;
+	const size_t	channels	= 510;
+	const size_t	bytes		= count * 3;
+
+	std::vector<uint8_t>	wire(bytes);
+	std::vector<color_t>	want(count), got(count);
+
+	randomize(wire.data(), bytes);
+	for (size_t i=0; i<count; i++) want[i] = color_t(wire[i * 3], wire[i * 3 + 1], wire[i * 3 + 2]);
+
+	for (uint8_t protocol=0; protocol<3; protocol++) {
+		memset((void*)got.data(), 0, count * sizeof(color_t));
+		color_net_receiver_t receiver(got.data(), count, 1, channels);
+
+		std::vector<std::vector<uint8_t>> packets;
+		if (protocol == 2) {
+			for (size_t offset=0; offset<bytes; offset+=1000) {
+				const size_t length = _min((size_t)1000, bytes - offset);
+				packets.push_back(net_ddp(offset, offset + length == bytes, &wire[offset], length));
+			}
+		} else {
+			for (size_t u=0; u*channels<bytes; u++) {
+				const size_t length = _min(channels, bytes - u * channels);
+				packets.push_back(protocol == 0
+					? net_e131(u + 1, &wire[u * channels], length)
+					: net_artnet(u, &wire[u * channels], length)
+				);
+			}
+		}
+
+		for (const std::vector<uint8_t> &packet : packets) {
+			receiver.ingest(packet.data(), packet.size());
+		}
+
+		const char *name = protocol == 0 ? "net/e131" : protocol == 1 ? "net/artnet" : "net/ddp";
+		check(receiver.ready()  &&  receiver.stats().packets == packets.size(), name, count);
+		check(same(got.data(), want.data(), count * sizeof(color_t)), name, count);
+	}
+
+	// E1.31 SEQUENCE 0 IS A REAL NUMBER, SO A REPEAT OF IT IS STALE. ART-NET
+	// SEQUENCE 0 MEANS UNNUMBERED, SO A REPEAT OF IT IS NOT
+	for (uint8_t protocol=0; protocol<2; protocol++) {
+		color_net_receiver_t receiver(got.data(), count, 1, channels);
+
+		const std::vector<uint8_t> packet = protocol == 0
+			? net_e131(1, wire.data(), channels)
+			: net_artnet(0, wire.data(), channels);
+
+		receiver.ingest(packet.data(), packet.size());
+		receiver.ingest(packet.data(), packet.size());
+
+		const char *name = protocol == 0 ? "net/e131_seq0" : "net/artnet_seq0";
+		check(receiver.stats().stale == (protocol == 0 ? 1u : 0u), name, count);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HSV: A HUE SWEEP MUST MATCH FROM_HSV() FOR EVERY PIXEL, SWEEPING FORWARDS,
+// BACKWARDS, AND STANDING STILL, INCLUDING STEPS THAT CROSS SECTORS AND WRAP
+////////////////////////////////////////////////////////////////////////////////
+static void test_hsv() {
+	static color_t got[MAX_PIXELS], want[MAX_PIXELS];
+
+	const int16_t steps[] = {0, 1, -1, 7, -7, 255, -256, 4096, -4097, 32767, -32768};
+
+	for (const size_t count : lengths) {
+		for (const int16_t step : steps) {
+			const uint16_t	hue	= random8() << 8 | random8();
+			const uint8_t	sat	= random8();
+			const uint8_t	val	= random8();
+
+			color_hsv_fill(got, count, hue, step, sat, val);
+			for (size_t i=0; i<count; i++) {
+				want[i] = color_t::from_hsv((uint16_t)(hue + step * i), sat, val);
+			}
+			check(same(got, want, count * sizeof(color_t)), "hsv/fill", count);
+		}
+	}
+
+	// KNOWN VALUES, INCLUDING FULLY SATURATED COLORS WHERE MAX - MIN > 128.
+	// HSL LIGHTNESS 128 IS HALF A STEP ABOVE THE MIDDLE, SO THE FLOOR OF A
+	// SATURATED COLOR COMES BACK FROM FROM_HSL() AS 1 INSTEAD OF 0
+	struct { color_t color; uint16_t h; uint8_t s, v, l, hsl_s; } known[] = {
+		{color_t(  0,   0,   0),		0,		0,		0,		0,		0},
+		{color_t(255, 255, 255),		0,		0,		255,	255,	0},
+		{color_t(128, 128, 128),		0,		0,		128,	128,	0},
+		{color_t(255,   0,   0),		0,		255,	255,	128,	255},
+		{color_t(  0, 255,   0),		21845,	255,	255,	128,	255},
+		{color_t(  0,   0, 255),		43691,	255,	255,	128,	255},
+		{color_t(200,   0,   0),		0,		255,	200,	100,	255},
+		{color_t(255, 255,   0),		10923,	255,	255,	128,	255},
+		{color_t(255,  55,   0),		2356,	255,	255,	128,	255},
+	};
+
+	for (const auto &k : known) {
+		const color_hsv_t hsv = k.color.to_hsv();
+		const color_hsl_t hsl = k.color.to_hsl();
+		check(hsv.h == k.h  &&  hsv.s == k.s  &&  hsv.v == k.v, "hsv/to_hsv", k.color.r);
+		check(hsl.h == k.h  &&  hsl.s == k.hsl_s  &&  hsl.l == k.l, "hsv/to_hsl", k.color.r);
+		const color_t from_hsv = color_t::from_hsv(k.h, k.s, k.v);
+		const color_t from_hsl = color_t::from_hsl(k.h, k.hsl_s, k.l);
+		check(same(&from_hsv, &k.color, sizeof(color_t)), "hsv/from_hsv", k.color.r);
+		check(abs(from_hsl.r - k.color.r) <= 1  &&  abs(from_hsl.g - k.color.g) <= 1  &&  abs(from_hsl.b - k.color.b) <= 1, "hsv/from_hsl", k.color.r);
+	}
+
+	// ROUND TRIPS OVER A GRID OF THE RGB CUBE. THE FIXED POINT HUE LOSES A
+	// LITTLE, SO HSV MAY BE OFF BY ONE STEP AND HSL BY TWO
+	for (uint16_t r=0; r<256; r+=15) {
+		for (uint16_t g=0; g<256; g+=15) {
+			for (uint16_t b=0; b<256; b+=15) {
+				const color_t color(r, g, b);
+				const color_hsv_t hsv = color.to_hsv();
+				const color_hsl_t hsl = color.to_hsl();
+				const color_t v = color_t::from_hsv(hsv.h, hsv.s, hsv.v);
+				const color_t l = color_t::from_hsl(hsl.h, hsl.s, hsl.l);
+
+				check(abs(v.r - color.r) <= 1  &&  abs(v.g - color.g) <= 1  &&  abs(v.b - color.b) <= 1, "hsv/round_trip", r);
+				check(abs(l.r - color.r) <= 2  &&  abs(l.g - color.g) <= 2  &&  abs(l.b - color.b) <= 2, "hsl/round_trip", r);
+			}
+		}
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPOSITOR: AN OPTIONAL LAYER SKIPPED FOR TIME IN ONE FRAME MUST STILL SHOW
+// UP IN THE NEXT FRAME THAT HAS THE BUDGET FOR IT
+////////////////////////////////////////////////////////////////////////////////
+static void test_compositor() {
+	const size_t count = 300;
+
+	static color_t base[count], over[count], output[count], want[count];
+	randomize(base, sizeof(base));
+	randomize(over, sizeof(over));
+
+	color_strip_t		strip(output, count);
+	color_compositor_t	compositor(strip);
+	compositor.push(base);
+	color_layer_t *layer = compositor.push(over, COLOR_BLEND_ADD, 255, true);
+
+	// FIRST FRAME: TOO EXPENSIVE TO FIT IN THE BUDGET
+	layer->cost = 0xffffffff;
+	compositor.render(1);
+	check(layer->skipped == 1  &&  same(output, base, sizeof(base)), "compositor/skip", count);
+
+	// SECOND FRAME: NOTHING ELSE CHANGED, BUT THE SKIPPED LAYER IS OWED
+	compositor.render();
+	for (size_t i=0; i<count; i++) {
+		want[i] = base[i];
+		want[i].add(over[i]);
+	}
+	check(layer->frames == 1  &&  same(output, want, sizeof(want)), "compositor/catch_up", count);
+
+	// THIRD FRAME: NOTHING LEFT TO DO
+	check(!compositor.render()  &&  layer->frames == 1, "compositor/clean", count);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// COLOR16: EXACT ROUNDING OF THE SCALAR HELPERS, EACH SPAN AGAINST THE
+// COLOR16_T MEMBER IT MIRRORS, AND THE WIDENING AND NARROWING BUFFERS
+////////////////////////////////////////////////////////////////////////////////
+template <class BULK_SPAN, class BULK_VALUE, class SINGLE>
+static void test_color16_op(const char *name, BULK_SPAN bulk_span, BULK_VALUE bulk_value, SINGLE single) {
+	static color16_t a[MAX_PIXELS], b[MAX_PIXELS], got[MAX_PIXELS], want[MAX_PIXELS];
+
+	for (const size_t count : lengths) {
+		randomize(a, sizeof(a));
+		randomize(b, sizeof(b));
+
+		memcpy((void*)got, (const void*)a, sizeof(a));
+		bulk_span(got, b, count);
+		for (size_t i=0; i<count; i++) {
+			want[i] = a[i];
+			single(want[i], b[i]);
+		}
+		check(same(got, want, count * sizeof(color16_t)), name, count);
+
+		memcpy((void*)got, (const void*)a, sizeof(a));
+		bulk_value(got, b[0], count);
+		for (size_t i=0; i<count; i++) {
+			want[i] = a[i];
+			single(want[i], b[0]);
+		}
+		check(same(got, want, count * sizeof(color16_t)), name, count);
+	}
+}
+
+
+
+static void test_color16() {
+	static color_t		narrow[MAX_PIXELS], want8[MAX_PIXELS];
+	static color16_t	wide[MAX_PIXELS], want16[MAX_PIXELS];
+
+	// EVERY 16 BIT VALUE NARROWS TO THE NEAREST 8 BIT ONE, AND WIDENS BACK
+	bool ok = true;
+	for (uint32_t v=0; v<65536; v++) {
+		ok = ok  &&  color16_narrow(v) == (v * 255 + 32767) / 65535;
+	}
+	for (uint16_t v=0; v<256; v++) {
+		ok = ok  &&  color16_t(color_t(v, v, v)).r == v * 257  &&  color16_narrow(v * 257) == v;
+	}
+	check(ok, "color16/narrow", 65536);
+
+	// A * B / 65535 ROUNDED TO NEAREST
+	ok = true;
+	for (size_t i=0; i<100000; i++) {
+		const uint16_t a = random8() << 8 | random8();
+		const uint16_t b = random8() << 8 | random8();
+		ok = ok  &&  color16_mul(a, b) == ((uint64_t)a * b + 32767) / 65535;
+	}
+	ok = ok  &&  color16_mul(65535, 65535) == 65535  &&  color16_mul(65535, 0) == 0;
+	check(ok, "color16/mul", 100000);
+
+	#define COLOR16_CASE(NAME)																	\
+		test_color16_op("color16/" #NAME,														\
+			[](color16_t *d, const color16_t *s, size_t n) { color16_span_##NAME(d, s, n); },	\
+			[](color16_t *d, const color16_t v, size_t n) { color16_span_##NAME(d, v, n); },	\
+			[](color16_t &d, const color16_t s) { d.NAME(s); })
+
+	COLOR16_CASE(add);
+	COLOR16_CASE(sub);
+	COLOR16_CASE(min);
+	COLOR16_CASE(max);
+	COLOR16_CASE(screen);
+	COLOR16_CASE(multiply);
+
+	#undef COLOR16_CASE
+
+	for (const size_t count : lengths) {
+		randomize(narrow, sizeof(narrow));
+		color16_expand(narrow, wide, count);
+		for (size_t i=0; i<count; i++) want16[i] = color16_t(narrow[i]);
+		check(same(wide, want16, count * sizeof(color16_t)), "color16/expand", count);
+
+		randomize(wide, sizeof(wide));
+		color16_reduce(wide, narrow, count);
+		for (size_t i=0; i<count; i++) want8[i] = (color_t)wide[i];
+		check(same(narrow, want8, count * sizeof(color_t)), "color16/reduce", count);
+
+		// DITHERING ONLY EVER PICKS ONE OF THE TWO NEAREST LEVELS
+		color16_dither(wide, narrow, count, (uint8_t)count);
+		ok = true;
+		for (size_t i=0; i<count; i++) {
+			const uint8_t *in = (const uint8_t*)&narrow[i];
+			const uint16_t *exact = (const uint16_t*)&wide[i];
+			for (uint8_t c=0; c<3; c++) {
+				const uint32_t scaled = ((uint32_t)exact[c] * 65281) >> 16;
+				ok = ok  &&  (in[c] == scaled >> 8  ||  in[c] == (scaled >> 8) + 1);
+			}
+		}
+		check(ok, "color16/dither", count);
+	}
+
+	// A FLAT 16 BIT LEVEL BETWEEN TWO 8 BIT ONES DITHERS TO THE RIGHT AVERAGE
+	for (uint16_t level=0; level<65535-257; level+=997) {
+		for (size_t i=0; i<MAX_PIXELS; i++) wide[i] = color16_t(level, level, level);
+		color16_dither(wide, narrow, 16 * 48);
+
+		uint32_t total = 0;
+		for (size_t i=0; i<16 * 48; i++) total += narrow[i].g;
+
+		const double want = (double)(((uint32_t)level * 65281) >> 16) / 256;
+		check(fabs((double)total / (16 * 48) - want) <= 1.0 / 16, "color16/dither_mean", level);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RENDER: SEVERAL THREADS AND TINY TILES, SO THE QUEUES ARE POPPED AND STOLEN
+// FROM CONSTANTLY. EVERY PIXEL MUST BE WRITTEN EXACTLY ONCE PER FRAME, BY A
+// SPAN WITH THE RIGHT STRIP, OFFSET, AND FRAME, BEFORE RENDER() RETURNS
+////////////////////////////////////////////////////////////////////////////////
+static void test_render() {
+	const size_t	strips	= 5;
+	const size_t	length	= 997;
+	const uint32_t	frames	= 50;
+
+	static color_t				pixels[strips][length];
+	static std::atomic<uint32_t>	writes[strips][length];
+	std::atomic<bool>			bad(false);
+
+	color_t			stored[length];
+	color_strip_t	strip(stored, length);
+
+	for (unsigned threads : {1u, 2u, 3u, 8u}) {
+		color_render_t render(threads, 7);
+		memset((void*)pixels, 0, sizeof(pixels));
+		for (size_t s=0; s<strips; s++) {
+			for (size_t i=0; i<length; i++) writes[s][i] = 0;
+		}
+
+		uint32_t expected = 0;
+		for (size_t s=0; s<strips; s++) {
+			const size_t count = (s == strips - 1) ? length : length - s * 100;
+			auto effect = [&, s](const color_render_span_t &span) {
+				color_t *base = (s == strips - 1) ? stored : pixels[s];
+				if (span.strip != s  ||  span.frame != expected  ||  span.thread >= threads
+				||  span.pixels != base + span.offset  ||  !span.count  ||  span.count > 7
+				||  span.offset + span.count > count) {
+					bad = true;
+					return;
+				}
+				for (size_t i=0; i<span.count; i++) {
+					span.pixels[i] = color_t((uint8_t)s, (uint8_t)(span.offset + i), (uint8_t)span.frame);
+					writes[s][span.offset + i]++;
+				}
+			};
+
+			if (s == strips - 1) {
+				strip.clean();
+				render.add(strip, effect);
+			} else {
+				render.add(pixels[s], count, effect);
+			}
+		}
+
+		for (uint32_t frame=0; frame<frames; frame++) {
+			expected = frame;
+			render.render(frame);
+
+			bool ok = !bad;
+			for (size_t s=0; s<strips; s++) {
+				const size_t	count	= (s == strips - 1) ? length : length - s * 100;
+				const color_t	*base	= (s == strips - 1) ? stored : pixels[s];
+				for (size_t i=0; i<count; i++) {
+					const color_t want((uint8_t)s, (uint8_t)i, (uint8_t)frame);
+					ok = ok  &&  same(&base[i], &want, sizeof(color_t))  &&  writes[s][i] == frame + 1;
+				}
+			}
+			check(ok, "render/once", threads);
+		}
+
+		check(strip.dirty(), "render/dirty", threads);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// GAMMA: THE COMPILE TIME TABLES AGAINST POW(), AND THE CORRECTION STAGE
+// AGAINST THE TABLE TIMES THE BRIGHTNESS AND WHITE BALANCE SCALE
+////////////////////////////////////////////////////////////////////////////////
+template <uint16_t GAMMA>
+static void test_gamma_table(const char *name) {
+	bool ok = true;
+	for (uint16_t i=0; i<256; i++) {
+		const double want = 255.0 * pow(i / 255.0, GAMMA / 100.0) + 0.5;
+		ok = ok  &&  color_gamma<GAMMA>::table[i] == (uint8_t)want;
+	}
+	check(ok, name, 256);
+}
+
+
+
+static void test_gamma() {
+	static color_t src[MAX_PIXELS], got[MAX_PIXELS], want[MAX_PIXELS];
+
+	test_gamma_table<100>("gamma/100");
+	test_gamma_table<180>("gamma/180");
+	test_gamma_table<220>("gamma/220");
+	test_gamma_table<280>("gamma/280");
+
+	static_assert(color_gamma_value(0, 220) == 0, "gamma of black");
+	static_assert(color_gamma_value(255, 220) == 255, "gamma of white");
+
+	color_correction_t correction;
+
+	const struct { uint8_t level; color_t white; } settings[] = {
+		{255, color_t(255, 255, 255)},
+		{128, color_t(255, 255, 255)},
+		{255, color_t(255, 200, 160)},
+		{  0, color_t(255, 255, 255)},
+		{ 37, color_t( 90, 255,  10)},
+	};
+
+	for (const auto &setting : settings) {
+		correction.brightness(setting.level);
+		correction.balance(setting.white);
+
+		const uint8_t *table = color_gamma<220>::table;
+		const uint16_t scale_r = color_t::scale256(setting.level, setting.white.r);
+		const uint16_t scale_g = color_t::scale256(setting.level, setting.white.g);
+		const uint16_t scale_b = color_t::scale256(setting.level, setting.white.b);
+
+		for (const size_t count : lengths) {
+			randomize(src, sizeof(src));
+			if (count) src[0] = color_t(255, 255, 255);
+
+			correction.apply(src, got, count);
+			for (size_t i=0; i<count; i++) {
+				want[i].r = (table[src[i].r] * scale_r) >> 8;
+				want[i].g = (table[src[i].g] * scale_g) >> 8;
+				want[i].b = (table[src[i].b] * scale_b) >> 8;
+			}
+			check(same(got, want, count * sizeof(color_t)), "gamma/apply", count);
+
+			// FULL BRIGHTNESS AND WHITE IS EXACTLY THE TABLE
+			if (count  &&  setting.level == 255  &&  setting.white.b == 255) {
+				check(got[0].r == 255  &&  got[0].g == 255  &&  got[0].b == 255, "gamma/unity", count);
+			}
+		}
+
+		const color_t one = correction.apply(src[0]);
+		check(same(&one, &want[0], sizeof(color_t)), "gamma/single", 1);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NAMES: EVERY NAME IN THE TABLE FINDS ITS OWN SLOT IN ANY CASE, AND NAMES
+// THAT ARE NOT IN IT ARE TURNED AWAY
+////////////////////////////////////////////////////////////////////////////////
+static void test_names() {
+	bool ok = true;
+	char upper[COLOR_NAMES_LONGEST + 1];
+
+	for (uint16_t slot=0; slot<COLOR_NAMES_COUNT; slot++) {
+		const char *name = color_names_text + color_names_offset[slot];
+		ok = ok  &&  color_names_find(name) == slot;
+
+		size_t i = 0;
+		for (; name[i]; i++) upper[i] = (char)toupper(name[i]);
+		upper[i] = 0;
+
+		color_t color;
+		ok = ok  &&  color_t::from_name(upper, color);
+		ok = ok  &&  same(&color, &color_names_colors[slot], sizeof(color_t));
+	}
+	check(ok, "names/every", COLOR_NAMES_COUNT);
+
+	const color_t	alice	= color_t::from_name("AliceBlue");
+	const color_t	want	= color_t::aliceblue();
+	const color_t	tomato	= color_t::from_name("tomato");
+	const color_t	want2	= color_t::tomato();
+	check(same(&alice, &want, sizeof(color_t))  &&  same(&tomato, &want2, sizeof(color_t)), "names/known", 2);
+
+	const char *missing[] = {"", "alice", "aliceblu", "aliceblue ", "notacolor", "antiquewhite5", "lightgoldenrodyellowx", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"};
+	color_t unused;
+	ok = !color_t::from_name(nullptr, unused);
+	for (const char *name : missing) {
+		color_t color(1, 2, 3);
+		ok = ok  &&  !color_t::from_name(name, color)  &&  color.r == 1  &&  color.g == 2  &&  color.b == 3;
+	}
+	check(ok, "names/missing", sizeof(missing) / sizeof(missing[0]));
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NEAREST: THE K-D TREE SEARCH AGAINST A BRUTE FORCE SCAN OF EVERY NAME, FOR
+// EVERY METRIC, AND THE BULK QUANTIZERS AGAINST THE SINGLE LOOKUPS
+////////////////////////////////////////////////////////////////////////////////
+static void test_nearest() {
+	static color_t	pixels[MAX_PIXELS], got[MAX_PIXELS];
+	static uint16_t	wide[MAX_PIXELS];
+	static uint8_t	narrow[MAX_PIXELS];
+
+	const color_t black, red(255, 0, 0);
+	check(color_distance(black, red) == 65025  &&  color_distance(red, black, COLOR_METRIC_PERCEPTUAL) == 3 * 65025, "nearest/distance", 0);
+
+	const COLOR_METRIC metrics[] = {COLOR_METRIC_RGB, COLOR_METRIC_PERCEPTUAL, COLOR_METRIC_REDMEAN};
+	for (const COLOR_METRIC metric : metrics) {
+		bool ok = true;
+		for (size_t i=0; i<2000; i++) {
+			color_t color;
+			randomize(&color, sizeof(color));
+			if (i < COLOR_NAMES_COUNT) color = color_names_color(i);
+
+			uint32_t best = 0xffffffff;
+			for (uint16_t slot=0; slot<COLOR_NAMES_COUNT; slot++) {
+				best = _min(best, color_distance(color, color_names_color(slot), metric));
+			}
+
+			const uint16_t found = color_nearest_name(color, metric);
+			ok = ok  &&  color_distance(color, color_names_color(found), metric) == best;
+			if (i < COLOR_NAMES_COUNT) ok = ok  &&  best == 0;
+		}
+		check(ok, "nearest/kd_tree", metric);
+
+		// BULK QUANTIZERS, WITH REPEATS SO THE CACHE IS HIT
+		for (size_t i=0; i<MAX_PIXELS; i++) {
+			if (i % 3) {
+				randomize(&pixels[i], sizeof(color_t));
+			} else {
+				pixels[i] = pixels[i / 2];
+			}
+		}
+
+		memcpy((void*)got, (const void*)pixels, sizeof(pixels));
+		color_nearest_quantize(got, MAX_PIXELS, metric);
+		color_nearest_quantize(pixels, MAX_PIXELS, wide, color_names_colors, COLOR_NAMES_COUNT, metric);
+		color_nearest_quantize(pixels, MAX_PIXELS, narrow, color_names_colors, COLOR_NAMES_COUNT, metric);
+
+		ok = true;
+		for (size_t i=0; i<MAX_PIXELS; i++) {
+			const color_t want = color_names_color(color_nearest_name(pixels[i], metric));
+			ok = ok  &&  color_distance(pixels[i], got[i], metric) == color_distance(pixels[i], want, metric);
+			ok = ok  &&  wide[i] == color_nearest(color_names_colors, COLOR_NAMES_COUNT, pixels[i], metric);
+			ok = ok  &&  narrow[i] == color_nearest(color_names_colors, 256, pixels[i], metric);
+		}
+		check(ok, "nearest/quantize", metric);
+	}
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PALETTES: THE TABLES AGAINST THE COLORS THEY STAND FOR, AND THE BULK AND
+// BLENDED LOOKUPS AGAINST SINGLE ENTRIES, FOR BOTH PROGMEM AND RAM PALETTES
+////////////////////////////////////////////////////////////////////////////////
+static bool same_color(const color_t a, const color_t b) {
+	return a.r == b.r  &&  a.g == b.g  &&  a.b == b.b;
+}
+
+
+
+static color_t palette_mix(const color_t from, const color_t to, uint8_t amount) {
+	const uint16_t keep = 256 - amount;
+	return color_t(
+		(from.r * keep + to.r * amount) >> 8,
+		(from.g * keep + to.g * amount) >> 8,
+		(from.b * keep + to.b * amount) >> 8
+	);
+}
+
+
+
+static void test_palette() {
+	static uint8_t	indices[MAX_PIXELS];
+	static uint16_t	positions[MAX_PIXELS];
+	static color_t	got[MAX_PIXELS];
+
+	const color_t vga[16] = {
+		color_t::white(),	color_t::red(),		color_t::yellow(),	color_t::lime(),
+		color_t::aqua(),	color_t::blue(),	color_t::fuchsia(),	color_t::orange(),
+		color_t::gray(),	color_t::silver(),	color_t::maroon(),	color_t::olive(),
+		color_t::green(),	color_t::teal(),	color_t::navy(),	color_t::purple(),
+	};
+
+	bool ok = true;
+	for (uint16_t i=0; i<256; i++) {
+		ok = ok  &&  same_color(color_t::palette(i), i < 16 ? vga[i] : color_t());
+	}
+	for (uint8_t i=0; i<16; i++) {
+		ok = ok  &&  same_color(color_t::progmem(color_palette_rainbow[i]), color_t::hue(i * 48));
+	}
+	check(ok, "palette/tables", 16);
+
+	const color_palette_t			flash(color_palette_rainbow);
+	const color_palette_t			ram(vga);
+	color_palette_buffer_t<256>		smooth(flash);
+	const color_palette_t			*palettes[] = {&flash, &ram, &smooth};
+
+	for (const color_palette_t *palette : palettes) {
+		const uint16_t size = palette->size();
+
+		// WHOLE ENTRIES COME BACK UNBLENDED, AND THE LAST BLENDS INTO THE FIRST
+		ok = true;
+		for (uint16_t i=0; i<size; i++) {
+			const uint16_t position = i * (65536ul / size);
+			ok = ok  &&  same_color(palette->blend(position), palette->get(i));
+			ok = ok  &&  same_color(palette->get(i + size), palette->get(i));
+			ok = ok  &&  same_color(palette->blend(position + (32768ul / size)), palette_mix(palette->get(i), palette->get(i + 1), 128));
+		}
+		check(ok, "palette/blend", size);
+
+		for (const size_t count : lengths) {
+			randomize(indices, sizeof(indices));
+			randomize(positions, sizeof(positions));
+
+			palette->map_palette(indices, got, count);
+			ok = true;
+			for (size_t i=0; i<count; i++) ok = ok  &&  same_color(got[i], palette->get(indices[i]));
+			check(ok, "palette/map", count);
+
+			palette->blend_palette(positions, got, count);
+			ok = true;
+			for (size_t i=0; i<count; i++) ok = ok  &&  same_color(got[i], palette->blend(positions[i]));
+			check(ok, "palette/blend_buffer", count);
+
+			palette->fill(got, count, positions[0], positions[1]);
+			ok = true;
+			for (size_t i=0; i<count; i++) ok = ok  &&  same_color(got[i], palette->blend((uint16_t)(positions[0] + positions[1] * i)));
+			check(ok, "palette/fill", count);
+		}
+	}
+
+	// THE RESAMPLED GRADIENT PASSES THROUGH EVERY SOURCE ENTRY
+	ok = smooth.size() == 256;
+	for (uint8_t i=0; i<16; i++) ok = ok  &&  same_color(smooth[(uint8_t)(i * 16)], flash[i]);
+	check(ok, "palette/resample", 256);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PACER: HISTOGRAM BUCKETS AND PERCENTILES ON KNOWN DATA, THEN THE PACER'S
+// COUNTERS OVER A FEW REAL FRAMES WITH DEADLINES MISSED ON PURPOSE. THE SLOW
+// STAGES OVERRUN BY A WHOLE PERIOD, SO SCHEDULING NOISE CAN'T FLIP A RESULT
+////////////////////////////////////////////////////////////////////////////////
+static void test_pacer() {
+	const uint32_t	times[]		= {0, 1, 2, 3, 4, 7, 8, 1000, 1023, 1024, 1ul << 30};
+	const uint8_t	buckets[]	= {0, 1, 2, 2, 3, 3, 4, 10, 10, 11, COLOR_PACER_BUCKETS - 1};
+	bool ok = true;
+	for (size_t i=0; i<sizeof(times)/sizeof(times[0]); i++) {
+		ok = ok  &&  color_histogram_t::bucket(times[i]) == buckets[i];
+	}
+	check(ok, "pacer/bucket", 0);
+
+	color_histogram_t histogram;
+	check(!histogram.min()  &&  !histogram.max()  &&  !histogram.mean()  &&  !histogram.percentile(50), "pacer/empty", 0);
+
+	// 1 TO 1000 EVENLY, SO EACH BUCKET REALLY IS UNIFORM
+	for (uint32_t us=1; us<=1000; us++) histogram.record(us);
+	const uint32_t p50 = histogram.percentile(50);
+	check(histogram.min() == 1  &&  histogram.max() == 1000  &&  histogram.mean() == 500, "pacer/summary", 1000);
+	check(p50 >= 490  &&  p50 <= 510  &&  histogram.percentile(99) >= 950, "pacer/percentile", 1000);
+	check(histogram.percentile(0) <= 2  &&  histogram.percentile(100) == 1000, "pacer/percentile_ends", 1000);
+
+	// ANY DATA: PERCENTILES NEVER DECREASE AND STAY BETWEEN MIN AND MAX
+	histogram.reset();
+	for (uint32_t i=0; i<5000; i++) histogram.record((random8() << 8 | random8()) >> (random8() & 15));
+	ok = true;
+	for (uint8_t pct=0, last=0; pct<=100; pct++) {
+		const uint32_t value = histogram.percentile(pct);
+		ok = ok  &&  value >= histogram.min()  &&  value <= histogram.max()  &&  value >= last;
+		last = value;
+	}
+	check(ok, "pacer/percentile_range", 5000);
+
+	color_pacer_t	pacer(50);
+	const auto		idle	= []() {};
+	const auto		slow	= []() { delayMicroseconds(50000); };
+
+	for (uint8_t i=0; i<3; i++) pacer.frame(idle, idle, idle);
+	check(pacer.period() == 20000  &&  pacer.frames() == 3  &&  !pacer.misses()  &&  !pacer.dropped(), "pacer/on_time", 3);
+	check(pacer.histogram(COLOR_PACER_RENDER).count == 3  &&  pacer.histogram(COLOR_PACER_LATENESS).count == 3
+		&&  pacer.histogram(COLOR_PACER_JITTER).count == 2, "pacer/histograms", 3);
+
+	// A SLOW RENDER MISSES ITS DEADLINE, AND THE NEXT FRAME GIVES UP A SLOT
+	pacer.frame(slow, idle, idle);
+	check(pacer.misses() == 1  &&  pacer.blame(COLOR_PACER_RENDER) == 1, "pacer/miss_render", 4);
+	pacer.frame(idle, idle, idle);
+	check(pacer.misses() == 1  &&  pacer.dropped() >= 1, "pacer/dropped", 5);
+
+	pacer.frame(idle, idle, slow);
+	check(pacer.misses() == 2  &&  pacer.blame(COLOR_PACER_OUTPUT) == 1  &&  pacer.frames() == 6, "pacer/miss_output", 6);
+
+	char text[1024];
+	const size_t length = pacer.summary(text, sizeof(text));
+	check(length == strlen(text)  &&  !strncmp(text, "frames 6 missed 2", 17), "pacer/summary_text", length);
+
+	pacer.reset();
+	check(!pacer.frames()  &&  !pacer.misses()  &&  !pacer.dropped()  &&  !pacer.histogram(COLOR_PACER_FRAME).count, "pacer/reset", 0);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MATRIX: EVERY LAYOUT, TILED AND NOT, AND ARBITRARY MAPS WITH GAPS, DRIVEN BY
+// RANDOM FILLS, BLITS, AND SCROLLS THAT ARE MIRRORED ON A PLAIN 2D ARRAY
+////////////////////////////////////////////////////////////////////////////////
+#define MATRIX_W	16
+#define MATRIX_H	12
+
+struct matrix_model_t {
+	color_t		pixel[MATRIX_H][MATRIX_W];
+	bool		gap[MATRIX_H][MATRIX_W];
+
+	void put(int x, int y, const color_t color) {
+		if (x < 0  ||  y < 0  ||  x >= MATRIX_W  ||  y >= MATRIX_H  ||  this->gap[y][x]) return;
+		this->pixel[y][x] = color;
+	}
+};
+
+
+
+static bool test_matrix_same(const color_matrix_t &matrix, const matrix_model_t &model) {
+	for (int y=0; y<MATRIX_H; y++) {
+		for (int x=0; x<MATRIX_W; x++) {
+			if (!same_color(matrix.get(x, y), model.pixel[y][x])) return false;
+		}
+	}
+	return true;
+}
+
+
+
+static void test_matrix_ops(const char *name, color_matrix_t &matrix) {
+	static matrix_model_t	model;
+	static color_t			image[MATRIX_H * 2][MATRIX_W * 2];
+
+	for (int y=0; y<MATRIX_H; y++) {
+		for (int x=0; x<MATRIX_W; x++) {
+			model.gap[y][x]		= matrix.index(x, y) == COLOR_MATRIX_NONE;
+			model.pixel[y][x]	= color_t();
+		}
+	}
+	matrix.fill(color_t());
+
+	bool ok = true;
+	for (int op=0; op<300; op++) {
+		const int		x		= (int)(random8() % (MATRIX_W * 2)) - MATRIX_W / 2;
+		const int		y		= (int)(random8() % (MATRIX_H * 2)) - MATRIX_H / 2;
+		const int		w		= random8() % (MATRIX_W + 4);
+		const int		h		= random8() % (MATRIX_H + 4);
+		color_t			color;
+		randomize(&color, sizeof(color));
+
+		switch (op % 4) {
+			case 0:
+				matrix.fill(x, y, w, h, color);
+				for (int j=0; j<h; j++) for (int i=0; i<w; i++) model.put(x + i, y + j, color);
+				break;
+
+			case 1:
+				randomize(image, sizeof(image));
+				matrix.blit(&image[0][0], MATRIX_W * 2, x, y, w, h);
+				for (int j=0; j<h; j++) for (int i=0; i<w; i++) model.put(x + i, y + j, image[j][i]);
+				break;
+
+			case 2: {
+				const int dx = (int)(random8() % (MATRIX_W + 3)) - (MATRIX_W + 3) / 2;
+				const int dy = (int)(random8() % (MATRIX_H + 3)) - (MATRIX_H + 3) / 2;
+				matrix.scroll(dx, dy, color);
+
+				static matrix_model_t before;
+				before = model;
+				for (int j=0; j<MATRIX_H; j++) {
+					for (int i=0; i<MATRIX_W; i++) {
+						const int sx = i - dx, sy = j - dy;
+						const bool inside = sx >= 0  &&  sy >= 0  &&  sx < MATRIX_W  &&  sy < MATRIX_H;
+						model.pixel[j][i] = color_t();
+						model.put(i, j, inside ? before.pixel[sy][sx] : color);
+					}
+				}
+				break;
+			}
+
+			default:
+				matrix.set(x, y, color);
+				model.put(x, y, color);
+				break;
+		}
+
+		ok = ok  &&  test_matrix_same(matrix, model);
+	}
+	check(ok, name, matrix.run());
+}
+
+
+
+static void test_matrix() {
+	static color_t	pixels[MATRIX_W * MATRIX_H];
+	static uint16_t	map[MATRIX_W * MATRIX_H], lookup[MATRIX_W * MATRIX_H];
+	const size_t	total	= MATRIX_W * MATRIX_H;
+
+	// KNOWN POSITIONS: THE SECOND ROW OF A SERPENTINE RUNS BACKWARDS, AND
+	// TILED PANELS ARE CHAINED LEFT TO RIGHT, THEN TOP TO BOTTOM
+	check(color_matrix_locate(COLOR_MATRIX_ROWS, 16, 12, 3, 1) == 19
+		&&  color_matrix_locate(COLOR_MATRIX_SERPENTINE, 16, 12, 3, 1) == 28
+		&&  color_matrix_locate(COLOR_MATRIX_COLUMNS, 16, 12, 3, 1) == 37
+		&&  color_matrix_locate(COLOR_MATRIX_COLUMNS_SERPENTINE, 16, 12, 3, 1) == 46
+		&&  color_matrix_locate(COLOR_MATRIX_ROWS, 16, 12, 9, 5, 8, 4) == 8 * 4 * 3 + 8 + 1, "matrix/locate", 0);
+
+	const COLOR_MATRIX_LAYOUT layouts[] = {
+		COLOR_MATRIX_ROWS, COLOR_MATRIX_COLUMNS, COLOR_MATRIX_SERPENTINE, COLOR_MATRIX_COLUMNS_SERPENTINE,
+	};
+	const uint16_t panels[][2] = {{0, 0}, {8, 4}, {4, 6}, {16, 3}};
+
+	for (const COLOR_MATRIX_LAYOUT layout : layouts) {
+		for (const auto &panel : panels) {
+			color_matrix_t matrix(pixels, total, MATRIX_W, MATRIX_H, map, layout, panel[0], panel[1]);
+
+			// EVERY LED IS USED EXACTLY ONCE
+			bool ok = true;
+			uint8_t used[total] = {};
+			for (size_t i=0; i<total; i++) ok = ok  &&  map[i] < total  &&  !used[map[i]]++;
+			check(ok, "matrix/layout", layout);
+
+			test_matrix_ops("matrix/ops", matrix);
+		}
+	}
+
+	// A SHORT STRIP LEAVES GAPS AT THE END OF THE LAYOUT
+	color_matrix_t short_strip(pixels, total - 21, MATRIX_W, MATRIX_H, map, COLOR_MATRIX_SERPENTINE);
+	test_matrix_ops("matrix/short", short_strip);
+
+	// AN ARBITRARY SHUFFLED MAP WITH HOLES IN IT
+	for (size_t i=0; i<total; i++) lookup[i] = i;
+	for (size_t i=total-1; i>0; i--) {
+		const size_t j = (random8() << 8 | random8()) % (i + 1);
+		const uint16_t t = lookup[i];
+		lookup[i] = lookup[j];
+		lookup[j] = t;
+	}
+	for (size_t i=0; i<total; i+=7) lookup[i] = COLOR_MATRIX_NONE;
+
+	color_matrix_t shuffled(pixels, total, MATRIX_W, MATRIX_H, map, COLOR_MATRIX_ROWS);
+	shuffled.remap(lookup);
+	check(shuffled.run() == 1, "matrix/remap_run", shuffled.run());
+	test_matrix_ops("matrix/remap", shuffled);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CONSTEXPR: NAMED COLORS, THE NAMED COLOR TABLE, AND BLENDS MUST ALL BE
+// USABLE IN CONSTANT EXPRESSIONS. THESE ARE CHECKED BY THE COMPILER, SO THEY
+// FAIL THE BUILD RATHER THAN THE RUN
+////////////////////////////////////////////////////////////////////////////////
+static constexpr color_t constexpr_ramp[] = {
+	color_t::lerp(color_t::black(), color_t::tomato(), 0),
+	color_t::lerp(color_t::black(), color_t::tomato(), 128),
+	color_t::lerp(color_t::black(), color_t::tomato(), 255),
+	color_t::hue(256),
+};
+
+static_assert(color_t::tomato().r == 0xff  &&  color_t::tomato().g == 0x63  &&  color_t::tomato().b == 0x47, "tomato()");
+static_assert(color_names_colors[COLOR_NAME_TOMATO].r == 0xff, "tomato in the table");
+static_assert(color_names_colors[COLOR_NAME_TOMATO].g == 0x63, "tomato in the table");
+static_assert(color_names_colors[COLOR_NAME_TOMATO].b == 0x47, "tomato in the table");
+static_assert((uint32_t)color_t::aliceblue() == 0xf0f8ff, "uint32_t conversion");
+static_assert(color_t(0x123456l).grb() == 0x341256, "grb()");
+static_assert(color_t::blend(255, 0, 0) == 255  &&  color_t::blend(0, 255, 255) == 255, "blend() ends");
+static_assert(color_t::blend(255, 0, 128) == 127  &&  color_t::scale256(255, 255) == 256, "blend() middle");
+static_assert(constexpr_ramp[1].r == 128  &&  constexpr_ramp[1].g == 50  &&  constexpr_ramp[2].b == 0x47, "lerp() table");
+
+#if __cplusplus >= 201402L
+static constexpr color_t constexpr_mutate() {
+	color_t color = color_t::gray();
+	color.add(color_t(0x10, 0x20, 0x30));
+	return color.multiply(128);
+}
+static_assert(constexpr_mutate().r == 0x48  &&  constexpr_mutate().b == 0x58, "C++14 mutators");
+#endif
+
+
+
+static void test_constexpr() {
+	color_t want[4] = {
+		color_t(),
+		color_t::tomato(),
+		color_t::tomato(),
+		color_t::hue(256),
+	};
+	want[1].blend(color_t(), 127);
+	check(same(constexpr_ramp, want, sizeof(want)), "constexpr/ramp", 4);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// MEDIAN CUT QUANTIZER: AN IMAGE WITH FEWER DISTINCT BINS THAN THE PALETTE
+// COMES BACK EXACTLY, A SMALLER PALETTE MAPS EVERY PIXEL TO ITS NEAREST ENTRY,
+// AND THE INDEX AND IN PLACE REMAPS AGREE
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t quantize_error(const color_t *pixels, const color_t *remapped, size_t count) {
+	uint64_t error = 0;
+	for (size_t i=0; i<count; i++) {
+		error += color_distance(pixels[i], remapped[i], COLOR_METRIC_RGB);
+	}
+	return error;
+}
+
+
+
+static void test_quantize() {
+	static color_quantize_t<>	quantize(COLOR_METRIC_RGB);
+	static color_t				pixels[MAX_PIXELS], got[MAX_PIXELS];
+	static uint8_t				indexes[MAX_PIXELS];
+
+	// 40 COLORS, EACH ALONE IN ITS OWN 5-BIT BIN, SO EVERY BIN AVERAGE IS EXACT
+	color_t distinct[40];
+	for (size_t i=0; i<40; i++) {
+		bool fresh;
+		do {
+			randomize(&distinct[i], sizeof(color_t));
+			fresh = true;
+			for (size_t j=0; j<i; j++) {
+				fresh = fresh  &&  ((distinct[i].r ^ distinct[j].r) | (distinct[i].g ^ distinct[j].g) | (distinct[i].b ^ distinct[j].b)) >= 8;
+			}
+		} while (!fresh);
+	}
+
+	for (size_t i=0; i<MAX_PIXELS; i++) {
+		pixels[i] = distinct[random8() % 40];
+	}
+
+	quantize.add(pixels, MAX_PIXELS);
+	check(quantize.build(256) == 40  &&  quantize.size() == 40, "quantize/build_exact", 40);
+
+	memcpy((void*)got, (const void*)pixels, sizeof(pixels));
+	quantize.remap(got, MAX_PIXELS);
+	check(same(got, pixels, sizeof(pixels)), "quantize/remap_exact", MAX_PIXELS);
+
+	// A SMALLER PALETTE: EVERY PIXEL GOES TO ITS NEAREST ENTRY
+	const uint16_t sizes[] = {1, 2, 8, 16};
+	for (const uint16_t size : sizes) {
+		check(quantize.build(size) == size, "quantize/build", size);
+
+		memcpy((void*)got, (const void*)pixels, sizeof(pixels));
+		quantize.remap(pixels, MAX_PIXELS, indexes);
+		quantize.remap(got, MAX_PIXELS);
+
+		bool ok = true;
+		for (size_t i=0; i<MAX_PIXELS; i++) {
+			const uint8_t want = color_nearest(quantize.palette(), quantize.size(), pixels[i], COLOR_METRIC_RGB);
+			ok = ok  &&  indexes[i] < size;
+			ok = ok  &&  same_color(got[i], quantize.palette(indexes[i]));
+			ok = ok  &&  color_distance(pixels[i], got[i], COLOR_METRIC_RGB) == color_distance(pixels[i], quantize.palette(want), COLOR_METRIC_RGB);
+		}
+		check(ok, "quantize/remap_nearest", size);
+	}
+
+	// A NOISY IMAGE: A BIGGER PALETTE NEVER FITS WORSE
+	for (size_t i=0; i<MAX_PIXELS; i++) {
+		randomize(&pixels[i], sizeof(color_t));
+	}
+
+	quantize.reset();
+	quantize.add(pixels, MAX_PIXELS);
+
+	uint64_t last = 0xffffffffffffffffull;
+	for (const uint16_t size : sizes) {
+		check(quantize.build(size) == size, "quantize/build_noise", size);
+		memcpy((void*)got, (const void*)pixels, sizeof(pixels));
+		quantize.remap(got, MAX_PIXELS);
+
+		const uint64_t error = quantize_error(pixels, got, MAX_PIXELS);
+		check(error < last, "quantize/noise_error", size);
+		last = error;
+	}
+
+	// NOTHING TO BUILD FROM: NO PALETTE, AND REMAP LEAVES THE BUFFER ALONE
+	check(quantize.build(0) == 0  &&  quantize.size() == 0, "quantize/build_zero", 0);
+	quantize.reset();
+	check(quantize.build(16) == 0, "quantize/build_empty", 0);
+
+	memcpy((void*)got, (const void*)pixels, sizeof(pixels));
+	quantize.remap(got, MAX_PIXELS);
+	check(same(got, pixels, sizeof(pixels)), "quantize/remap_empty", MAX_PIXELS);
+}
+
+
+
+
+int main() {
+	test_span();
+	test_ws2812();
+	test_dither();
+	test_power();
+	test_order();
+	test_packed();
+	test_indexed();
+	test_hex();
+	test_anim();
+	test_net();
+	test_hsv();
+	test_compositor();
+	test_color16();
+	test_render();
+	test_gamma();
+	test_names();
+	test_nearest();
+	test_palette();
+	test_pacer();
+	test_matrix();
+	test_constexpr();
+	test_quantize();
+
+	printf("%u checks, %u failed\n", checks, failures);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
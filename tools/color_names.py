@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+################################################################################
+# PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.
+# SOURCE:  https://github.com/circuitrewind/color
+# LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE
+################################################################################
+# GENERATES color_names_table.h FROM THE NAMED COLOR FUNCTIONS IN color.h
+#
+# THE TABLE IS A MINIMAL PERFECT HASH: EVERY NAME HASHES TO ITS OWN SLOT IN
+# A TABLE OF EXACTLY ONE SLOT PER NAME. NAMES ARE FIRST SPLIT INTO BUCKETS BY
+# THEIR HASH, THEN EACH BUCKET GETS A ONE-BYTE SEED THAT SCATTERS ITS NAMES
+# INTO FREE SLOTS. THE HASH FUNCTIONS HERE MUST MATCH color_names.h EXACTLY.
+#
+# EVERY SLOT'S COLOR IS A CONSTEXPR COLOR_T, AND THE COLOR_NAME ENUM GIVES THE
+# SLOT OF EACH NAME, SO THE SAME TABLE ALSO SERVES COMPILE-TIME LOOKUPS.
+#
+# IT ALSO WRITES AN IMPLICIT K-D TREE OVER THE SAME SLOTS FOR NEAREST COLOR
+# SEARCHES: THE NODE FOR RANGE [LO, HI) IS AT (LO + HI) / 2, SPLITTING ON
+# RED, GREEN, THEN BLUE BY DEPTH, WITH ITS TWO HALVES ON EITHER SIDE OF IT.
+#
+# USAGE: tools/color_names.py  (RUN FROM ANYWHERE, REWRITES THE TABLE IN PLACE)
+################################################################################
+
+import os
+import re
+import sys
+
+
+ROOT	= os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE	= os.path.join(ROOT, 'color.h')
+OUTPUT	= os.path.join(ROOT, 'color_names_table.h')
+MASK	= 0xffffffff
+
+
+
+
+################################################################################
+# FNV-1A OVER THE LOWER-CASED NAME
+################################################################################
+def color_names_hash(name):
+	value = 2166136261
+	for char in name.lower().encode('ascii'):
+		value = ((value ^ char) * 16777619) & MASK
+	return value
+
+
+
+
+################################################################################
+# MURMUR3 FINALIZER, MIXES THE NAME HASH WITH A BUCKET SEED
+################################################################################
+def color_names_mix(value, seed):
+	value ^= seed * 0x9e3779b9
+	value &= MASK
+	value ^= value >> 16
+	value = (value * 0x85ebca6b) & MASK
+	value ^= value >> 13
+	value = (value * 0xc2b2ae35) & MASK
+	value ^= value >> 16
+	return value
+
+
+
+
+################################################################################
+# READ EVERY "static INLINE constexpr color_t name() { return ...; }" FROM color.h
+################################################################################
+def read_colors():
+	pattern	= re.compile(r'static INLINE constexpr color_t (\w+)\(\)\s*\{ return (0x([0-9a-f]{6})l|color_t\(\)); \}')
+	colors	= []
+
+	with open(SOURCE) as file:
+		for match in pattern.finditer(file.read()):
+			value = int(match.group(3), 16) if match.group(3) else 0
+			colors.append((match.group(1), value))
+
+	return colors
+
+
+
+
+################################################################################
+# FIND A SEED FOR EACH BUCKET, BIGGEST BUCKETS FIRST
+################################################################################
+def build(colors, buckets):
+	count	= len(colors)
+	groups	= [[] for _ in range(buckets)]
+
+	for name, value in colors:
+		groups[color_names_hash(name) % buckets].append((name, value))
+
+	slots	= [None] * count
+	seeds	= [0] * buckets
+
+	for bucket in sorted(range(buckets), key=lambda b: -len(groups[b])):
+		for seed in range(256):
+			taken = [color_names_mix(color_names_hash(name), seed) % count for name, _ in groups[bucket]]
+			if len(set(taken)) == len(taken)  and  all(slots[slot] is None for slot in taken):
+				for slot, entry in zip(taken, groups[bucket]):
+					slots[slot] = entry
+				seeds[bucket] = seed
+				break
+		else:
+			return None
+
+	return slots, seeds
+
+
+
+
+################################################################################
+# ORDER SLOTS AS AN IMPLICIT BALANCED K-D TREE
+################################################################################
+def channel(value, axis):
+	return (value >> (16 - 8 * axis)) & 0xff
+
+def kdtree(slots, indexes, depth=0):
+	if not indexes: return []
+	axis	= depth % 3
+	indexes	= sorted(indexes, key=lambda i: (channel(slots[i][1], axis), i))
+	middle	= len(indexes) // 2
+	return (kdtree(slots, indexes[:middle], depth + 1)
+		+ [indexes[middle]]
+		+ kdtree(slots, indexes[middle+1:], depth + 1))
+
+
+
+
+def main():
+	colors = read_colors()
+	names  = [name for name, _ in colors]
+
+	if len(set(names)) != len(names):
+		sys.exit('duplicate color names in color.h')
+
+	for buckets in range(len(colors) // 5, len(colors) + 1):
+		result = build(colors, buckets)
+		if result: break
+	else:
+		sys.exit('unable to build perfect hash')
+
+	slots, seeds = result
+
+	offsets	= []
+	text	= []
+	offset	= 0
+	for name, _ in slots:
+		offsets.append(offset)
+		text.append(name)
+		offset += len(name) + 1
+
+	out = []
+	out.append('/*----------------------------------------------------------------------------*\\')
+	out.append('| PART OF THE CIRCUIT REWIND SOURCE CODE LIBRARY COLLECTION.                   |')
+	out.append('| SOURCE:  https://github.com/circuitrewind/color                              |')
+	out.append('| LICENSE: https://github.com/circuitrewind/color/blob/main/LICENSE            |')
+	out.append('+------------------------------------------------------------------------------+')
+	out.append('| GENERATED BY TOOLS/COLOR_NAMES.PY FROM COLOR.H - DO NOT EDIT BY HAND.        |')
+	out.append('| MINIMAL PERFECT HASH TABLE OF EVERY NAMED COLOR, SEE COLOR_NAMES.H.          |')
+	out.append('\\*----------------------------------------------------------------------------*/')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('#ifndef __color_names_table_h__')
+	out.append('#define __color_names_table_h__')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('#define COLOR_NAMES_COUNT\t\t%d' % len(slots))
+	out.append('#define COLOR_NAMES_BUCKETS\t\t%d' % len(seeds))
+	out.append('#define COLOR_NAMES_LONGEST\t\t%d' % max(len(name) for name in names))
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('// PER-BUCKET SEEDS')
+	out.append('static CONST uint8_t color_names_seed[COLOR_NAMES_BUCKETS] = {')
+	for i in range(0, len(seeds), 16):
+		out.append('\t' + ' '.join('%3d,' % seed for seed in seeds[i:i+16]))
+	out.append('};')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('// SLOT OF EACH NAMED COLOR, IN THE ORDER THEY ARE DECLARED IN COLOR.H')
+	out.append('enum COLOR_NAME : uint16_t {')
+	slot_of = dict((name, slot) for slot, (name, _) in enumerate(slots))
+	width = (len('COLOR_NAME_') + max(len(name) for name in names)) // 4 + 1
+	for name in names:
+		label = 'COLOR_NAME_' + name.upper()
+		out.append('\t%s%s= %d,' % (label, '\t' * (width - len(label) // 4), slot_of[name]))
+	out.append('};')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('// COLOR FOR EACH SLOT. USABLE IN CONSTANT EXPRESSIONS, BUT IN PROGMEM ON AVR,')
+	out.append('// SO READ IT AT RUN TIME WITH COLOR_NAMES_COLOR()')
+	out.append('static constexpr color_t color_names_colors[COLOR_NAMES_COUNT] PROGMEM = {')
+	for name, value in slots:
+		out.append('\tcolor_t(0x%02x, 0x%02x, 0x%02x),\t// %s' % ((value >> 16) & 0xff, (value >> 8) & 0xff, value & 0xff, name))
+	out.append('};')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('// OFFSET OF EACH SLOT\'S NAME IN COLOR_NAMES_TEXT')
+	out.append('static CONST uint16_t color_names_offset[COLOR_NAMES_COUNT] = {')
+	for i in range(0, len(offsets), 12):
+		out.append('\t' + ' '.join('%5d,' % value for value in offsets[i:i+12]))
+	out.append('};')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('// SLOTS ORDERED AS AN IMPLICIT K-D TREE, SPLIT ON R, G, B BY DEPTH')
+	out.append('static CONST uint16_t color_names_kd[COLOR_NAMES_COUNT] = {')
+	tree = kdtree(slots, list(range(len(slots))))
+	for i in range(0, len(tree), 12):
+		out.append('\t' + ' '.join('%5d,' % value for value in tree[i:i+12]))
+	out.append('};')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('// ALL NAMES, NUL SEPARATED, IN SLOT ORDER')
+	out.append('static CONST char color_names_text[] =')
+	for name in text:
+		out.append('\t"%s\\0"' % name)
+	out.append(';')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('')
+	out.append('#endif //__color_names_table_h__')
+
+	with open(OUTPUT, 'w') as file:
+		file.write('\n'.join(out) + '\n')
+
+	print('%d names, %d buckets' % (len(slots), len(seeds)))
+
+
+
+
+if __name__ == '__main__':
+	main()